@@ -67,6 +67,11 @@ public:
    */
   void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  bool isStreamable() const override;
+
 protected:
   ITKAcosImage();
 
@@ -10,6 +10,7 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -19,6 +20,8 @@
 #include "SIMPLib/ITK/Dream3DTemplateAliasMacro.h"
 #include "SIMPLib/ITK/itkDream3DImage.h"
 
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkTiledAdaptiveHistogramEqualizationImageFilter.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -27,6 +30,8 @@ ITKAdaptiveHistogramEqualizationImage::ITKAdaptiveHistogramEqualizationImage()
   m_Radius = CastStdToVec3<std::vector<unsigned int>, FloatVec3_t, float>(std::vector<unsigned int>(3, 5));
   m_Alpha = StaticCastScalar<float, float, float>(0.3f);
   m_Beta = StaticCastScalar<float, float, float>(0.3f);
+  m_TiledInterpolation = false;
+  m_ClipLimit = 0.0f;
 
 }
 
@@ -46,10 +51,16 @@ void ITKAdaptiveHistogramEqualizationImage::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Alpha", Alpha, FilterParameter::Parameter, ITKAdaptiveHistogramEqualizationImage));
   parameters.push_back(SIMPL_NEW_FLOAT_FP("Beta", Beta, FilterParameter::Parameter, ITKAdaptiveHistogramEqualizationImage));
 
+  QStringList tiledProps;
+  tiledProps << "ClipLimit";
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Tiled Interpolation (Fast)", TiledInterpolation, FilterParameter::Parameter, ITKAdaptiveHistogramEqualizationImage, tiledProps));
+  parameters.push_back(SIMPL_NEW_FLOAT_FP("Clip Limit (0: None)", ClipLimit, FilterParameter::Parameter, ITKAdaptiveHistogramEqualizationImage));
+
 
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKAdaptiveHistogramEqualizationImage, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKAdaptiveHistogramEqualizationImage));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -74,7 +85,10 @@ void ITKAdaptiveHistogramEqualizationImage::readFilterParameters(AbstractFilterP
   setRadius(reader->readFloatVec3("Radius", getRadius()));
   setAlpha(reader->readValue("Alpha", getAlpha()));
   setBeta(reader->readValue("Beta", getBeta()));
+  setTiledInterpolation(reader->readValue("TiledInterpolation", getTiledInterpolation()));
+  setClipLimit(reader->readValue("ClipLimit", getClipLimit()));
 
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
   reader->closeFilterGroup();
 }
 
@@ -88,8 +102,43 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
 
   // Check consistency of parameters
   this->CheckVectorEntry<unsigned int, FloatVec3_t>(m_Radius, "Radius", 1);
+  if(m_TiledInterpolation && m_ClipLimit != 0.0f && m_ClipLimit < 1.0f)
+  {
+    setErrorCondition(-55620);
+    notifyErrorMessage(getHumanLabel(), "Clip Limit must be 0 or at least 1", getErrorCondition());
+    return;
+  }
 
   ITKImageProcessingBase::dataCheck<InputPixelType, OutputPixelType, Dimension>();
+  if(getErrorCondition() < 0 || !m_TiledInterpolation)
+  {
+    return;
+  }
+  // Small radii on large images would give a mapping function to nearly every pixel: the tiles are enlarged
+  typedef itk::TiledAdaptiveHistogramEqualizationImageFilter<itk::Dream3DImage<InputPixelType, Dimension>> FilterType;
+  AttributeMatrix::Pointer attrMat = getDataContainerArray()->getAttributeMatrix(getSelectedCellArrayPath());
+  const QVector<size_t> tDims = attrMat->getTupleDimensions();
+  typename FilterType::SizeType imageSize;
+  for(unsigned int d = 0; d < Dimension; d++)
+  {
+    imageSize[d] = d < static_cast<unsigned int>(tDims.size()) ? tDims[d] : 1;
+  }
+  const typename FilterType::RadiusType radius = CastVec3ToITK<FloatVec3_t, typename FilterType::RadiusType, typename FilterType::RadiusType::SizeValueType>(m_Radius, FilterType::RadiusType::Dimension);
+  const itk::SizeValueType maximumNumberOfTiles = FilterType::New()->GetMaximumNumberOfTiles();
+  const typename FilterType::SizeType tileSize = FilterType::ComputeTileSize(radius, imageSize, maximumNumberOfTiles);
+  bool enlarged = false;
+  QStringList sizes;
+  for(unsigned int d = 0; d < Dimension; d++)
+  {
+    enlarged = enlarged || (tileSize[d] != 2 * radius[d] + 1);
+    sizes << QString::number(tileSize[d]);
+  }
+  if(enlarged)
+  {
+    setWarningCondition(-55621);
+    QString ss = QObject::tr("The Radius gives more than %1 tiles for this image: the tiles are enlarged to %2 pixels").arg(maximumNumberOfTiles).arg(sizes.join(" x "));
+    notifyWarningMessage(getHumanLabel(), ss, getWarningCondition());
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -108,6 +157,17 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
 {
   typedef itk::Dream3DImage<InputPixelType, Dimension> InputImageType;
   // typedef itk::Dream3DImage<OutputPixelType, Dimension> OutputImageType;
+  if(m_TiledInterpolation)
+  {
+    typedef itk::TiledAdaptiveHistogramEqualizationImageFilter<InputImageType> FilterType;
+    typename FilterType::Pointer filter = FilterType::New();
+    filter->SetRadius(CastVec3ToITK<FloatVec3_t, typename FilterType::RadiusType, typename FilterType::RadiusType::SizeValueType>(m_Radius, FilterType::RadiusType::Dimension));
+    filter->SetAlpha(static_cast<float>(m_Alpha));
+    filter->SetBeta(static_cast<float>(m_Beta));
+    filter->SetClipLimit(static_cast<float>(m_ClipLimit));
+    this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
+    return;
+  }
   // define filter
   typedef itk::AdaptiveHistogramEqualizationImageFilter<InputImageType> FilterType;
   typename FilterType::Pointer filter = FilterType::New();
@@ -34,6 +34,8 @@ class ITKImageProcessing_EXPORT ITKAdaptiveHistogramEqualizationImage : public I
   PYB11_PROPERTY(FloatVec3_t Radius READ getRadius WRITE setRadius)
   PYB11_PROPERTY(float Alpha READ getAlpha WRITE setAlpha)
   PYB11_PROPERTY(float Beta READ getBeta WRITE setBeta)
+  PYB11_PROPERTY(bool TiledInterpolation READ getTiledInterpolation WRITE setTiledInterpolation)
+  PYB11_PROPERTY(float ClipLimit READ getClipLimit WRITE setClipLimit)
 
 public:
   SIMPL_SHARED_POINTERS(ITKAdaptiveHistogramEqualizationImage)
@@ -51,6 +53,20 @@ public:
   SIMPL_FILTER_PARAMETER(float, Beta)
   Q_PROPERTY(float Beta READ getBeta WRITE setBeta)
 
+  /**
+   * @brief TiledInterpolation Computes one mapping function per tile of 2 * Radius + 1 pixels and interpolates
+   * them between the tile centers, instead of using the histogram of the neighborhood of every pixel
+   */
+  SIMPL_FILTER_PARAMETER(bool, TiledInterpolation)
+  Q_PROPERTY(bool TiledInterpolation READ getTiledInterpolation WRITE setTiledInterpolation)
+
+  /**
+   * @brief ClipLimit Maximum height of the histogram bins of a tile, relative to a uniform histogram, 0 for
+   * no limit. Only used with TiledInterpolation.
+   */
+  SIMPL_FILTER_PARAMETER(float, ClipLimit)
+  Q_PROPERTY(float ClipLimit READ getClipLimit WRITE setClipLimit)
+
   /**
    * @brief newFilterInstance Reimplemented from @see AbstractFilter class
    */
@@ -10,6 +10,7 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -48,6 +49,7 @@ void ITKApproximateSignedDistanceMapImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKApproximateSignedDistanceMapImage, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKApproximateSignedDistanceMapImage));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -72,6 +74,7 @@ void ITKApproximateSignedDistanceMapImage::readFilterParameters(AbstractFilterPa
   setInsideValue(reader->readValue("InsideValue", getInsideValue()));
   setOutsideValue(reader->readValue("OutsideValue", getOutsideValue()));
 
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
   reader->closeFilterGroup();
 }
 
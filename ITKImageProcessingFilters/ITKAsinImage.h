@@ -66,6 +66,11 @@ public:
    */
   void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  bool isStreamable() const override;
+
 protected:
   ITKAsinImage();
 
@@ -10,6 +10,7 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -41,9 +42,15 @@ void ITKAtanImage::setupFilterParameters()
 
 
 
+  QStringList streamingProps;
+  streamingProps << "SlabSize";
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Streamed Execution", StreamedExecution, FilterParameter::Parameter, ITKAtanImage, streamingProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Slab Size (Slices)", SlabSize, FilterParameter::Parameter, ITKAtanImage));
+
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKAtanImage, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKAtanImage));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -66,6 +73,9 @@ void ITKAtanImage::readFilterParameters(AbstractFilterParametersReader* reader,
   setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
 
+  setStreamedExecution(reader->readValue("StreamedExecution", getStreamedExecution()));
+  setSlabSize(reader->readValue("SlabSize", getSlabSize()));
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
   reader->closeFilterGroup();
 }
 
@@ -149,3 +159,11 @@ const QString ITKAtanImage::getSubGroupName() const
 {
   return "ITK IntensityTransformation";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKAtanImage::isStreamable() const
+{
+  return true;
+}
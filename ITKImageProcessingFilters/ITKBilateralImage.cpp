@@ -10,6 +10,7 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -47,9 +48,15 @@ void ITKBilateralImage::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("NumberOfRangeGaussianSamples", NumberOfRangeGaussianSamples, FilterParameter::Parameter, ITKBilateralImage));
 
 
+  QStringList streamingProps;
+  streamingProps << "SlabSize";
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Streamed Execution", StreamedExecution, FilterParameter::Parameter, ITKBilateralImage, streamingProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Slab Size (Slices)", SlabSize, FilterParameter::Parameter, ITKBilateralImage));
+
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKBilateralImage, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKBilateralImage));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -75,6 +82,9 @@ void ITKBilateralImage::readFilterParameters(AbstractFilterParametersReader* rea
   setRangeSigma(reader->readValue("RangeSigma", getRangeSigma()));
   setNumberOfRangeGaussianSamples(reader->readValue("NumberOfRangeGaussianSamples", getNumberOfRangeGaussianSamples()));
 
+  setStreamedExecution(reader->readValue("StreamedExecution", getStreamedExecution()));
+  setSlabSize(reader->readValue("SlabSize", getSlabSize()));
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
   reader->closeFilterGroup();
 }
 
@@ -162,3 +172,11 @@ const QString ITKBilateralImage::getSubGroupName() const
 {
   return "ITK Smoothing";
 }
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKBilateralImage::isStreamable() const
+{
+  return true;
+}
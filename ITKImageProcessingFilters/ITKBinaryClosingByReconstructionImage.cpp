@@ -11,6 +11,7 @@
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -19,6 +20,9 @@
 
 #include "SIMPLib/ITK/Dream3DTemplateAliasMacro.h"
 #include "SIMPLib/ITK/itkDream3DImage.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKMorphologyKernel.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkFlatBinaryReconstructionImageFilter.h"
 #include <itkFlatStructuringElement.h>
 
 
@@ -72,6 +76,7 @@ void ITKBinaryClosingByReconstructionImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKBinaryClosingByReconstructionImage, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKBinaryClosingByReconstructionImage));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -98,6 +103,7 @@ void ITKBinaryClosingByReconstructionImage::readFilterParameters(AbstractFilterP
   setKernelRadius(reader->readFloatVec3("KernelRadius", getKernelRadius()));
   setKernelType(reader->readValue("KernelType", getKernelType()));
 
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
   reader->closeFilterGroup();
 }
 
@@ -146,25 +152,24 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
   typedef typename StructuringElementType::RadiusType RadiusType;
   RadiusType elementRadius = CastVec3ToITK<FloatVec3_t, RadiusType, typename RadiusType::SizeValueType>(m_KernelRadius, RadiusType::Dimension);
   StructuringElementType structuringElement;
-  switch(getKernelType())
+  if(!ITKMorphologyKernel::Create(getKernelType(), elementRadius, structuringElement))
   {
-  case 0:
-    structuringElement = StructuringElementType::Annulus(elementRadius, false);
-    break;
-  case 1:
-    structuringElement = StructuringElementType::Ball(elementRadius, false);
-    break;
-  case 2:
-    structuringElement = StructuringElementType::Box(elementRadius);
-    break;
-  case 3:
-    structuringElement = StructuringElementType::Cross(elementRadius);
-    break;
-  default:
     setErrorCondition(-20);
     notifyErrorMessage(getHumanLabel(), "Unsupported structuring element", getErrorCondition());
     return;
   }
+  // Box, Cross and Ball elements are dilated segment by segment before the reconstruction
+  typedef itk::FlatBinaryReconstructionImageFilter<InputImageType, StructuringElementType> FlatFilterType;
+  if(FlatFilterType::IsSupported(structuringElement))
+  {
+    typename FlatFilterType::Pointer filter = FlatFilterType::New();
+    filter->SetOperation(FlatFilterType::Operation::Closing);
+    filter->SetForegroundValue(static_cast<double>(m_ForegroundValue));
+    filter->SetFullyConnected(static_cast<bool>(m_FullyConnected));
+    filter->SetKernel(structuringElement);
+    this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FlatFilterType>(filter);
+    return;
+  }
   // define filter
   typedef itk::BinaryClosingByReconstructionImageFilter<InputImageType, StructuringElementType> FilterType;
   typename FilterType::Pointer filter = FilterType::New();
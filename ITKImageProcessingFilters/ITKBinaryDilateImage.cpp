@@ -11,6 +11,7 @@
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -19,6 +20,9 @@
 
 #include "SIMPLib/ITK/Dream3DTemplateAliasMacro.h"
 #include "SIMPLib/ITK/itkDream3DImage.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKMorphologyKernel.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkFlatMorphologyImageFilter.h"
 #include <itkFlatStructuringElement.h>
 
 
@@ -74,6 +78,7 @@ void ITKBinaryDilateImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKBinaryDilateImage, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKBinaryDilateImage));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -101,6 +106,7 @@ void ITKBinaryDilateImage::readFilterParameters(AbstractFilterParametersReader*
   setKernelRadius(reader->readFloatVec3("KernelRadius", getKernelRadius()));
   setKernelType(reader->readValue("KernelType", getKernelType()));
 
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
   reader->closeFilterGroup();
 }
 
@@ -148,25 +154,25 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
   typedef typename StructuringElementType::RadiusType RadiusType;
   RadiusType elementRadius = CastVec3ToITK<FloatVec3_t, RadiusType, typename RadiusType::SizeValueType>(m_KernelRadius, RadiusType::Dimension);
   StructuringElementType structuringElement;
-  switch(getKernelType())
+  if(!ITKMorphologyKernel::Create(getKernelType(), elementRadius, structuringElement))
   {
-  case 0:
-    structuringElement = StructuringElementType::Annulus(elementRadius, false);
-    break;
-  case 1:
-    structuringElement = StructuringElementType::Ball(elementRadius, false);
-    break;
-  case 2:
-    structuringElement = StructuringElementType::Box(elementRadius);
-    break;
-  case 3:
-    structuringElement = StructuringElementType::Cross(elementRadius);
-    break;
-  default:
     setErrorCondition(-20);
     notifyErrorMessage(getHumanLabel(), "Unsupported structuring element", getErrorCondition());
     return;
   }
+  // Box, Cross and Ball elements are dilated segment by segment on the foreground indicator
+  typedef itk::FlatMorphologyImageFilter<InputImageType, OutputImageType, StructuringElementType> FlatFilterType;
+  if(FlatFilterType::IsSupported(structuringElement))
+  {
+    typename FlatFilterType::Pointer filter = FlatFilterType::New();
+    filter->SetOperation(FlatFilterType::Operation::BinaryDilate);
+    filter->SetBackgroundValue(static_cast<double>(m_BackgroundValue));
+    filter->SetForegroundValue(static_cast<double>(m_ForegroundValue));
+    filter->SetBoundaryToForeground(static_cast<bool>(m_BoundaryToForeground));
+    filter->SetKernel(structuringElement);
+    this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FlatFilterType>(filter);
+    return;
+  }
   // define filter
   typedef itk::BinaryDilateImageFilter<InputImageType, OutputImageType, StructuringElementType> FilterType;
   typename FilterType::Pointer filter = FilterType::New();
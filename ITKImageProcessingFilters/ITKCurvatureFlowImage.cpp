@@ -10,6 +10,7 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -19,6 +20,10 @@
 #include "SIMPLib/ITK/Dream3DTemplateAliasMacro.h"
 #include "SIMPLib/ITK/itkDream3DImage.h"
 
+#include <itkCurvatureFlowFunction.h>
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkIterativeDiffusionImageFilter.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -48,6 +53,7 @@ void ITKCurvatureFlowImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKCurvatureFlowImage, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKCurvatureFlowImage));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -72,6 +78,7 @@ void ITKCurvatureFlowImage::readFilterParameters(AbstractFilterParametersReader*
   setTimeStep(reader->readValue("TimeStep", getTimeStep()));
   setNumberOfIterations(reader->readValue("NumberOfIterations", getNumberOfIterations()));
 
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
   reader->closeFilterGroup();
 }
 
@@ -102,6 +109,33 @@ void ITKCurvatureFlowImage::dataCheckInternal()
 // -----------------------------------------------------------------------------
 
 template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKCurvatureFlowImage::filter()
+{
+  // The ping-pong engine reads and writes scalar pixels directly
+  this->filter<InputPixelType, OutputPixelType, Dimension>(std::is_arithmetic<InputPixelType>());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKCurvatureFlowImage::filter(std::true_type)
+{
+  typedef typename itk::NumericTraits<InputPixelType>::RealType RealPixelType;
+  typedef itk::Image<RealPixelType, Dimension> RealImageType;
+  typedef itk::CurvatureFlowFunction<RealImageType> FunctionType;
+  typedef itk::IterativeDiffusionImageFilter<itk::Dream3DImage<InputPixelType, Dimension>, itk::Dream3DImage<InputPixelType, Dimension>, FunctionType> FilterType;
+
+  typename FunctionType::Pointer function = FunctionType::New();
+  function->SetTimeStep(static_cast<double>(m_TimeStep));
+  typename FilterType::Pointer filter = FilterType::New();
+  filter->SetDifferenceFunction(function);
+  filter->SetNumberOfIterations(static_cast<uint32_t>(m_NumberOfIterations));
+  this->ITKImageProcessingBase::filter<InputPixelType, InputPixelType, Dimension, FilterType>(filter);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKCurvatureFlowImage::filter(std::false_type)
 {
   typedef typename itk::NumericTraits<InputPixelType>::RealType FloatPixelType;
   typedef itk::Dream3DImage<FloatPixelType, Dimension> FloatImageType;
@@ -111,7 +145,6 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
   filter->SetTimeStep(static_cast<double>(m_TimeStep));
   filter->SetNumberOfIterations(static_cast<uint32_t>(m_NumberOfIterations));
   this->ITKImageProcessingBase::filterCastToFloat<InputPixelType, InputPixelType, Dimension, FilterType, FloatImageType>(filter);
-
 }
 
 // -----------------------------------------------------------------------------
@@ -20,6 +20,8 @@
 #include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
 #include <itkCurvatureFlowImageFilter.h>
 
+#include <type_traits>
+
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
 
 /**
@@ -100,6 +102,16 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+  * @brief Runs the finite difference function of itk::CurvatureFlowImageFilter with itk::IterativeDiffusionImageFilter, to scalar pixels
+  */
+  template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter(std::true_type pingPong);
+
+  /**
+  * @brief Applies itk::CurvatureFlowImageFilter to the pixels cast to real ones, to the other pixel types
+  */
+  template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter(std::false_type pingPong);
+
 private:
   ITKCurvatureFlowImage(const ITKCurvatureFlowImage&) = delete;    // Copy Constructor Not Implemented
   ITKCurvatureFlowImage(ITKCurvatureFlowImage&&) = delete;         // Move Constructor Not Implemented
@@ -18,7 +18,6 @@
 
 // Auto includes
 #include <SIMPLib/FilterParameters/BooleanFilterParameter.h>
-#include <itkDanielssonDistanceMapImageFilter.h>
 
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
 
@@ -0,0 +1,76 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#include "ITKDataStructureLock.h"
+
+#include <mutex>
+
+namespace
+{
+std::mutex& DataStructureMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
+thread_local bool t_Held = false;
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKDataStructureLock::ITKDataStructureLock()
+: m_Owner(!t_Held)
+{
+  if(m_Owner)
+  {
+    DataStructureMutex().lock();
+    t_Held = true;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKDataStructureLock::~ITKDataStructureLock()
+{
+  if(m_Owner)
+  {
+    t_Held = false;
+    DataStructureMutex().unlock();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKDataStructureLock::IsHeld()
+{
+  return t_Held;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKDataStructureLock::Release::Release()
+: m_Released(t_Held)
+{
+  if(m_Released)
+  {
+    t_Held = false;
+    DataStructureMutex().unlock();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKDataStructureLock::Release::~Release()
+{
+  if(m_Released)
+  {
+    DataStructureMutex().lock();
+    t_Held = true;
+  }
+}
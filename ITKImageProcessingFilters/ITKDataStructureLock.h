@@ -0,0 +1,55 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+
+/**
+ * @brief The ITKDataStructureLock class serializes the accesses of the ITK filters to the data structure. The
+ * attribute matrices of a DataContainerArray are not meant to be modified concurrently, yet ITKFilterScheduler
+ * runs filters working on different arrays at the same time. A filter holds the lock while it looks up, creates,
+ * wraps or removes arrays and releases it (see Release) while ITK processes the pixels.
+ *
+ * The lock is held per thread: a thread that already holds it, e.g. a fused pipeline running its stages,
+ * does not lock it again.
+ */
+class ITKImageProcessing_EXPORT ITKDataStructureLock
+{
+public:
+  ITKDataStructureLock();
+  ~ITKDataStructureLock();
+
+  /**
+   * @brief The Release class releases the lock, if the calling thread holds it, while it lives
+   */
+  class ITKImageProcessing_EXPORT Release
+  {
+  public:
+    Release();
+    ~Release();
+
+    Release(const Release&) = delete;            // Copy Constructor Not Implemented
+    Release(Release&&) = delete;                 // Move Constructor Not Implemented
+    Release& operator=(const Release&) = delete; // Copy Assignment Not Implemented
+    Release& operator=(Release&&) = delete;      // Move Assignment Not Implemented
+
+  private:
+    bool m_Released;
+  };
+
+  /**
+   * @brief IsHeld Returns true if the calling thread holds the lock
+   */
+  static bool IsHeld();
+
+private:
+  bool m_Owner;
+
+public:
+  ITKDataStructureLock(const ITKDataStructureLock&) = delete;            // Copy Constructor Not Implemented
+  ITKDataStructureLock(ITKDataStructureLock&&) = delete;                 // Move Constructor Not Implemented
+  ITKDataStructureLock& operator=(const ITKDataStructureLock&) = delete; // Copy Assignment Not Implemented
+  ITKDataStructureLock& operator=(ITKDataStructureLock&&) = delete;      // Move Assignment Not Implemented
+};
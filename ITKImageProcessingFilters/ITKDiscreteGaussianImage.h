@@ -22,6 +22,8 @@
 #include <SIMPLib/FilterParameters/FloatVec3FilterParameter.h>
 #include <itkDiscreteGaussianImageFilter.h>
 
+#include <type_traits>
+
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
 
 /**
@@ -87,6 +89,11 @@ public:
    */
   void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  bool isStreamable() const override;
+
 protected:
   ITKDiscreteGaussianImage();
 
@@ -110,6 +117,16 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+  * @brief Reads the output from the scale space cache, to scalar pixels
+  */
+  template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter(std::true_type scaleSpace);
+
+  /**
+  * @brief Applies itk::DiscreteGaussianImageFilter, when the scale space cache cannot be used or to the other pixel types
+  */
+  template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter(std::false_type scaleSpace);
+
 private:
   ITKDiscreteGaussianImage(const ITKDiscreteGaussianImage&) = delete;    // Copy Constructor Not Implemented
   ITKDiscreteGaussianImage(ITKDiscreteGaussianImage&&) = delete;         // Move Constructor Not Implemented
@@ -81,6 +81,11 @@ public:
    */
   void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
 
+  /**
+   * @brief canRunConcurrently Reimplemented from @see ITKImageBase class
+   */
+  bool canRunConcurrently() const override;
+
 protected:
   ITKFFTNormalizedCorrelationImage();
 
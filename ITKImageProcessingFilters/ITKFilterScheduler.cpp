@@ -0,0 +1,254 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#include "ITKFilterScheduler.h"
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKThreadingPolicy.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/task_arena.h>
+#include <tbb/task_group.h>
+#endif
+
+namespace
+{
+/**
+ * @brief Intersects Returns true if @p first and @p second have an array in common
+ */
+bool Intersects(const QVector<DataArrayPath>& first, const QVector<DataArrayPath>& second)
+{
+  for(const DataArrayPath& path : first)
+  {
+    if(second.contains(path))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKFilterScheduler::ITKFilterScheduler(const FilterList& filters)
+: m_Filters(filters)
+, m_Dependencies(filters.size())
+, m_Failed(filters.size(), 0)
+, m_Stopped(false)
+{
+  for(int i = 0; i < m_Filters.size(); i++)
+  {
+    const bool concurrent = m_Filters[i]->canRunConcurrently();
+    const QVector<DataArrayPath> reads = ReadArrays(m_Filters[i].get());
+    const QVector<DataArrayPath> writes = WrittenArrays(m_Filters[i].get());
+    for(int j = 0; j < i; j++)
+    {
+      // Read after write, write after write and write after read
+      if(!concurrent || !m_Filters[j]->canRunConcurrently() || Intersects(WrittenArrays(m_Filters[j].get()), reads) || Intersects(WrittenArrays(m_Filters[j].get()), writes) ||
+         Intersects(ReadArrays(m_Filters[j].get()), writes))
+      {
+        m_Dependencies[i].push_back(j);
+      }
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKFilterScheduler::~ITKFilterScheduler() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<DataArrayPath> ITKFilterScheduler::ReadArrays(const ITKImageProcessingBase* filter)
+{
+  QVector<DataArrayPath> arrays;
+  arrays.push_back(filter->getSelectedCellArrayPath());
+  return arrays;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QVector<DataArrayPath> ITKFilterScheduler::WrittenArrays(const ITKImageProcessingBase* filter)
+{
+  DataArrayPath path = filter->getSelectedCellArrayPath();
+  if(filter->getSaveAsNewArray())
+  {
+    path.setDataArrayName(filter->getNewCellArrayName());
+  }
+  QVector<DataArrayPath> arrays;
+  arrays.push_back(path);
+  return arrays;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<int>& ITKFilterScheduler::getDependencies(int index) const
+{
+  return m_Dependencies[index];
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ITKFilterScheduler::execute(int maxConcurrentFilters)
+{
+  std::fill(m_Failed.begin(), m_Failed.end(), 0);
+  m_Stopped = false;
+  if(maxConcurrentFilters <= 0)
+  {
+    maxConcurrentFilters = ITKThreadingPolicy::Instance().getNumberOfThreads(0);
+  }
+
+  // The filters that must run alone split the list in groups of filters that can run concurrently
+  const int numberOfFilters = m_Filters.size();
+  int begin = 0;
+  for(int i = 0; i <= numberOfFilters; i++)
+  {
+    if(i == numberOfFilters || !m_Filters[i]->canRunConcurrently())
+    {
+      runGroup(begin, i, maxConcurrentFilters);
+      if(i < numberOfFilters)
+      {
+        runFilter(i, ITKThreadingPolicy::Instance().getNumberOfThreads(0));
+      }
+      begin = i + 1;
+    }
+  }
+
+  const int failed = getFailedFilter();
+  return failed < 0 ? 0 : m_Filters[failed]->getErrorCondition();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKFilterScheduler::runGroup(int begin, int end, int maxConcurrentFilters)
+{
+  const int numberOfFilters = end - begin;
+  if(numberOfFilters <= 0)
+  {
+    return;
+  }
+  const int concurrency = std::max(std::min(maxConcurrentFilters, numberOfFilters), 1);
+  const int threads = std::max(ITKThreadingPolicy::Instance().getNumberOfThreads(0) / concurrency, 1);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  if(concurrency > 1)
+  {
+    // Number of filters of the group each filter still waits for, and the filters waiting for it
+    std::vector<int> waiting(numberOfFilters, 0);
+    std::vector<std::vector<int>> successors(numberOfFilters);
+    for(int i = begin; i < end; i++)
+    {
+      for(int dependency : m_Dependencies[i])
+      {
+        if(dependency >= begin)
+        {
+          waiting[i - begin]++;
+          successors[dependency - begin].push_back(i);
+        }
+      }
+    }
+
+    std::mutex mutex;
+    tbb::task_arena arena(concurrency);
+    tbb::task_group group;
+    std::function<void(int)> run = [&](int index) {
+      runFilter(index, threads);
+      std::vector<int> ready;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        for(int successor : successors[index - begin])
+        {
+          if(--waiting[successor - begin] == 0)
+          {
+            ready.push_back(successor);
+          }
+        }
+      }
+      for(int next : ready)
+      {
+        group.run([&run, next] { run(next); });
+      }
+    };
+    arena.execute([&] {
+      for(int i = begin; i < end; i++)
+      {
+        if(waiting[i - begin] == 0)
+        {
+          group.run([&run, i] { run(i); });
+        }
+      }
+      group.wait();
+    });
+    return;
+  }
+#endif
+
+  for(int i = begin; i < end; i++)
+  {
+    runFilter(i, threads);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKFilterScheduler::runFilter(int index, int threads)
+{
+  // Filters that depend on a failed one still complete the graph, they are just not run
+  if(m_Stopped)
+  {
+    return;
+  }
+  ITKImageProcessingBase::Pointer filter = m_Filters[index];
+  const int requestedThreads = filter->getNumberOfThreads();
+  if(requestedThreads == 0)
+  {
+    filter->setNumberOfThreads(threads);
+  }
+  filter->execute();
+  filter->setNumberOfThreads(requestedThreads);
+  if(filter->getErrorCondition() < 0 || filter->getCancel())
+  {
+    m_Failed[index] = (filter->getErrorCondition() < 0) ? 1 : 0;
+    m_Stopped = true;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ITKFilterScheduler::getFailedFilter() const
+{
+  for(size_t i = 0; i < m_Failed.size(); i++)
+  {
+    if(m_Failed[i] != 0)
+    {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKFilterScheduler::cancel()
+{
+  m_Stopped = true;
+  for(const ITKImageProcessingBase::Pointer& filter : m_Filters)
+  {
+    filter->setCancel(true);
+  }
+}
@@ -0,0 +1,99 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include <QtCore/QVector>
+
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+
+#include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageProcessingBase.h"
+
+/**
+ * @brief The ITKFilterScheduler class runs a list of ITK filters, in order, but lets the filters that work on
+ * different arrays run at the same time.
+ *
+ * A filter reads its SelectedCellArrayPath and writes either NewCellArrayName, next to it, or the selected
+ * array itself when it replaces it. A filter waits for every earlier filter that writes an array it reads or
+ * writes, or that reads an array it writes. The order of the accesses to each array is therefore the order
+ * of the list, and the results are those of running the filters one after the other. Filters that cannot run
+ * concurrently (see ITKImageBase::canRunConcurrently()) wait for all the filters before them and run alone.
+ *
+ * The thread budget of ITKThreadingPolicy is shared by the filters running at the same time: a filter whose
+ * NumberOfThreads is 0 gets its share of the budget instead of the whole of it.
+ *
+ * Filters run concurrently only when the plugin is built with SIMPL_USE_PARALLEL_ALGORITHMS, otherwise one
+ * after the other.
+ */
+class ITKImageProcessing_EXPORT ITKFilterScheduler
+{
+public:
+  using FilterList = QVector<ITKImageProcessingBase::Pointer>;
+
+  /**
+   * @param filters Filters to run, in the order they would run in a pipeline. Their DataContainerArray must be set.
+   */
+  explicit ITKFilterScheduler(const FilterList& filters);
+  ~ITKFilterScheduler();
+
+  /**
+   * @brief getDependencies Returns the indexes of the filters that filter @p index waits for
+   */
+  const std::vector<int>& getDependencies(int index) const;
+
+  /**
+   * @brief execute Runs the filters, at most @p maxConcurrentFilters at a time (0: as many as the thread budget).
+   * Once a filter fails, no other filter is started.
+   * @return 0 on success, the error condition of the first failed filter of the list otherwise
+   */
+  int execute(int maxConcurrentFilters = 0);
+
+  /**
+   * @brief getFailedFilter Returns the index of the first filter of the list that failed during the last
+   * execute(), -1 if none did
+   */
+  int getFailedFilter() const;
+
+  /**
+   * @brief cancel Cancels the running filters and keeps the others from starting
+   */
+  void cancel();
+
+  /**
+   * @brief ReadArrays Returns the arrays read by @p filter
+   */
+  static QVector<DataArrayPath> ReadArrays(const ITKImageProcessingBase* filter);
+
+  /**
+   * @brief WrittenArrays Returns the arrays created or replaced by @p filter
+   */
+  static QVector<DataArrayPath> WrittenArrays(const ITKImageProcessingBase* filter);
+
+protected:
+  /**
+   * @brief runFilter Runs filter @p index with @p threads threads when it does not ask for its own number
+   */
+  void runFilter(int index, int threads);
+
+  /**
+   * @brief runGroup Runs the filters [@p begin, @p end), which can all run concurrently
+   */
+  void runGroup(int begin, int end, int maxConcurrentFilters);
+
+private:
+  FilterList m_Filters;
+  std::vector<std::vector<int>> m_Dependencies;
+  std::vector<char> m_Failed;
+  std::atomic<bool> m_Stopped;
+
+public:
+  ITKFilterScheduler(const ITKFilterScheduler&) = delete;            // Copy Constructor Not Implemented
+  ITKFilterScheduler(ITKFilterScheduler&&) = delete;                 // Move Constructor Not Implemented
+  ITKFilterScheduler& operator=(const ITKFilterScheduler&) = delete; // Copy Assignment Not Implemented
+  ITKFilterScheduler& operator=(ITKFilterScheduler&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,404 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#include "ITKFusedPipelineImage.h"
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
+#include "SIMPLib/FilterParameters/StringFilterParameter.h"
+#include "SIMPLib/Filtering/FilterManager.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "SIMPLib/ITK/itkDream3DFilterInterruption.h"
+
+namespace
+{
+/**
+ * @brief UniqueArrayName Returns @p name, suffixed if needed so that it does not exist in @p attrMat
+ */
+QString UniqueArrayName(const AttributeMatrix::Pointer& attrMat, const QString& name)
+{
+  QString uniqueName = name;
+  int suffix = 1;
+  while(attrMat->doesAttributeArrayExist(uniqueName))
+  {
+    uniqueName = QString("%1_%2").arg(name).arg(suffix++);
+  }
+  return uniqueName;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKFusedPipelineImage::ITKFusedPipelineImage()
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKFusedPipelineImage::~ITKFusedPipelineImage() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKFusedPipelineImage::appendStage(const ITKImageProcessingBase::Pointer& stage)
+{
+  if(nullptr == stage)
+  {
+    return;
+  }
+  QJsonObject parameters;
+  for(const FilterParameter::Pointer& parameter : stage->getFilterParameters())
+  {
+    parameter->writeJson(parameters);
+  }
+  QJsonObject description;
+  description["Filter"] = stage->getNameOfClass();
+  description["Parameters"] = parameters;
+
+  QJsonArray descriptions = QJsonDocument::fromJson(getStageDescriptions().toUtf8()).array();
+  descriptions.append(description);
+  setStageDescriptions(QString::fromUtf8(QJsonDocument(descriptions).toJson(QJsonDocument::Compact)));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ITKFusedPipelineImage::createStages(StageList& stages, QString& errorMessage) const
+{
+  stages.clear();
+  if(getStageDescriptions().trimmed().isEmpty())
+  {
+    return 0;
+  }
+  QJsonParseError parseError;
+  QJsonDocument document = QJsonDocument::fromJson(getStageDescriptions().toUtf8(), &parseError);
+  if(parseError.error != QJsonParseError::NoError || !document.isArray())
+  {
+    errorMessage = QObject::tr("The stages must be a JSON array of {\"Filter\": ..., \"Parameters\": {...}} objects");
+    return -55573;
+  }
+  FilterManager* fm = FilterManager::Instance();
+  const QJsonArray descriptions = document.array();
+  for(int i = 0; i < descriptions.size(); i++)
+  {
+    const QJsonObject description = descriptions[i].toObject();
+    const QString className = description["Filter"].toString();
+    IFilterFactory::Pointer factory = fm->getFactoryFromClassName(className);
+    ITKImageProcessingBase::Pointer stage;
+    if(nullptr != factory)
+    {
+      stage = std::dynamic_pointer_cast<ITKImageProcessingBase>(factory->create());
+    }
+    if(nullptr == stage)
+    {
+      errorMessage = QObject::tr("Stage %1 (%2) is not an ITK Image Processing filter").arg(i).arg(className);
+      stages.clear();
+      return -55574;
+    }
+    const QJsonObject parameters = description["Parameters"].toObject();
+    for(const FilterParameter::Pointer& parameter : stage->getFilterParameters())
+    {
+      parameter->readJson(parameters);
+    }
+    stages.push_back(stage);
+  }
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKFusedPipelineImage::setupFilterParameters()
+{
+  FilterParameterVector parameters;
+
+  QStringList streamingProps;
+  streamingProps << "SlabSize";
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Streamed Execution", StreamedExecution, FilterParameter::Parameter, ITKFusedPipelineImage, streamingProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Slab Size (Slices)", SlabSize, FilterParameter::Parameter, ITKFusedPipelineImage));
+
+  QStringList linkedProps;
+  linkedProps << "NewCellArrayName";
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKFusedPipelineImage, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKFusedPipelineImage));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Stages (JSON)", StageDescriptions, FilterParameter::Parameter, ITKFusedPipelineImage));
+  parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
+  {
+    DataArraySelectionFilterParameter::RequirementType req =
+        DataArraySelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, SIMPL::Defaults::AnyComponentSize, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Attribute Array to filter", SelectedCellArrayPath, FilterParameter::RequiredArray, ITKFusedPipelineImage, req));
+  }
+  parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::CreatedArray));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::CreatedArray, ITKFusedPipelineImage));
+
+  setFilterParameters(parameters);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKFusedPipelineImage::readFilterParameters(AbstractFilterParametersReader* reader, int index)
+{
+  reader->openFilterGroup(this, index);
+  setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
+  setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
+  setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  setStreamedExecution(reader->readValue("StreamedExecution", getStreamedExecution()));
+  setSlabSize(reader->readValue("SlabSize", getSlabSize()));
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
+  setStageDescriptions(reader->readString("StageDescriptions", getStageDescriptions()));
+  reader->closeFilterGroup();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKFusedPipelineImage::isStreamable() const
+{
+  for(const ITKImageProcessingBase::Pointer& stage : m_Stages)
+  {
+    if(!stage->isStreamable())
+    {
+      return false;
+    }
+  }
+  return !m_Stages.isEmpty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKFusedPipelineImage::canRunConcurrently() const
+{
+  // The stages are unknown until the filter is checked: it then runs alone
+  for(const ITKImageProcessingBase::Pointer& stage : m_Stages)
+  {
+    if(!stage->canRunConcurrently())
+    {
+      return false;
+    }
+  }
+  return !m_Stages.isEmpty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKFusedPipelineImage::dataCheckInternal()
+{
+  setErrorCondition(0);
+  setWarningCondition(0);
+  m_IntermediateArrayNames.clear();
+  m_OutputArrayName.clear();
+
+  // New stages are created on every check so that they always match StageDescriptions
+  QString errorMessage;
+  int err = createStages(m_Stages, errorMessage);
+  if(err < 0)
+  {
+    m_Stages.clear();
+    setErrorCondition(err);
+    notifyErrorMessage(getHumanLabel(), errorMessage, getErrorCondition());
+    return;
+  }
+  if(m_Stages.isEmpty())
+  {
+    setErrorCondition(-55570);
+    notifyErrorMessage(getHumanLabel(), "The pipeline must contain at least one filter", getErrorCondition());
+    return;
+  }
+
+  getDataContainerArray()->getPrereqIDataArrayFromPath<IDataArray, AbstractFilter>(this, getSelectedCellArrayPath());
+  if(getErrorCondition() < 0)
+  {
+    return;
+  }
+  AttributeMatrix::Pointer attrMat = getDataContainerArray()->getAttributeMatrix(getSelectedCellArrayPath());
+
+  // When replacing the input array, the last stage writes to a temporary array that is renamed at the end
+  m_OutputArrayName = getSaveAsNewArray() ? getNewCellArrayName() : UniqueArrayName(attrMat, "FusedPipelineOutput");
+
+  DataArrayPath stageInputPath = getSelectedCellArrayPath();
+  for(int i = 0; i < m_Stages.size(); i++)
+  {
+    ITKImageProcessingBase::Pointer stage = m_Stages[i];
+    const bool lastStage = (i == m_Stages.size() - 1);
+    const QString stageOutputName = lastStage ? m_OutputArrayName : UniqueArrayName(attrMat, QString("FusedPipelineStage%1").arg(i));
+
+    connect(stage.get(), SIGNAL(filterGeneratedMessage(const PipelineMessage&)), this, SIGNAL(filterGeneratedMessage(const PipelineMessage&)), Qt::UniqueConnection);
+    stage->setDataContainerArray(getDataContainerArray());
+    stage->setSelectedCellArrayPath(stageInputPath);
+    stage->setSaveAsNewArray(true);
+    stage->setNewCellArrayName(stageOutputName);
+    // The stage is preflighted even during execute so that the arrays it creates are not allocated
+    stage->preflight();
+    if(stage->getErrorCondition() < 0)
+    {
+      setErrorCondition(stage->getErrorCondition());
+      QString ss = QObject::tr("Stage %1 (%2) of the pipeline is not valid").arg(i).arg(stage->getHumanLabel());
+      notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      break;
+    }
+    if(!lastStage)
+    {
+      m_IntermediateArrayNames << stageOutputName;
+    }
+    stageInputPath.setDataArrayName(stageOutputName);
+  }
+
+  if(getInPreflight() || getErrorCondition() < 0)
+  {
+    removeIntermediateArrays(!getSaveAsNewArray());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKFusedPipelineImage::filterInternal()
+{
+  itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New();
+  interruption->SetFilter(this);
+
+  // The stages get back their own settings once the pipeline has run
+  QVector<int> stageThreads;
+  for(const ITKImageProcessingBase::Pointer& stage : m_Stages)
+  {
+    stageThreads.push_back(stage->getNumberOfThreads());
+  }
+
+  itk::DataObject::Pointer stageOutput;
+  for(int i = 0; i < m_Stages.size(); i++)
+  {
+    ITKImageProcessingBase::Pointer stage = m_Stages[i];
+    const bool lastStage = (i == m_Stages.size() - 1);
+    if(lastStage)
+    {
+      // Updating the last stage runs the whole chain, so it also decides whether the chain is streamed
+      stage->setStreamedExecution(getStreamedExecution() && isStreamable());
+      stage->setSlabSize(getSlabSize());
+      notifyStatusMessage(getHumanLabel(), QObject::tr("Running the %1 fused filters").arg(m_Stages.size()));
+    }
+    // The threads of the fused filter apply to every stage that does not ask for its own
+    if(getNumberOfThreads() > 0 && stage->getNumberOfThreads() == 0)
+    {
+      stage->setNumberOfThreads(getNumberOfThreads());
+    }
+    stage->setCancel(false);
+    stage->executePipelineStage(stageOutput, !lastStage);
+    if(stage->getErrorCondition() < 0)
+    {
+      if(!getCancel())
+      {
+        setErrorCondition(stage->getErrorCondition());
+        QString ss = QObject::tr("Stage %1 (%2) of the pipeline failed").arg(i).arg(stage->getHumanLabel());
+        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      }
+      break;
+    }
+    if(!lastStage)
+    {
+      if(nullptr == stage->getPipelineFilter())
+      {
+        setErrorCondition(-55572);
+        QString ss = QObject::tr("Stage %1 (%2) cannot be fused with other filters").arg(i).arg(stage->getHumanLabel());
+        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+        break;
+      }
+      // Cancelling this filter interrupts whichever stage is currently running
+      stage->getPipelineFilter()->AddObserver(itk::ProgressEvent(), interruption);
+      stageOutput = stage->getPipelineOutput();
+    }
+  }
+  stageOutput = nullptr;
+  for(int i = 0; i < m_Stages.size(); i++)
+  {
+    m_Stages[i]->releasePipelineStage();
+    m_Stages[i]->setNumberOfThreads(stageThreads[i]);
+  }
+
+  const bool succeeded = (getErrorCondition() >= 0 && !getCancel());
+  removeIntermediateArrays(!succeeded && !getSaveAsNewArray());
+  if(!succeeded)
+  {
+    return;
+  }
+  if(!getSaveAsNewArray())
+  {
+    AttributeMatrix::Pointer attrMat = getDataContainerArray()->getAttributeMatrix(getSelectedCellArrayPath());
+    attrMat->removeAttributeArray(getSelectedCellArrayPath().getDataArrayName());
+    attrMat->renameAttributeArray(m_OutputArrayName, getSelectedCellArrayPath().getDataArrayName());
+  }
+
+  notifyStatusMessage(getHumanLabel(), "Complete");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKFusedPipelineImage::removeIntermediateArrays(bool removeOutput)
+{
+  AttributeMatrix::Pointer attrMat = getDataContainerArray()->getAttributeMatrix(getSelectedCellArrayPath());
+  if(nullptr == attrMat)
+  {
+    return;
+  }
+  for(const QString& name : m_IntermediateArrayNames)
+  {
+    attrMat->removeAttributeArray(name);
+  }
+  m_IntermediateArrayNames.clear();
+  if(removeOutput && !m_OutputArrayName.isEmpty())
+  {
+    attrMat->removeAttributeArray(m_OutputArrayName);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer ITKFusedPipelineImage::newFilterInstance(bool copyFilterParameters) const
+{
+  ITKFusedPipelineImage::Pointer filter = ITKFusedPipelineImage::New();
+  if(true == copyFilterParameters)
+  {
+    copyFilterParameterInstanceVariables(filter.get());
+  }
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString ITKFusedPipelineImage::getHumanLabel() const
+{
+  return "ITK::Fused Pipeline Image Filter";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QUuid ITKFusedPipelineImage::getUuid()
+{
+  return QUuid("{4c3b5f6e-21a8-5d0c-9e7b-8f2d61a4c930}");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString ITKFusedPipelineImage::getSubGroupName() const
+{
+  return "ITK Pipeline";
+}
@@ -0,0 +1,135 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Winconsistent-missing-override"
+#endif
+
+#include "ITKImageProcessingBase.h"
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+
+/**
+ * @brief The ITKFusedPipelineImage class. See [Filter documentation](@ref ITKFusedPipelineImage) for details.
+ */
+class ITKImageProcessing_EXPORT ITKFusedPipelineImage : public ITKImageProcessingBase
+{
+  Q_OBJECT
+  PYB11_CREATE_BINDINGS(ITKFusedPipelineImage SUPERCLASS ITKImageProcessingBase)
+  PYB11_PROPERTY(QString StageDescriptions READ getStageDescriptions WRITE setStageDescriptions)
+
+public:
+  SIMPL_SHARED_POINTERS(ITKFusedPipelineImage)
+  SIMPL_FILTER_NEW_MACRO(ITKFusedPipelineImage)
+  SIMPL_TYPE_MACRO_SUPER_OVERRIDE(ITKFusedPipelineImage, AbstractFilter)
+
+  ~ITKFusedPipelineImage() override;
+
+  using StageList = QVector<ITKImageProcessingBase::Pointer>;
+
+  /**
+   * @brief Ordered filters of the pipeline, as a JSON array of {"Filter": class name, "Parameters": {...}} objects.
+   * The parameters use the same JSON keys as in a pipeline file. Each stage reads the output of the previous one, so the
+   * SelectedCellArrayPath, SaveAsNewArray and NewCellArrayName of the stages are overwritten by this filter.
+   */
+  SIMPL_FILTER_PARAMETER(QString, StageDescriptions)
+  Q_PROPERTY(QString StageDescriptions READ getStageDescriptions WRITE setStageDescriptions)
+
+  /**
+   * @brief appendStage Adds the class name and the current parameters of @p stage at the end of StageDescriptions
+   */
+  void appendStage(const ITKImageProcessingBase::Pointer& stage);
+
+  /**
+   * @brief newFilterInstance Reimplemented from @see AbstractFilter class
+   */
+  AbstractFilter::Pointer newFilterInstance(bool copyFilterParameters) const override;
+
+  /**
+   * @brief getHumanLabel Reimplemented from @see AbstractFilter class
+   */
+  const QString getHumanLabel() const override;
+
+  /**
+   * @brief getSubGroupName Reimplemented from @see AbstractFilter class
+   */
+  const QString getSubGroupName() const override;
+
+  /**
+   * @brief getUuid Return the unique identifier for this filter.
+   * @return A QUuid object.
+   */
+  const QUuid getUuid() override;
+
+  /**
+   * @brief setupFilterParameters Reimplemented from @see AbstractFilter class
+   */
+  void setupFilterParameters() override;
+
+  /**
+   * @brief readFilterParameters Reimplemented from @see AbstractFilter class
+   */
+  void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
+
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class. The fused pipeline streams
+   * only if every one of its stages does. The stages are those built by the last check of the filter.
+   */
+  bool isStreamable() const override;
+
+  /**
+   * @brief canRunConcurrently Reimplemented from @see ITKImageBase class. The fused pipeline runs
+   * concurrently only if every one of its stages can, and not before it is checked.
+   */
+  bool canRunConcurrently() const override;
+
+protected:
+  ITKFusedPipelineImage();
+
+  /**
+   * @brief dataCheckInternal Preflights every stage in order. Each intermediate stage creates an array
+   * that is never allocated: it only carries the pixel type of that stage output to the next stage.
+   */
+  void dataCheckInternal() override;
+
+  /**
+   * @brief filterInternal Connects the ITK filters of all the stages and updates the last one
+   */
+  void filterInternal() override;
+
+  /**
+   * @brief removeIntermediateArrays Removes the arrays created by dataCheckInternal for the intermediate
+   * stages and, if @p removeOutput is true, the temporary output array.
+   */
+  void removeIntermediateArrays(bool removeOutput);
+
+  /**
+   * @brief createStages Creates a new filter for each entry of StageDescriptions and reads its parameters
+   * @param stages Filled with the created filters
+   * @param errorMessage Set to a description of the problem on failure
+   * @return 0 on success, a negative error code otherwise
+   */
+  int createStages(StageList& stages, QString& errorMessage) const;
+
+private:
+  StageList m_Stages;
+  QStringList m_IntermediateArrayNames;
+  QString m_OutputArrayName;
+
+public:
+  ITKFusedPipelineImage(const ITKFusedPipelineImage&) = delete;            // Copy Constructor Not Implemented
+  ITKFusedPipelineImage(ITKFusedPipelineImage&&) = delete;                 // Move Constructor Not Implemented
+  ITKFusedPipelineImage& operator=(const ITKFusedPipelineImage&) = delete; // Copy Assignment Not Implemented
+  ITKFusedPipelineImage& operator=(ITKFusedPipelineImage&&) = delete;      // Move Assignment Not Implemented
+};
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
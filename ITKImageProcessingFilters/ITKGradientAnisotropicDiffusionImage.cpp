@@ -10,6 +10,7 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -19,6 +20,10 @@
 #include "SIMPLib/ITK/Dream3DTemplateAliasMacro.h"
 #include "SIMPLib/ITK/itkDream3DImage.h"
 
+#include <itkGradientNDAnisotropicDiffusionFunction.h>
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkIterativeDiffusionImageFilter.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -52,6 +57,7 @@ void ITKGradientAnisotropicDiffusionImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKGradientAnisotropicDiffusionImage, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKGradientAnisotropicDiffusionImage));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -78,6 +84,7 @@ void ITKGradientAnisotropicDiffusionImage::readFilterParameters(AbstractFilterPa
   setConductanceScalingUpdateInterval(reader->readValue("ConductanceScalingUpdateInterval", getConductanceScalingUpdateInterval()));
   setNumberOfIterations(reader->readValue("NumberOfIterations", getNumberOfIterations()));
 
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
   reader->closeFilterGroup();
 }
 
@@ -109,6 +116,35 @@ void ITKGradientAnisotropicDiffusionImage::dataCheckInternal()
 // -----------------------------------------------------------------------------
 
 template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKGradientAnisotropicDiffusionImage::filter()
+{
+  // The ping-pong engine reads and writes scalar pixels directly
+  this->filter<InputPixelType, OutputPixelType, Dimension>(std::is_arithmetic<InputPixelType>());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKGradientAnisotropicDiffusionImage::filter(std::true_type)
+{
+  typedef typename itk::NumericTraits<InputPixelType>::RealType RealPixelType;
+  typedef itk::Image<RealPixelType, Dimension> RealImageType;
+  typedef itk::GradientNDAnisotropicDiffusionFunction<RealImageType> FunctionType;
+  typedef itk::IterativeDiffusionImageFilter<itk::Dream3DImage<InputPixelType, Dimension>, itk::Dream3DImage<OutputPixelType, Dimension>, FunctionType> FilterType;
+
+  typename FunctionType::Pointer function = FunctionType::New();
+  function->SetTimeStep(static_cast<double>(m_TimeStep));
+  function->SetConductanceParameter(static_cast<double>(m_ConductanceParameter));
+  typename FilterType::Pointer filter = FilterType::New();
+  filter->SetDifferenceFunction(function);
+  filter->SetNumberOfIterations(static_cast<uint32_t>(m_NumberOfIterations));
+  filter->SetConductanceScalingUpdateInterval(std::max(static_cast<unsigned int>(m_ConductanceScalingUpdateInterval), 1u));
+  this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKGradientAnisotropicDiffusionImage::filter(std::false_type)
 {
   typedef typename itk::NumericTraits<InputPixelType>::RealType FloatPixelType;
   typedef itk::Dream3DImage<FloatPixelType, Dimension> FloatImageType;
@@ -120,7 +156,6 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
   filter->SetConductanceScalingUpdateInterval(static_cast<unsigned int>(m_ConductanceScalingUpdateInterval));
   filter->SetNumberOfIterations(static_cast<uint32_t>(m_NumberOfIterations));
   this->ITKImageProcessingBase::filterCastToFloat<InputPixelType, OutputPixelType, Dimension, FilterType, FloatImageType>(filter);
-
 }
 
 // -----------------------------------------------------------------------------
@@ -21,6 +21,8 @@
 #include <algorithm>
 #include <itkGradientAnisotropicDiffusionImageFilter.h>
 
+#include <type_traits>
+
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
 
 /**
@@ -109,6 +111,16 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+  * @brief Runs the finite difference function of itk::GradientAnisotropicDiffusionImageFilter with itk::IterativeDiffusionImageFilter, to scalar pixels
+  */
+  template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter(std::true_type pingPong);
+
+  /**
+  * @brief Applies itk::GradientAnisotropicDiffusionImageFilter to the pixels cast to real ones, to the other pixel types
+  */
+  template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter(std::false_type pingPong);
+
 private:
   ITKGradientAnisotropicDiffusionImage(const ITKGradientAnisotropicDiffusionImage&) = delete;    // Copy Constructor Not Implemented
   ITKGradientAnisotropicDiffusionImage(ITKGradientAnisotropicDiffusionImage&&) = delete;         // Move Constructor Not Implemented
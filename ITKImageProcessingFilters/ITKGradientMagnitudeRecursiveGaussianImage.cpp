@@ -10,6 +10,7 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -19,6 +20,10 @@
 #include "SIMPLib/ITK/Dream3DTemplateAliasMacro.h"
 #include "SIMPLib/ITK/itkDream3DImage.h"
 
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKScaleSpace.h"
+
+#include <cmath>
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -48,6 +53,7 @@ void ITKGradientMagnitudeRecursiveGaussianImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKGradientMagnitudeRecursiveGaussianImage, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKGradientMagnitudeRecursiveGaussianImage));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -72,6 +78,7 @@ void ITKGradientMagnitudeRecursiveGaussianImage::readFilterParameters(AbstractFi
   setSigma(reader->readValue("Sigma", getSigma()));
   setNormalizeAcrossScale(reader->readValue("NormalizeAcrossScale", getNormalizeAcrossScale()));
 
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
   reader->closeFilterGroup();
 }
 
@@ -101,6 +108,55 @@ void ITKGradientMagnitudeRecursiveGaussianImage::dataCheckInternal()
 // -----------------------------------------------------------------------------
 
 template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKGradientMagnitudeRecursiveGaussianImage::filter()
+{
+  // The scale space cache holds images of scalar pixels
+  this->filter<InputPixelType, OutputPixelType, Dimension>(std::is_arithmetic<InputPixelType>());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKGradientMagnitudeRecursiveGaussianImage::filter(std::true_type)
+{
+  typedef ITKScaleSpace<InputPixelType, Dimension> ScaleSpaceType;
+  const double sigma = static_cast<double>(m_Sigma);
+  const bool normalizeAcrossScale = static_cast<bool>(m_NormalizeAcrossScale);
+  auto compute = [sigma, normalizeAcrossScale](ScaleSpaceType& scaleSpace) {
+    typename itk::Dream3DImage<OutputPixelType, Dimension>::Pointer output = scaleSpace.template createImage<OutputPixelType>();
+    OutputPixelType* magnitude = output->GetBufferPointer();
+    const size_t numberOfPixels = output->GetLargestPossibleRegion().GetNumberOfPixels();
+    std::fill(magnitude, magnitude + numberOfPixels, static_cast<OutputPixelType>(0));
+    for(unsigned int d = 0; d < Dimension; d++)
+    {
+      // The derivative along d shares the image smoothed along the other axes with the Laplacian and the Hessian
+      std::array<int, Dimension> orders;
+      orders.fill(0);
+      orders[d] = 1;
+      typename ScaleSpaceType::RealImageType::Pointer derivative = scaleSpace.get(ScaleSpaceType::Derivative(sigma, orders, normalizeAcrossScale));
+      const typename ScaleSpaceType::RealPixelType* values = derivative->GetBufferPointer();
+      const double spacing = output->GetSpacing()[d];
+      for(size_t i = 0; i < numberOfPixels; i++)
+      {
+        const double value = values[i] / spacing;
+        magnitude[i] += static_cast<OutputPixelType>(value * value);
+      }
+    }
+    for(size_t i = 0; i < numberOfPixels; i++)
+    {
+      magnitude[i] = static_cast<OutputPixelType>(std::sqrt(magnitude[i]));
+    }
+    return output;
+  };
+  if(!this->filterScaleSpace<InputPixelType, OutputPixelType, Dimension>(compute))
+  {
+    this->filter<InputPixelType, OutputPixelType, Dimension>(std::false_type());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKGradientMagnitudeRecursiveGaussianImage::filter(std::false_type)
 {
   typedef itk::Dream3DImage<InputPixelType, Dimension> InputImageType;
   typedef itk::Dream3DImage<OutputPixelType, Dimension> OutputImageType;
@@ -110,7 +166,6 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
   filter->SetSigma(static_cast<double>(m_Sigma));
   filter->SetNormalizeAcrossScale(static_cast<bool>(m_NormalizeAcrossScale));
   this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
-
 }
 
 // -----------------------------------------------------------------------------
@@ -21,6 +21,8 @@
 #include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
 #include <itkGradientMagnitudeRecursiveGaussianImageFilter.h>
 
+#include <type_traits>
+
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
 
 /**
@@ -101,6 +103,16 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+  * @brief Computes the magnitude from the first derivatives kept by the scale space cache, to scalar pixels
+  */
+  template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter(std::true_type scaleSpace);
+
+  /**
+  * @brief Applies itk::GradientMagnitudeRecursiveGaussianImageFilter, when the scale space cache cannot be used or to the other pixel types
+  */
+  template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter(std::false_type scaleSpace);
+
 private:
   ITKGradientMagnitudeRecursiveGaussianImage(const ITKGradientMagnitudeRecursiveGaussianImage&) = delete;    // Copy Constructor Not Implemented
   ITKGradientMagnitudeRecursiveGaussianImage(ITKGradientMagnitudeRecursiveGaussianImage&&) = delete;         // Move Constructor Not Implemented
@@ -4,9 +4,12 @@
 
 #include "ITKHistogramMatchingImage.h"
 
+#include <algorithm>
+
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -16,6 +19,8 @@
 #include "SIMPLib/ITK/Dream3DTemplateAliasMacro.h"
 #include "SIMPLib/ITK/itkDream3DImage.h"
 
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkHistogramMatchingModelImageFilter.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -24,6 +29,10 @@ ITKHistogramMatchingImage::ITKHistogramMatchingImage()
   m_NumberOfHistogramLevels = StaticCastScalar<double, double, double>(256u);
   m_NumberOfMatchPoints = StaticCastScalar<double, double, double>(1u);
   m_ThresholdAtMeanIntensity = StaticCastScalar<bool, bool, bool>(true);
+  m_UseReferenceModel = false;
+  m_SaveReferenceModel = false;
+  m_ReferenceModelAttributeMatrixName = "HistogramMatchingModel";
+  m_ReferenceModelArrayName = "ReferenceModel";
 
 }
 
@@ -42,10 +51,18 @@ void ITKHistogramMatchingImage::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("NumberOfHistogramLevels", NumberOfHistogramLevels, FilterParameter::Parameter, ITKHistogramMatchingImage));
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("NumberOfMatchPoints", NumberOfMatchPoints, FilterParameter::Parameter, ITKHistogramMatchingImage));
   parameters.push_back(SIMPL_NEW_BOOL_FP("ThresholdAtMeanIntensity", ThresholdAtMeanIntensity, FilterParameter::Parameter, ITKHistogramMatchingImage));
+  QStringList modelProps;
+  modelProps << "ReferenceModelArrayPath";
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Use Reference Model", UseReferenceModel, FilterParameter::Parameter, ITKHistogramMatchingImage, modelProps));
+  QStringList saveModelProps;
+  saveModelProps << "ReferenceModelAttributeMatrixName"
+                 << "ReferenceModelArrayName";
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save Reference Model", SaveReferenceModel, FilterParameter::Parameter, ITKHistogramMatchingImage, saveModelProps));
 
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKHistogramMatchingImage, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKHistogramMatchingImage));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req = DataArraySelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, SIMPL::Defaults::AnyComponentSize,
@@ -55,8 +72,15 @@ void ITKHistogramMatchingImage::setupFilterParameters()
     // Reference image
     parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Reference Attribute Array to filter", ReferenceCellArrayPath, FilterParameter::RequiredArray, ITKHistogramMatchingImage, req));
   }
+  {
+    DataArraySelectionFilterParameter::RequirementType req =
+        DataArraySelectionFilterParameter::CreateRequirement(SIMPL::TypeNames::Double, SIMPL::Defaults::AnyComponentSize, AttributeMatrix::Type::Generic, IGeometry::Type::Any);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Reference Model", ReferenceModelArrayPath, FilterParameter::RequiredArray, ITKHistogramMatchingImage, req));
+  }
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::CreatedArray, ITKHistogramMatchingImage));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Reference Model Attribute Matrix", ReferenceModelAttributeMatrixName, FilterParameter::CreatedArray, ITKHistogramMatchingImage));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Reference Model Array", ReferenceModelArrayName, FilterParameter::CreatedArray, ITKHistogramMatchingImage));
 
   setFilterParameters(parameters);
 }
@@ -74,7 +98,13 @@ void ITKHistogramMatchingImage::readFilterParameters(AbstractFilterParametersRea
   setNumberOfHistogramLevels(reader->readValue("NumberOfHistogramLevels", getNumberOfHistogramLevels()));
   setNumberOfMatchPoints(reader->readValue("NumberOfMatchPoints", getNumberOfMatchPoints()));
   setThresholdAtMeanIntensity(reader->readValue("ThresholdAtMeanIntensity", getThresholdAtMeanIntensity()));
+  setUseReferenceModel(reader->readValue("UseReferenceModel", getUseReferenceModel()));
+  setReferenceModelArrayPath(reader->readDataArrayPath("ReferenceModelArrayPath", getReferenceModelArrayPath()));
+  setSaveReferenceModel(reader->readValue("SaveReferenceModel", getSaveReferenceModel()));
+  setReferenceModelAttributeMatrixName(reader->readString("ReferenceModelAttributeMatrixName", getReferenceModelAttributeMatrixName()));
+  setReferenceModelArrayName(reader->readString("ReferenceModelArrayName", getReferenceModelArrayName()));
 
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
   reader->closeFilterGroup();
 }
 
@@ -194,8 +224,56 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
   this->CheckIntegerEntry<uint32_t, double>(m_NumberOfHistogramLevels, "NumberOfHistogramLevels", 1);
   this->CheckIntegerEntry<uint32_t, double>(m_NumberOfMatchPoints, "NumberOfMatchPoints", 1);
 
-  // Compare source and reference image type
-  CompareImageTypes(getSelectedCellArrayPath(), getReferenceCellArrayPath());
+  if(m_UseReferenceModel && m_SaveReferenceModel)
+  {
+    setErrorCondition(-55631);
+    notifyErrorMessage(getHumanLabel(), "A reference model cannot be used and saved by the same filter", getErrorCondition());
+    return;
+  }
+
+  // The model holds its header, the minimum of the reference and the intensities matched: threshold, quantiles and maximum
+  typedef itk::HistogramMatchingModelImageFilter<itk::Dream3DImage<InputPixelType, Dimension>, itk::Dream3DImage<OutputPixelType, Dimension>> ModelFilterType;
+  QVector<size_t> modelDims(1, static_cast<size_t>(ModelFilterType::GetModelSize(static_cast<uint32_t>(m_NumberOfMatchPoints))));
+  if(m_UseReferenceModel)
+  {
+    if(CheckArrayExists(getSelectedCellArrayPath()))
+    {
+      return;
+    }
+    DoubleArrayType::Pointer modelArray = getDataContainerArray()->getPrereqArrayFromPath<DoubleArrayType, AbstractFilter>(this, getReferenceModelArrayPath(), modelDims);
+    if(getErrorCondition() < 0)
+    {
+      return;
+    }
+    // The values of the model are only known once the filter that saves it has executed
+    if(modelArray->isAllocated() && modelArray->getNumberOfTuples() > 0)
+    {
+      const std::string mismatch = ModelFilterType::CheckModel(modelArray->getPointer(0), modelArray->getNumberOfComponents(), static_cast<uint32_t>(m_NumberOfHistogramLevels),
+                                                               static_cast<uint32_t>(m_NumberOfMatchPoints), static_cast<bool>(m_ThresholdAtMeanIntensity));
+      if(!mismatch.empty())
+      {
+        setErrorCondition(-55632);
+        notifyErrorMessage(getHumanLabel(), QString::fromStdString(mismatch), getErrorCondition());
+        return;
+      }
+    }
+  }
+  else
+  {
+    // Compare source and reference image type
+    CompareImageTypes(getSelectedCellArrayPath(), getReferenceCellArrayPath());
+    if(m_SaveReferenceModel && getErrorCondition() >= 0)
+    {
+      DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getReferenceCellArrayPath().getDataContainerName());
+      DataArrayPath dap(getReferenceCellArrayPath().getDataContainerName(), getReferenceModelAttributeMatrixName(), QString(""));
+      AttributeMatrix::Pointer am = dc->createNonPrereqAttributeMatrix(this, dap, QVector<size_t>(1, 1), AttributeMatrix::Type::Generic);
+      if(getErrorCondition() < 0 || nullptr == am)
+      {
+        return;
+      }
+      am->createNonPrereqArray<DoubleArrayType>(this, getReferenceModelArrayName(), 0.0, modelDims);
+    }
+  }
   ITKImageProcessingBase::dataCheck<InputPixelType, OutputPixelType, Dimension>();
 }
 
@@ -213,6 +291,11 @@ void ITKHistogramMatchingImage::dataCheckInternal()
 
 template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKHistogramMatchingImage::filter()
 {
+  if(m_UseReferenceModel)
+  {
+    filterWithModel<InputPixelType, OutputPixelType, Dimension>();
+    return;
+  }
   typedef itk::Dream3DImage<InputPixelType, Dimension> InputImageType;
   typedef itk::Dream3DImage<OutputPixelType, Dimension> OutputImageType;
   // define filter
@@ -233,10 +316,57 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
   toITK->SetAttributeMatrixArrayName(getReferenceCellArrayPath().getAttributeMatrixName().toStdString());
   toITK->SetDataArrayName(getReferenceCellArrayPath().getDataArrayName().toStdString());
   filter->SetReferenceImage(toITK->GetOutput());
+  if(m_SaveReferenceModel)
+  {
+    typedef itk::HistogramMatchingModelImageFilter<InputImageType, OutputImageType> ModelFilterType;
+    try
+    {
+      toITK->Update();
+      const typename ModelFilterType::ModelType model = ModelFilterType::ComputeModel(toITK->GetOutput(), static_cast<uint32_t>(m_NumberOfHistogramLevels), static_cast<uint32_t>(m_NumberOfMatchPoints),
+                                                                                     static_cast<bool>(m_ThresholdAtMeanIntensity));
+      DataArrayPath modelPath(getReferenceCellArrayPath().getDataContainerName(), getReferenceModelAttributeMatrixName(), getReferenceModelArrayName());
+      DoubleArrayType::Pointer modelArray = getDataContainerArray()->getPrereqArrayFromPath<DoubleArrayType, AbstractFilter>(this, modelPath, QVector<size_t>(1, model.size()));
+      if(nullptr == modelArray)
+      {
+        return;
+      }
+      std::copy(model.begin(), model.end(), modelArray->getPointer(0));
+    } catch(itk::ExceptionObject& err)
+    {
+      setErrorCondition(-55630);
+      QString errorMessage = "ITK exception was thrown while computing the reference model: %1";
+      notifyErrorMessage(getHumanLabel(), errorMessage.arg(err.GetDescription()), getErrorCondition());
+      return;
+    }
+  }
   // Run filter
   this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKHistogramMatchingImage::filterWithModel()
+{
+  typedef itk::Dream3DImage<InputPixelType, Dimension> InputImageType;
+  typedef itk::Dream3DImage<OutputPixelType, Dimension> OutputImageType;
+  typedef itk::HistogramMatchingModelImageFilter<InputImageType, OutputImageType> FilterType;
+  QVector<size_t> modelDims(1, static_cast<size_t>(FilterType::GetModelSize(static_cast<uint32_t>(m_NumberOfMatchPoints))));
+  DoubleArrayType::Pointer modelArray = getDataContainerArray()->getPrereqArrayFromPath<DoubleArrayType, AbstractFilter>(this, getReferenceModelArrayPath(), modelDims);
+  if(nullptr == modelArray)
+  {
+    return;
+  }
+  // The first tuple of the array is the model
+  const double* model = modelArray->getPointer(0);
+  typename FilterType::Pointer filter = FilterType::New();
+  filter->SetNumberOfHistogramLevels(static_cast<uint32_t>(m_NumberOfHistogramLevels));
+  filter->SetNumberOfMatchPoints(static_cast<uint32_t>(m_NumberOfMatchPoints));
+  filter->SetThresholdAtMeanIntensity(static_cast<bool>(m_ThresholdAtMeanIntensity));
+  filter->SetReferenceModel(typename FilterType::ModelType(model, model + modelArray->getNumberOfComponents()));
+  this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -266,6 +396,15 @@ const QString ITKHistogramMatchingImage::getHumanLabel() const
   return "ITK::Histogram Matching Image Filter";
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKHistogramMatchingImage::canRunConcurrently() const
+{
+  // The reference array is wrapped by the filter itself, outside of the locked helpers of ITKImageBase
+  return false;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
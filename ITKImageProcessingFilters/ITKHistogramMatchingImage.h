@@ -32,6 +32,11 @@ class ITKImageProcessing_EXPORT ITKHistogramMatchingImage : public ITKImageProce
   PYB11_PROPERTY(double NumberOfHistogramLevels READ getNumberOfHistogramLevels WRITE setNumberOfHistogramLevels)
   PYB11_PROPERTY(double NumberOfMatchPoints READ getNumberOfMatchPoints WRITE setNumberOfMatchPoints)
   PYB11_PROPERTY(bool ThresholdAtMeanIntensity READ getThresholdAtMeanIntensity WRITE setThresholdAtMeanIntensity)
+  PYB11_PROPERTY(bool UseReferenceModel READ getUseReferenceModel WRITE setUseReferenceModel)
+  PYB11_PROPERTY(DataArrayPath ReferenceModelArrayPath READ getReferenceModelArrayPath WRITE setReferenceModelArrayPath)
+  PYB11_PROPERTY(bool SaveReferenceModel READ getSaveReferenceModel WRITE setSaveReferenceModel)
+  PYB11_PROPERTY(QString ReferenceModelAttributeMatrixName READ getReferenceModelAttributeMatrixName WRITE setReferenceModelAttributeMatrixName)
+  PYB11_PROPERTY(QString ReferenceModelArrayName READ getReferenceModelArrayName WRITE setReferenceModelArrayName)
 
 public:
   SIMPL_SHARED_POINTERS(ITKHistogramMatchingImage)
@@ -52,6 +57,29 @@ public:
   SIMPL_FILTER_PARAMETER(bool, ThresholdAtMeanIntensity)
   Q_PROPERTY(bool ThresholdAtMeanIntensity READ getThresholdAtMeanIntensity WRITE setThresholdAtMeanIntensity)
 
+  /**
+   * @brief UseReferenceModel Matches the input to the model stored at ReferenceModelArrayPath instead of the
+   * array at ReferenceCellArrayPath
+   */
+  SIMPL_FILTER_PARAMETER(bool, UseReferenceModel)
+  Q_PROPERTY(bool UseReferenceModel READ getUseReferenceModel WRITE setUseReferenceModel)
+
+  SIMPL_FILTER_PARAMETER(DataArrayPath, ReferenceModelArrayPath)
+  Q_PROPERTY(DataArrayPath ReferenceModelArrayPath READ getReferenceModelArrayPath WRITE setReferenceModelArrayPath)
+
+  /**
+   * @brief SaveReferenceModel Stores the model of the reference array in a new attribute matrix of its data
+   * container, to match other arrays without reading the reference again
+   */
+  SIMPL_FILTER_PARAMETER(bool, SaveReferenceModel)
+  Q_PROPERTY(bool SaveReferenceModel READ getSaveReferenceModel WRITE setSaveReferenceModel)
+
+  SIMPL_FILTER_PARAMETER(QString, ReferenceModelAttributeMatrixName)
+  Q_PROPERTY(QString ReferenceModelAttributeMatrixName READ getReferenceModelAttributeMatrixName WRITE setReferenceModelAttributeMatrixName)
+
+  SIMPL_FILTER_PARAMETER(QString, ReferenceModelArrayName)
+  Q_PROPERTY(QString ReferenceModelArrayName READ getReferenceModelArrayName WRITE setReferenceModelArrayName)
+
   /**
    * @brief newFilterInstance Reimplemented from @see AbstractFilter class
    */
@@ -83,6 +111,11 @@ public:
    */
   void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
 
+  /**
+   * @brief canRunConcurrently Reimplemented from @see ITKImageBase class
+   */
+  bool canRunConcurrently() const override;
+
 protected:
   ITKHistogramMatchingImage();
 
@@ -106,6 +139,11 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief filterWithModel Matches the input to the reference model
+   */
+  template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void filterWithModel();
+
   /**
    * @brief getImageDimension Returns the dimension of an image.
    */
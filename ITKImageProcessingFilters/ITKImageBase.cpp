@@ -8,6 +8,11 @@
 //
 // -----------------------------------------------------------------------------
 ITKImageBase::ITKImageBase()
+: m_StreamedExecution(false)
+, m_SlabSize(32)
+, m_NumberOfThreads(0)
+, m_DeferPipelineUpdate(false)
+, m_PerformanceInvocation(0)
 {
   initialize();
 }
@@ -17,6 +22,116 @@ ITKImageBase::ITKImageBase()
 // -----------------------------------------------------------------------------
 ITKImageBase::~ITKImageBase() = default;
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKImageBase::isStreamable() const
+{
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKImageBase::canRunConcurrently() const
+{
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageBase::executePipelineStage(itk::DataObject* input, bool deferUpdate)
+{
+  releasePipelineStage();
+  startPerformanceRecords();
+  m_PipelineInput = input;
+  m_DeferPipelineUpdate = deferUpdate;
+  this->filterInternal();
+  m_PipelineInput = nullptr;
+  m_DeferPipelineUpdate = false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKImageBase::isPipelineStage() const
+{
+  return nullptr != m_PipelineInput || m_DeferPipelineUpdate;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+itk::DataObject* ITKImageBase::getPipelineOutput() const
+{
+  return m_PipelineOutput.GetPointer();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+itk::ProcessObject* ITKImageBase::getPipelineFilter() const
+{
+  return m_PipelineFilter.GetPointer();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageBase::releasePipelineStage()
+{
+  m_PipelineOutput = nullptr;
+  m_PipelineFilter = nullptr;
+  m_PipelineSource = nullptr;
+  m_PipelineKeepAlive.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageBase::deferPipelineUpdate(itk::ProcessObject* filter)
+{
+  filter->ReleaseDataFlagOn();
+  m_PipelineFilter = filter;
+  m_PipelineOutput = filter->GetOutput(0);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const std::vector<ITKPerformanceMonitor::PhaseRecord>& ITKImageBase::getPerformanceRecords() const
+{
+  return m_PerformanceRecords;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<ITKPerformanceMonitor::PhaseRecord>* ITKImageBase::performanceRecords()
+{
+  return ITKPerformanceMonitor::IsEnabled() ? &m_PerformanceRecords : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageBase::startPerformanceRecords()
+{
+  m_PerformanceRecords.clear();
+  m_PerformanceInvocation = ITKPerformanceMonitor::IsEnabled() ? ITKPerformanceMonitor::Instance().nextInvocation() : 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const void* ITKImageBase::inputBuffer(DataContainer::Pointer dc, const DataArrayPath& selectedArray) const
+{
+  AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix(selectedArray.getAttributeMatrixName());
+  IDataArray::Pointer inputArray = (nullptr != attrMat) ? attrMat->getAttributeArray(selectedArray.getDataArrayName()) : IDataArray::NullPointer();
+  return (nullptr != inputArray && inputArray->isAllocated()) ? inputArray->getVoidPointer(0) : nullptr;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -32,7 +147,10 @@ void ITKImageBase::initialize()
 // -----------------------------------------------------------------------------
 void ITKImageBase::execute()
 {
+  // The data structure is only released while the pixels are processed
+  ITKDataStructureLock lock;
   initialize();
+  startPerformanceRecords();
   this->dataCheckInternal();
   if(getErrorCondition() < 0)
   {
@@ -54,7 +172,10 @@ void ITKImageBase::preflight()
   setInPreflight(true);              // Set the fact that we are preflighting.
   emit preflightAboutToExecute();    // Emit this signal so that other widgets can do one file update
   emit updateFilterParameters(this); // Emit this signal to have the widgets push their values down to the filter
-  this->dataCheckInternal();
+  {
+    ITKDataStructureLock lock;
+    this->dataCheckInternal();
+  }
   emit preflightExecuted(); // We are done preflighting this filter
   setInPreflight(false);    // Inform the system this filter is NOT in preflight mode anymore.
 }
@@ -15,9 +15,17 @@
 
 #include "itkImageToImageFilter.h"
 #include <itkCastImageFilter.h>
+#include <itkImageRegionConstIterator.h>
 #include <itkNumericTraits.h>
 
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKDataStructureLock.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKPerformanceMonitor.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKThreadingPolicy.h"
 
 /**
  * @brief The ITKImageBase class. See [Filter documentation](@ref ITKImageBase) for details.
@@ -26,6 +34,9 @@ class ITKImageProcessing_EXPORT ITKImageBase : public AbstractFilter
 {
   Q_OBJECT
   PYB11_CREATE_BINDINGS(ITKImageBase SUPERCLASS AbstractFilter)
+  PYB11_PROPERTY(bool StreamedExecution READ getStreamedExecution WRITE setStreamedExecution)
+  PYB11_PROPERTY(int SlabSize READ getSlabSize WRITE setSlabSize)
+  PYB11_PROPERTY(int NumberOfThreads READ getNumberOfThreads WRITE setNumberOfThreads)
 
 public:
   SIMPL_SHARED_POINTERS(ITKImageBase)
@@ -34,6 +45,64 @@ public:
 
   ~ITKImageBase() override;
 
+  SIMPL_FILTER_PARAMETER(bool, StreamedExecution)
+  Q_PROPERTY(bool StreamedExecution READ getStreamedExecution WRITE setStreamedExecution)
+
+  SIMPL_FILTER_PARAMETER(int, SlabSize)
+  Q_PROPERTY(int SlabSize READ getSlabSize WRITE setSlabSize)
+
+  /**
+   * @brief NumberOfThreads Number of threads of the ITK filter, 0 to use the whole thread budget of the
+   * plugin. See ITKThreadingPolicy.
+   */
+  SIMPL_FILTER_PARAMETER(int, NumberOfThreads)
+  Q_PROPERTY(int NumberOfThreads READ getNumberOfThreads WRITE setNumberOfThreads)
+
+  /**
+   * @brief isStreamable Returns true if the ITK filter produces the same output when it is
+   * run slab by slab over the slowest image dimension. Filters that need the whole image at once
+   * (global statistics, labeling, iterative solvers...) keep the default and ignore StreamedExecution.
+   */
+  virtual bool isStreamable() const;
+
+  /**
+   * @brief canRunConcurrently Returns true if the filter may run at the same time as other ITK filters working
+   * on other arrays of the same DataContainerArray, i.e. if it only touches the data structure through the
+   * helpers of this class. Filters that wrap or create other arrays by themselves return false and are run
+   * alone by ITKFilterScheduler.
+   */
+  virtual bool canRunConcurrently() const;
+
+  /**
+   * @brief executePipelineStage Runs this filter as one stage of a fused ITK pipeline. dataCheck must have
+   * been run already. The ITK filter reads @p input (or the selected array when @p input is null) and, when
+   * @p deferUpdate is true, is only connected: its output is published by getPipelineOutput() and nothing
+   * is written back to the DataContainerArray. The last stage is run with @p deferUpdate set to false,
+   * which updates the whole chain at once.
+   */
+  void executePipelineStage(itk::DataObject* input, bool deferUpdate);
+
+  /**
+   * @brief getPipelineOutput Returns the output of the ITK filter connected by executePipelineStage()
+   */
+  itk::DataObject* getPipelineOutput() const;
+
+  /**
+   * @brief getPipelineFilter Returns the ITK filter connected by executePipelineStage()
+   */
+  itk::ProcessObject* getPipelineFilter() const;
+
+  /**
+   * @brief releasePipelineStage Drops every ITK object kept alive by executePipelineStage()
+   */
+  void releasePipelineStage();
+
+  /**
+   * @brief getPerformanceRecords Returns the measures of the phases of the last execution of the filter
+   * (or of its last fused pipeline stage). Phases are only measured while ITKPerformanceMonitor is enabled.
+   */
+  const std::vector<ITKPerformanceMonitor::PhaseRecord>& getPerformanceRecords() const;
+
   /**
    * @brief execute Reimplemented from @see AbstractFilter class
    */
@@ -163,52 +232,192 @@ protected:
   template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename FilterType>
   void filter(FilterType* filter, const std::string& outputArrayName, bool saveAsNewArray, const DataArrayPath& selectedArray)
   {
+    if(getStreamedExecution() && !m_DeferPipelineUpdate)
+    {
+      if(isStreamable())
+      {
+        filterStreamed<InputPixelType, OutputPixelType, Dimension, FilterType>(filter, outputArrayName, saveAsNewArray, selectedArray);
+        return;
+      }
+      notifyStatusMessage(getHumanLabel(), "Filter does not support streamed execution. Processing the whole image at once");
+    }
     try
     {
       DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(selectedArray.getDataContainerName());
 
       using OutputImageType = itk::Dream3DImage<OutputPixelType, Dimension>;
-      using toITKType = itk::InPlaceDream3DDataToImageFilter<InputPixelType, Dimension>;
-      // Create a Bridge to wrap an existing DREAM.3D array with an ItkImage container
-      typename toITKType::Pointer toITK = toITKType::New();
-      toITK->SetInput(dc);
-      toITK->SetInPlace(true);
-      toITK->SetAttributeMatrixArrayName(selectedArray.getAttributeMatrixName().toStdString());
-      toITK->SetDataArrayName(selectedArray.getDataArrayName().toStdString());
 
       itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New();
       interruption->SetFilter(this);
 
       // Set up filter
-      filter->SetInput(toITK->GetOutput());
+      {
+        ITKPerformanceMonitor::Phase phase(performanceRecords(), this, "WrapInput", m_PerformanceInvocation);
+        if(!connectInput<InputPixelType, Dimension>(filter, dc, selectedArray))
+        {
+          return;
+        }
+      }
+      // The input may be overwritten when it is the array being replaced or an intermediate image of a
+      // fused pipeline. ITK only runs in place if the filter supports it and input and output types match.
+      if(!saveAsNewArray || nullptr != m_PipelineInput)
+      {
+        enableInPlace(filter, 0);
+      }
+      ITKThreadingPolicy::Instance().apply(filter, getNumberOfThreads());
       filter->AddObserver(itk::ProgressEvent(), interruption);
-      filter->Update();
+      if(m_DeferPipelineUpdate)
+      {
+        deferPipelineUpdate(filter);
+        return;
+      }
+      {
+        ITKPerformanceMonitor::Phase phase(performanceRecords(), this, "Update", m_PerformanceInvocation);
+        {
+          // Other filters may use the data structure while the pixels are processed
+          ITKThreadingPolicy::AffinityScope affinity;
+          ITKDataStructureLock::Release release;
+          filter->Update();
+        }
+        if(nullptr != performanceRecords())
+        {
+          std::vector<const void*> buffers(1, inputBuffer(dc, selectedArray));
+          phase.setAllocatedBytes(allocatedBytes(filter->GetOutput(), buffers));
+        }
+      }
+      m_PipelineSource = nullptr;
 
-      typename OutputImageType::Pointer image = OutputImageType::New();
-      image = filter->GetOutput();
+      typename OutputImageType::Pointer image = filter->GetOutput();
       image->DisconnectPipeline();
+      writeOutputImage<OutputPixelType, Dimension>(image, dc, outputArrayName, saveAsNewArray, selectedArray);
+    } catch(itk::ExceptionObject& err)
+    { 
+      if(!getCancel())
+      {
+        setErrorCondition(-55555);
+        QString errorMessage = "ITK exception was thrown while filtering input image: %1";
+        notifyErrorMessage(getHumanLabel(), errorMessage.arg(err.GetDescription()), getErrorCondition());
+      }
+      return;
+    }
+
+    notifyStatusMessage(getHumanLabel(), "Complete");
+  }
+
+  /**
+  * @brief Applies the filter one slab of the slowest image dimension at a time. The output array is
+  * allocated up front and each slab is copied straight into it, so only one slab of the ITK output
+  * (and of any ITK intermediate) is resident at once. The input requested region of each slab is padded
+  * by the filter itself (GenerateInputRequestedRegion), which is why only streamable filters may use this.
+  */
+  template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename FilterType>
+  void filterStreamed(FilterType* filter, const std::string& outputArrayName, bool saveAsNewArray, const DataArrayPath& selectedArray)
+  {
+    using OutputValueType = typename itk::NumericTraits<OutputPixelType>::ValueType;
+    using OutputImageType = itk::Dream3DImage<OutputPixelType, Dimension>;
+    using RegionType = typename OutputImageType::RegionType;
+    try
+    {
+      DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(selectedArray.getDataContainerName());
+      AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix(selectedArray.getAttributeMatrixName());
+
+      itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New();
+      interruption->SetFilter(this);
+
+      // Set up filter
+      {
+        ITKPerformanceMonitor::Phase phase(performanceRecords(), this, "WrapInput", m_PerformanceInvocation);
+        if(!connectInput<InputPixelType, Dimension>(filter, dc, selectedArray))
+        {
+          return;
+        }
+      }
+      ITKThreadingPolicy::Instance().apply(filter, getNumberOfThreads());
+      filter->AddObserver(itk::ProgressEvent(), interruption);
+      ITKThreadingPolicy::AffinityScope affinity;
+      filter->UpdateOutputInformation();
+
+      OutputImageType* output = filter->GetOutput();
+      const RegionType largestRegion = output->GetLargestPossibleRegion();
+      const unsigned int slabDimension = Dimension - 1;
+      const itk::SizeValueType numberOfSlices = largestRegion.GetSize(slabDimension);
+      const itk::SizeValueType slabSize = std::min<itk::SizeValueType>(std::max(getSlabSize(), 1), numberOfSlices);
+      const size_t pixelsPerSlice = largestRegion.GetNumberOfPixels() / numberOfSlices;
+
+      // A new array was already created by dataCheck(). When replacing the input array, the input must stay
+      // intact until the last slab is done since each slab reads a padded neighborhood of it.
+      typename DataArray<OutputValueType>::Pointer outputArray;
+      if(saveAsNewArray)
+      {
+        outputArray = std::dynamic_pointer_cast<DataArray<OutputValueType>>(attrMat->getAttributeArray(QString::fromStdString(outputArrayName)));
+      }
+      // Arrays created by a fused pipeline preflight are not allocated
+      const bool createOutputArray = (nullptr == outputArray || !outputArray->isAllocated());
+      if(createOutputArray)
+      {
+        ITKPerformanceMonitor::Phase phase(performanceRecords(), this, "AllocateOutput", m_PerformanceInvocation);
+        QVector<size_t> cDims = ITKDream3DHelper::GetComponentsDimensions<OutputPixelType>();
+        outputArray = DataArray<OutputValueType>::CreateArray(attrMat->getNumberOfTuples(), cDims, QString::fromStdString(outputArrayName), true);
+        phase.setAllocatedBytes(static_cast<qint64>(outputArray->getSize() * sizeof(OutputValueType)));
+      }
+      OutputPixelType* outputBuffer = reinterpret_cast<OutputPixelType*>(outputArray->getPointer(0));
+
+      {
+        ITKPerformanceMonitor::Phase phase(performanceRecords(), this, "Update", m_PerformanceInvocation);
+        // Other filters may use the data structure while the slabs are processed
+        ITKDataStructureLock::Release release;
+        for(itk::SizeValueType slice = 0; slice < numberOfSlices; slice += slabSize)
+        {
+          if(getCancel())
+          {
+            return;
+          }
+          RegionType slab = largestRegion;
+          slab.SetIndex(slabDimension, largestRegion.GetIndex(slabDimension) + static_cast<itk::IndexValueType>(slice));
+          slab.SetSize(slabDimension, std::min(slabSize, numberOfSlices - slice));
+
+          output->SetRequestedRegion(slab);
+          output->PropagateRequestedRegion();
+          output->UpdateOutputData();
+
+          OutputPixelType* destination = outputBuffer + slice * pixelsPerSlice;
+          if(output->GetBufferedRegion() == slab)
+          {
+            ::memcpy(destination, output->GetBufferPointer(), slab.GetNumberOfPixels() * sizeof(OutputPixelType));
+          }
+          else
+          {
+            // Some filters enlarge their output requested region; only keep the pixels of the slab
+            itk::ImageRegionConstIterator<OutputImageType> it(output, slab);
+            for(it.GoToBegin(); !it.IsAtEnd(); ++it, ++destination)
+            {
+              *destination = it.Get();
+            }
+          }
+          QString ss = QObject::tr("Processed slices %1 to %2 of %3").arg(slice).arg(slice + slab.GetSize(slabDimension) - 1).arg(numberOfSlices);
+          notifyStatusMessage(getHumanLabel(), ss);
+        }
+      }
+      output->ReleaseData();
+      m_PipelineSource = nullptr;
 
       if(!saveAsNewArray)
       {
-        AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix(selectedArray.getAttributeMatrixName());
-        // Remove the original input data array
+        // Remove the original input data array and put the streamed output in its place
+        ITKPerformanceMonitor::Phase phase(performanceRecords(), this, "RemoveInput", m_PerformanceInvocation);
         attrMat->removeAttributeArray(selectedArray.getDataArrayName());
       }
-
-      using toDream3DType = itk::InPlaceImageToDream3DDataFilter<OutputPixelType, Dimension>;
-      typename toDream3DType::Pointer toDream3DFilter = toDream3DType::New();
-      toDream3DFilter->SetInput(image);
-      toDream3DFilter->SetInPlace(true);
-      toDream3DFilter->SetAttributeMatrixArrayName(selectedArray.getAttributeMatrixName().toStdString());
-      toDream3DFilter->SetDataArrayName(outputArrayName);
-      toDream3DFilter->SetDataContainer(dc);
-      toDream3DFilter->Update();
+      if(createOutputArray)
+      {
+        ITKPerformanceMonitor::Phase phase(performanceRecords(), this, "WrapOutput", m_PerformanceInvocation);
+        attrMat->addAttributeArray(outputArray->getName(), outputArray);
+      }
     } catch(itk::ExceptionObject& err)
-    { 
+    {
       if(!getCancel())
       {
-        setErrorCondition(-55555);
-        QString errorMessage = "ITK exception was thrown while filtering input image: %1";
+        setErrorCondition(-55557);
+        QString errorMessage = "ITK exception was thrown while streaming input image: %1";
         notifyErrorMessage(getHumanLabel(), errorMessage.arg(err.GetDescription()), getErrorCondition());
       }
       return;
@@ -224,25 +433,27 @@ protected:
   template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename FilterType, typename FloatImageType>
   void filterCastToFloat(FilterType* filter, const std::string& outputArrayName, bool saveAsNewArray, const DataArrayPath& selectedArray)
   {
+    if(getStreamedExecution() && !m_DeferPipelineUpdate)
+    {
+      notifyStatusMessage(getHumanLabel(), "Filter does not support streamed execution. Processing the whole image at once");
+    }
     try
     {
       DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(selectedArray.getDataContainerName());
 
-      using toITKType = itk::InPlaceDream3DDataToImageFilter<InputPixelType, Dimension>;
-      // Create a Bridge to wrap an existing DREAM.3D array with an ItkImage container
-      typename toITKType::Pointer toITK = toITKType::New();
-      toITK->SetInput(dc);
-      toITK->SetInPlace(true);
-      toITK->SetAttributeMatrixArrayName(selectedArray.getAttributeMatrixName().toStdString());
-      toITK->SetDataArrayName(selectedArray.getDataArrayName().toStdString());
-
       itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New();
       interruption->SetFilter(this);
 
-      using InputImageType = typename toITKType::ImageType;
+      using InputImageType = itk::Dream3DImage<InputPixelType, Dimension>;
       using CasterToType = itk::CastImageFilter<InputImageType, FloatImageType>;
       typename CasterToType::Pointer casterTo = CasterToType::New();
-      casterTo->SetInput(toITK->GetOutput());
+      {
+        ITKPerformanceMonitor::Phase phase(performanceRecords(), this, "WrapInput", m_PerformanceInvocation);
+        if(!connectInput<InputPixelType, Dimension>(casterTo.GetPointer(), dc, selectedArray))
+        {
+          return;
+        }
+      }
 
       // Set up filter
       filter->SetInput(casterTo->GetOutput());
@@ -252,27 +463,45 @@ protected:
       using CasterFromType = itk::CastImageFilter<FloatImageType, OutputImageType>;
       typename CasterFromType::Pointer casterFrom = CasterFromType::New();
       casterFrom->SetInput(filter->GetOutput());
-      casterFrom->Update();
-
-      typename OutputImageType::Pointer image = OutputImageType::New();
-      image = casterFrom->GetOutput();
-      image->DisconnectPipeline();
-
-      if(!saveAsNewArray)
+      // The float images are owned by ITK and can always be reused. Casting to the same type is then a no-op.
+      if(!saveAsNewArray || nullptr != m_PipelineInput)
       {
-        AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix(selectedArray.getAttributeMatrixName());
-        // Remove the original input data array
-        attrMat->removeAttributeArray(selectedArray.getDataArrayName());
+        enableInPlace(casterTo.GetPointer(), 0);
+      }
+      enableInPlace(filter, 0);
+      enableInPlace(casterFrom.GetPointer(), 0);
+      const ITKThreadingPolicy& threadingPolicy = ITKThreadingPolicy::Instance();
+      threadingPolicy.apply(casterTo.GetPointer(), getNumberOfThreads());
+      threadingPolicy.apply(filter, getNumberOfThreads());
+      threadingPolicy.apply(casterFrom.GetPointer(), getNumberOfThreads());
+      if(m_DeferPipelineUpdate)
+      {
+        // ITK outputs only hold weak references to their sources: keep the whole chain alive
+        m_PipelineKeepAlive.push_back(casterTo.GetPointer());
+        m_PipelineKeepAlive.push_back(filter);
+        casterTo->ReleaseDataFlagOn();
+        filter->ReleaseDataFlagOn();
+        deferPipelineUpdate(casterFrom.GetPointer());
+        return;
+      }
+      {
+        ITKPerformanceMonitor::Phase phase(performanceRecords(), this, "Update", m_PerformanceInvocation);
+        {
+          ITKThreadingPolicy::AffinityScope affinity;
+          ITKDataStructureLock::Release release;
+          casterFrom->Update();
+        }
+        if(nullptr != performanceRecords())
+        {
+          std::vector<const void*> buffers(1, inputBuffer(dc, selectedArray));
+          phase.setAllocatedBytes(allocatedBytes(casterTo->GetOutput(), buffers) + allocatedBytes(filter->GetOutput(), buffers) + allocatedBytes(casterFrom->GetOutput(), buffers));
+        }
       }
+      m_PipelineSource = nullptr;
 
-      using toDream3DType = itk::InPlaceImageToDream3DDataFilter<OutputPixelType, Dimension>;
-      typename toDream3DType::Pointer toDream3DFilter = toDream3DType::New();
-      toDream3DFilter->SetInput(image);
-      toDream3DFilter->SetInPlace(true);
-      toDream3DFilter->SetAttributeMatrixArrayName(selectedArray.getAttributeMatrixName().toStdString());
-      toDream3DFilter->SetDataArrayName(outputArrayName);
-      toDream3DFilter->SetDataContainer(dc);
-      toDream3DFilter->Update();
+      typename OutputImageType::Pointer image = casterFrom->GetOutput();
+      image->DisconnectPipeline();
+      writeOutputImage<OutputPixelType, Dimension>(image, dc, outputArrayName, saveAsNewArray, selectedArray);
     } catch(itk::ExceptionObject& err)
     {
       setErrorCondition(-55556);
@@ -284,6 +513,131 @@ protected:
     notifyStatusMessage(getHumanLabel(), "Complete");
   }
 
+  /**
+   * @brief enableInPlace Asks an itk::InPlaceImageFilter to write its output over its input buffer.
+   * Filters that are not in-place filters are left untouched (see the overload below).
+   */
+  template <typename FilterType> static auto enableInPlace(FilterType* filter, int) -> decltype(filter->InPlaceOn(), void())
+  {
+    filter->InPlaceOn();
+  }
+  template <typename FilterType> static void enableInPlace(FilterType* /* filter */, long)
+  {
+  }
+
+  /**
+   * @brief writeOutputImage Stores the output of the ITK filter in the DataContainer without copying it.
+   * If the filter ran in place on the replaced array, the result already lives in that array and nothing
+   * has to be done. Otherwise the DataArray adopts the ITK buffer, replacing the input array if requested.
+   */
+  template <typename OutputPixelType, unsigned int Dimension>
+  void writeOutputImage(itk::Dream3DImage<OutputPixelType, Dimension>* image, DataContainer::Pointer dc, const std::string& outputArrayName, bool saveAsNewArray, const DataArrayPath& selectedArray)
+  {
+    if(!saveAsNewArray)
+    {
+      AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix(selectedArray.getAttributeMatrixName());
+      IDataArray::Pointer inputArray = attrMat->getAttributeArray(selectedArray.getDataArrayName());
+      if(nullptr != inputArray && inputArray->getVoidPointer(0) == static_cast<void*>(image->GetBufferPointer()) &&
+         outputArrayName == selectedArray.getDataArrayName().toStdString())
+      {
+        // The buffer still belongs to the input array (the bridge does not hand its ownership to ITK)
+        return;
+      }
+      // Remove the original input data array
+      ITKPerformanceMonitor::Phase phase(performanceRecords(), this, "RemoveInput", m_PerformanceInvocation);
+      attrMat->removeAttributeArray(selectedArray.getDataArrayName());
+    }
+
+    ITKPerformanceMonitor::Phase phase(performanceRecords(), this, "WrapOutput", m_PerformanceInvocation);
+    using toDream3DType = itk::InPlaceImageToDream3DDataFilter<OutputPixelType, Dimension>;
+    typename toDream3DType::Pointer toDream3DFilter = toDream3DType::New();
+    toDream3DFilter->SetInput(image);
+    toDream3DFilter->SetInPlace(true);
+    toDream3DFilter->SetAttributeMatrixArrayName(selectedArray.getAttributeMatrixName().toStdString());
+    toDream3DFilter->SetDataArrayName(outputArrayName);
+    toDream3DFilter->SetDataContainer(dc);
+    toDream3DFilter->Update();
+  }
+
+  /**
+   * @brief performanceRecords Returns where the phases of the current execution are recorded, nullptr
+   * when monitoring is disabled
+   */
+  std::vector<ITKPerformanceMonitor::PhaseRecord>* performanceRecords();
+
+  /**
+   * @brief startPerformanceRecords Drops the records of the previous execution and numbers the new one
+   */
+  void startPerformanceRecords();
+
+  /**
+   * @brief inputBuffer Returns the buffer of the selected array, nullptr if there is none
+   */
+  const void* inputBuffer(DataContainer::Pointer dc, const DataArrayPath& selectedArray) const;
+
+  /**
+   * @brief allocatedBytes Returns the size of the buffer of @p image if it is not one of @p buffers, which
+   * hold the input buffer and those already counted, and adds it to them. A filter that ran in place
+   * allocated nothing.
+   */
+  template <typename ImageType> static qint64 allocatedBytes(ImageType* image, std::vector<const void*>& buffers)
+  {
+    const void* buffer = image->GetBufferPointer();
+    if(nullptr == buffer || std::find(buffers.begin(), buffers.end(), buffer) != buffers.end())
+    {
+      return 0;
+    }
+    buffers.push_back(buffer);
+    return static_cast<qint64>(image->GetBufferedRegion().GetNumberOfPixels() * sizeof(typename ImageType::PixelType));
+  }
+
+  /**
+   * @brief connectInput Connects the input of @p filter to the output of the previous stage of a fused
+   * pipeline when there is one, otherwise to a bridge wrapping the selected DREAM.3D array.
+   * @return false if the previous stage does not produce the pixel type this filter expects
+   */
+  template <typename InputPixelType, unsigned int Dimension, typename FilterType> bool connectInput(FilterType* filter, DataContainer::Pointer dc, const DataArrayPath& selectedArray)
+  {
+    using toITKType = itk::InPlaceDream3DDataToImageFilter<InputPixelType, Dimension>;
+    using InputImageType = typename toITKType::ImageType;
+    if(nullptr != m_PipelineInput)
+    {
+      InputImageType* input = dynamic_cast<InputImageType*>(m_PipelineInput.GetPointer());
+      if(nullptr == input)
+      {
+        setErrorCondition(-55560);
+        notifyErrorMessage(getHumanLabel(), "The previous pipeline stage does not produce the pixel type expected by this filter", getErrorCondition());
+        return false;
+      }
+      filter->SetInput(input);
+      return true;
+    }
+    // Create a Bridge to wrap an existing DREAM.3D array with an ItkImage container. The bridge is updated
+    // right away, while the data structure is locked, so that the update of the filter does not read it.
+    typename toITKType::Pointer toITK = toITKType::New();
+    toITK->SetInput(dc);
+    toITK->SetInPlace(true);
+    toITK->SetAttributeMatrixArrayName(selectedArray.getAttributeMatrixName().toStdString());
+    toITK->SetDataArrayName(selectedArray.getDataArrayName().toStdString());
+    toITK->Update();
+    filter->SetInput(toITK->GetOutput());
+    // An ITK output only holds a weak reference to its source, the bridge must outlive the update
+    m_PipelineSource = toITK;
+    return true;
+  }
+
+  /**
+   * @brief isPipelineStage Returns true while the filter runs as a stage of a fused pipeline, i.e. reads the
+   * output of the previous stage or only connects its ITK filter for the next one
+   */
+  bool isPipelineStage() const;
+
+  /**
+   * @brief deferPipelineUpdate Keeps @p filter alive and publishes its output for the next stage of
+   * a fused pipeline instead of updating it. The output is released once the next stage has consumed it.
+   */
+  void deferPipelineUpdate(itk::ProcessObject* filter);
+
   /**
   * @brief CheckIntegerEntry: Input types can only be of certain types (float, double, bool, int).
     For the other type, we have to use one of this primitive type, and verify that the
@@ -358,6 +712,16 @@ protected:
    */
   void initialize();
 
+private:
+  itk::DataObject::Pointer m_PipelineInput;
+  itk::DataObject::Pointer m_PipelineOutput;
+  itk::ProcessObject::Pointer m_PipelineFilter;
+  itk::ProcessObject::Pointer m_PipelineSource;
+  std::vector<itk::ProcessObject::Pointer> m_PipelineKeepAlive;
+  bool m_DeferPipelineUpdate;
+  std::vector<ITKPerformanceMonitor::PhaseRecord> m_PerformanceRecords;
+  quint64 m_PerformanceInvocation;
+
 public:
   ITKImageBase(const ITKImageBase&) = delete;            // Copy Constructor Implemented
   ITKImageBase& operator=(const ITKImageBase&) = delete; // Copy Assignment Not Implemented
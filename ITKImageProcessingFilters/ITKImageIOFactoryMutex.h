@@ -0,0 +1,18 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <mutex>
+
+/**
+ * @brief ITKImageIOFactoryMutex The ITK object factories are not meant to be queried concurrently.
+ * Filters that read or write several files at once create their itk::ImageIOBase objects while holding
+ * this mutex and hand them to the readers and writers explicitly.
+ */
+inline std::mutex& ITKImageIOFactoryMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
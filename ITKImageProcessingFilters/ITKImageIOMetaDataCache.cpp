@@ -0,0 +1,235 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#include "ITKImageIOMetaDataCache.h"
+
+#include <mutex>
+
+#include <QtCore/QFileInfo>
+#include <QtCore/QMutexLocker>
+
+#include <itkImageIOFactory.h>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageIOFactoryMutex.h"
+
+namespace
+{
+// Bounds the memory used by the cache. Past this number of files, the cache starts over.
+const int k_MaxNumberOfEntries = 100000;
+
+template <typename T> void CreateImageArray(AbstractFilter* filter, const DataArrayPath& path, const QVector<size_t>& cDims)
+{
+  filter->getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<T>, AbstractFilter, T>(filter, path, 0, cDims);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKImageIOMetaDataCache::ITKImageIOMetaDataCache() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKImageIOMetaDataCache& ITKImageIOMetaDataCache::Instance()
+{
+  static ITKImageIOMetaDataCache cache;
+  return cache;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ITKImageIOMetaDataCache::getMetaData(const QString& fileName, MetaData& metaData)
+{
+  QFileInfo fi(fileName);
+  if(!fi.exists())
+  {
+    return QString("File does not exist: %1").arg(fileName);
+  }
+  const QString key = fi.absoluteFilePath();
+  const QDateTime lastModified = fi.lastModified();
+  {
+    QMutexLocker locker(&m_Mutex);
+    QHash<QString, Entry>::const_iterator iter = m_Entries.constFind(key);
+    if(iter != m_Entries.constEnd() && iter->lastModified == lastModified && iter->size == fi.size())
+    {
+      metaData = iter->metaData;
+      return QString();
+    }
+  }
+
+  // The header is read without holding the lock: a file may be read twice by concurrent callers,
+  // but the readers of other files are not blocked.
+  Entry entry;
+  const QString error = readMetaData(fileName, entry.metaData);
+  if(!error.isEmpty())
+  {
+    return error;
+  }
+  entry.lastModified = lastModified;
+  entry.size = fi.size();
+  metaData = entry.metaData;
+
+  QMutexLocker locker(&m_Mutex);
+  if(m_Entries.size() >= k_MaxNumberOfEntries)
+  {
+    m_Entries.clear();
+  }
+  m_Entries.insert(key, entry);
+  return QString();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKImageIOMetaDataCache::clear()
+{
+  QMutexLocker locker(&m_Mutex);
+  m_Entries.clear();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ITKImageIOMetaDataCache::size() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Entries.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ITKImageIOMetaDataCache::readMetaData(const QString& fileName, MetaData& metaData)
+{
+  try
+  {
+    itk::ImageIOBase::Pointer imageIO;
+    {
+      std::lock_guard<std::mutex> lock(ITKImageIOFactoryMutex());
+      imageIO = itk::ImageIOFactory::CreateImageIO(fileName.toLatin1(), itk::ImageIOFactory::ReadMode);
+    }
+    if(nullptr == imageIO)
+    {
+      return QString("ITK could not read the given file \"%1\". Format is likely unsupported.").arg(fileName);
+    }
+    imageIO->SetFileName(fileName.toLatin1());
+    imageIO->ReadImageInformation();
+    const unsigned int numberOfDimensions = imageIO->GetNumberOfDimensions();
+    metaData.dimensions.resize(numberOfDimensions);
+    metaData.spacing.resize(numberOfDimensions);
+    metaData.origin.resize(numberOfDimensions);
+    for(unsigned int i = 0; i < numberOfDimensions; i++)
+    {
+      metaData.dimensions[i] = imageIO->GetDimensions(i);
+      metaData.spacing[i] = imageIO->GetSpacing(i);
+      metaData.origin[i] = imageIO->GetOrigin(i);
+    }
+    metaData.componentType = imageIO->GetComponentType();
+    metaData.numberOfComponents = imageIO->GetNumberOfComponents();
+  } catch(itk::ExceptionObject& err)
+  {
+    return QString("ITK exception was thrown while reading \"%1\": %2").arg(fileName).arg(err.GetDescription());
+  }
+  return QString();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKImageIOMetaDataCache::PreflightImage(AbstractFilter* filter, const QString& fileName, const DataArrayPath& path)
+{
+  MetaData metaData;
+  if(!Instance().getMetaData(fileName, metaData).isEmpty())
+  {
+    return false;
+  }
+  // Same restrictions as the reader helper: images are read as 2D or 3D images of scalar, RGB or RGBA
+  // pixels. 64 bit integers are left to the helper, whose array type depends on the platform.
+  const size_t numberOfDimensions = metaData.dimensions.size();
+  if(numberOfDimensions < 1 || numberOfDimensions > 3)
+  {
+    return false;
+  }
+  if(metaData.numberOfComponents != 1 && metaData.numberOfComponents != 3 && metaData.numberOfComponents != 4)
+  {
+    return false;
+  }
+  switch(metaData.componentType)
+  {
+  case itk::ImageIOBase::UCHAR:
+  case itk::ImageIOBase::CHAR:
+  case itk::ImageIOBase::USHORT:
+  case itk::ImageIOBase::SHORT:
+  case itk::ImageIOBase::UINT:
+  case itk::ImageIOBase::INT:
+  case itk::ImageIOBase::FLOAT:
+  case itk::ImageIOBase::DOUBLE:
+    break;
+  default:
+    return false;
+  }
+  DataContainer::Pointer container = filter->getDataContainerArray()->getDataContainer(path.getDataContainerName());
+  if(nullptr == container.get())
+  {
+    return false;
+  }
+
+  QVector<size_t> tDims(3, 1);
+  float spacing[3] = {1.0f, 1.0f, 1.0f};
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+  for(size_t i = 0; i < numberOfDimensions; i++)
+  {
+    tDims[i] = metaData.dimensions[i];
+    spacing[i] = static_cast<float>(metaData.spacing[i]);
+    origin[i] = static_cast<float>(metaData.origin[i]);
+  }
+  ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+  image->setOrigin(origin[0], origin[1], origin[2]);
+  image->setResolution(spacing[0], spacing[1], spacing[2]);
+  image->setDimensions(tDims[0], tDims[1], tDims[2]);
+  container->setGeometry(image);
+
+  container->createNonPrereqAttributeMatrix(filter, path.getAttributeMatrixName(), tDims, AttributeMatrix::Type::Cell);
+  if(filter->getErrorCondition() < 0)
+  {
+    return true;
+  }
+  const QVector<size_t> cDims(1, metaData.numberOfComponents);
+  switch(metaData.componentType)
+  {
+  case itk::ImageIOBase::UCHAR:
+    CreateImageArray<uint8_t>(filter, path, cDims);
+    break;
+  case itk::ImageIOBase::CHAR:
+    CreateImageArray<int8_t>(filter, path, cDims);
+    break;
+  case itk::ImageIOBase::USHORT:
+    CreateImageArray<uint16_t>(filter, path, cDims);
+    break;
+  case itk::ImageIOBase::SHORT:
+    CreateImageArray<int16_t>(filter, path, cDims);
+    break;
+  case itk::ImageIOBase::UINT:
+    CreateImageArray<uint32_t>(filter, path, cDims);
+    break;
+  case itk::ImageIOBase::INT:
+    CreateImageArray<int32_t>(filter, path, cDims);
+    break;
+  case itk::ImageIOBase::FLOAT:
+    CreateImageArray<float>(filter, path, cDims);
+    break;
+  case itk::ImageIOBase::DOUBLE:
+    CreateImageArray<double>(filter, path, cDims);
+    break;
+  default:
+    break;
+  }
+  return true;
+}
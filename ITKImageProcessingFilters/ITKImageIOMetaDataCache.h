@@ -0,0 +1,97 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <QtCore/QDateTime>
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QString>
+
+#include <itkImageIOBase.h>
+
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+#include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+
+/**
+ * @brief The ITKImageIOMetaDataCache class keeps the header information of the image files read by the
+ * filters of this plugin, so that a file header is parsed once per process instead of once per preflight.
+ * Entries are keyed on the absolute path of the file and are only used while the modification time
+ * and the size of the file are unchanged. The cache can be used from several threads at once.
+ */
+class ITKImageProcessing_EXPORT ITKImageIOMetaDataCache
+{
+public:
+  /**
+   * @brief The MetaData struct holds what itk::ImageIOBase::ReadImageInformation() reads from a file
+   */
+  struct MetaData
+  {
+    std::vector<size_t> dimensions;
+    std::vector<double> spacing;
+    std::vector<double> origin;
+    itk::ImageIOBase::IOComponentType componentType = itk::ImageIOBase::UNKNOWNCOMPONENTTYPE;
+    unsigned int numberOfComponents = 0;
+  };
+
+  /**
+   * @brief Instance Returns the cache shared by every filter of the process
+   */
+  static ITKImageIOMetaDataCache& Instance();
+
+  /**
+   * @brief getMetaData Fills @p metaData with the header information of @p fileName. The file is only
+   * read if it is not in the cache yet or if it changed since it was cached.
+   * @return An empty string on success, the error message otherwise
+   */
+  QString getMetaData(const QString& fileName, MetaData& metaData);
+
+  /**
+   * @brief clear Removes every entry
+   */
+  void clear();
+
+  /**
+   * @brief size Returns the number of cached files
+   */
+  int size() const;
+
+  /**
+   * @brief PreflightImage Creates on the DataContainer of @p path the ImageGeom, the cell AttributeMatrix
+   * and the image array that readImage(path, true) of the ITK image reader helper creates for @p fileName,
+   * from the cached header of the file. Nothing is created and false is returned when the file cannot be
+   * read or when its pixel type is not one handled here: the caller then falls back to readImage(), which
+   * reports the errors.
+   */
+  static bool PreflightImage(AbstractFilter* filter, const QString& fileName, const DataArrayPath& path);
+
+protected:
+  ITKImageIOMetaDataCache();
+
+  /**
+   * @brief readMetaData Reads the header of @p fileName
+   */
+  static QString readMetaData(const QString& fileName, MetaData& metaData);
+
+private:
+  struct Entry
+  {
+    QDateTime lastModified;
+    qint64 size = 0;
+    MetaData metaData;
+  };
+
+  mutable QMutex m_Mutex;
+  QHash<QString, Entry> m_Entries;
+
+public:
+  ITKImageIOMetaDataCache(const ITKImageIOMetaDataCache&) = delete;            // Copy Constructor Not Implemented
+  ITKImageIOMetaDataCache(ITKImageIOMetaDataCache&&) = delete;                 // Move Constructor Not Implemented
+  ITKImageIOMetaDataCache& operator=(const ITKImageIOMetaDataCache&) = delete; // Copy Assignment Not Implemented
+  ITKImageIOMetaDataCache& operator=(ITKImageIOMetaDataCache&&) = delete;      // Move Assignment Not Implemented
+};
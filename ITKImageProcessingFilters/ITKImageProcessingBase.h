@@ -7,6 +7,9 @@
 #include "ITKImageBase.h"
 
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKScaleSpaceCache.h"
+
+template <typename InputPixelType, unsigned int Dimension> class ITKScaleSpace;
 
 /**
  * @brief The ITKImageProcessingBase class. See [Filter documentation](@ref ITKImageProcessingBase) for details.
@@ -142,6 +145,53 @@ protected:
     ITKImageBase::filterCastToFloat<InputPixelType, OutputPixelType, Dimension, FilterType, FloatImageType>(filter, outputArrayName, getSaveAsNewArray(), getSelectedCellArrayPath());
   }
 
+  /**
+   * @brief filterScaleSpace Computes the output image with @p compute, from the images of the Gaussian scale
+   * space of the selected array (see ITKScaleSpace), instead of running an ITK filter. @p compute is given the
+   * ITKScaleSpace of the selected array and returns a new itk::Dream3DImage<OutputPixelType, Dimension>; it
+   * runs without the data structure lock.
+   * @return false, without doing anything, when the scale space cache cannot be used: it is disabled, the
+   * filter is a stage of a fused pipeline or its execution is streamed. The caller then runs its ITK filter.
+   */
+  template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension, typename ComputeType> bool filterScaleSpace(ComputeType compute)
+  {
+    if(!ITKScaleSpaceCache::Instance().isEnabled() || isPipelineStage() || getStreamedExecution())
+    {
+      return false;
+    }
+    std::string outputArrayName = getSelectedCellArrayPath().getDataArrayName().toStdString();
+
+    if(getSaveAsNewArray())
+    {
+      outputArrayName = getNewCellArrayName().toStdString();
+    }
+    try
+    {
+      DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getSelectedCellArrayPath().getDataContainerName());
+      typename itk::Dream3DImage<OutputPixelType, Dimension>::Pointer image;
+      {
+        ITKScaleSpace<InputPixelType, Dimension> scaleSpace(this, getSelectedCellArrayPath(), getNumberOfThreads());
+        // Other filters may use the data structure while the pixels are processed
+        ITKThreadingPolicy::AffinityScope affinity;
+        ITKDataStructureLock::Release release;
+        image = compute(scaleSpace);
+      }
+      writeOutputImage<OutputPixelType, Dimension>(image, dc, outputArrayName, getSaveAsNewArray(), getSelectedCellArrayPath());
+    } catch(itk::ExceptionObject& err)
+    {
+      if(!getCancel())
+      {
+        setErrorCondition(-55555);
+        QString errorMessage = "ITK exception was thrown while filtering input image: %1";
+        notifyErrorMessage(getHumanLabel(), errorMessage.arg(err.GetDescription()), getErrorCondition());
+      }
+      return true;
+    }
+
+    notifyStatusMessage(getHumanLabel(), "Complete");
+    return true;
+  }
+
   /**
    * @brief Initializes all the private instance variables.
    */
@@ -40,6 +40,7 @@
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 
 #include "ITKImageProcessing/ITKImageProcessingConstants.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageIOMetaDataCache.h"
 #include "ITKImageProcessing/ITKImageProcessingVersion.h"
 #include "ITKImageProcessingPlugin.h"
 
@@ -121,7 +122,11 @@ void ITKImageReader::dataCheck()
     return;
   }
   DataArrayPath dap(getDataContainerName(), getCellAttributeMatrixName(), getImageDataArrayName());
-  readImage(dap, true);
+  // The header of the file is only parsed once per process, unless the file changes
+  if(!ITKImageIOMetaDataCache::PreflightImage(this, filename, dap))
+  {
+    readImage(dap, true);
+  }
   // If we got here, that means that there is no error
   setErrorCondition(0);
   setWarningCondition(0);
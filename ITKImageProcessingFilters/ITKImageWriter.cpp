@@ -41,12 +41,15 @@
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/OutputFileFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 
 #include "ITKImageProcessing/ITKImageProcessingConstants.h"
 #include "ITKImageProcessing/ITKImageProcessingVersion.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageIOFactoryMutex.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKPlaneExtractor.h"
 #include "ITKImageProcessingPlugin.h"
 #include "SIMPLib/ITK/itkInPlaceDream3DDataToImageFilter.h"
 #define DREAM3D_USE_RGB_RGBA 1
@@ -59,16 +62,28 @@ extern Q_CORE_EXPORT int qt_ntfs_permission_lookup;
 
 // ITK includes
 #include <itkImageFileWriter.h>
-#include <itkImageSeriesWriter.h>
-#include <itkNumericSeriesFileNames.h>
+#include <itkImageIOFactory.h>
 #include <itksys/SystemTools.hxx>
 
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/pipeline.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 ITKImageWriter::ITKImageWriter()
 : m_FileName("")
 , m_ImageArrayPath("", "", "")
+, m_Plane(0)
+, m_NumberOfWriterThreads(0)
 {
 }
 
@@ -103,6 +118,7 @@ void ITKImageWriter::setupFilterParameters()
   
   QString supportedExtensions = ITKImageProcessingPlugin::getListSupportedWriteExtensions();
   parameters.push_back(SIMPL_NEW_OUTPUT_FILE_FP("Output File", FileName, FilterParameter::Parameter, ITKImageWriter, supportedExtensions));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Writer Threads (0: all cores)", NumberOfWriterThreads, FilterParameter::Parameter, ITKImageWriter));
 
   parameters.push_back(SeparatorFilterParameter::New("Image Data", FilterParameter::RequiredArray));
   {
@@ -121,6 +137,7 @@ void ITKImageWriter::readFilterParameters(AbstractFilterParametersReader* reader
   reader->openFilterGroup(this, index);
   setFileName(reader->readString("FileName", getFileName()));
   setImageArrayPath(reader->readDataArrayPath("ImageArrayPath", getImageArrayPath()));
+  setNumberOfWriterThreads(reader->readValue("NumberOfWriterThreads", getNumberOfWriterThreads()));
   reader->closeFilterGroup();
 }
 
@@ -245,25 +262,22 @@ bool ITKImageWriter::is2DFormat()
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename TPixel, unsigned int Dimensions> 
-void ITKImageWriter::writeAs2DStack(typename itk::Dream3DImage<TPixel, Dimensions>* image, unsigned long z_size)
+template <typename TPixel, unsigned int Dimensions> void ITKImageWriter::writeAsOneFile(typename itk::Dream3DImage<TPixel, Dimensions>* image, const QString& fileName) const
 {
-  typedef itk::NumericSeriesFileNames NamesGeneratorType;
-  NamesGeneratorType::Pointer namesGenerator = NamesGeneratorType::New();
-  std::string path = itksys::SystemTools::GetFilenamePath(getFileName().toStdString());
-  std::string filename = itksys::SystemTools::GetFilenameWithoutExtension(getFileName().toStdString());
-  std::string extension = itksys::SystemTools::GetFilenameExtension(getFileName().toStdString());
-  std::string format = path + "/" + filename + "%03d" + extension;
-  namesGenerator->SetSeriesFormat(format);
-  namesGenerator->SetIncrementIndex(1);
-  namesGenerator->SetStartIndex(0);
-  namesGenerator->SetEndIndex(z_size - 1);
-  typedef itk::Dream3DImage<TPixel, Dimensions> InputImageType;
-  typedef itk::Dream3DImage<TPixel, Dimensions - 1> OutputImageType;
-  typedef itk::ImageSeriesWriter<InputImageType, OutputImageType> SeriesWriterType;
-  typename SeriesWriterType::Pointer writer = SeriesWriterType::New();
+  typedef itk::Dream3DImage<TPixel, Dimensions> ImageType;
+  typedef itk::ImageFileWriter<ImageType> FileWriterType;
+  typename FileWriterType::Pointer writer = FileWriterType::New();
+  {
+    std::lock_guard<std::mutex> lock(ITKImageIOFactoryMutex());
+    itk::ImageIOBase::Pointer imageIO = itk::ImageIOFactory::CreateImageIO(fileName.toStdString().c_str(), itk::ImageIOFactory::WriteMode);
+    if(nullptr != imageIO)
+    {
+      writer->SetImageIO(imageIO);
+    }
+  }
+
   writer->SetInput(image);
-  writer->SetFileNames(namesGenerator->GetFileNames());
+  writer->SetFileName(fileName.toStdString().c_str());
   writer->UseCompressionOn();
   writer->Update();
 }
@@ -271,77 +285,175 @@ void ITKImageWriter::writeAs2DStack(typename itk::Dream3DImage<TPixel, Dimension
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename TPixel, unsigned int Dimensions> 
-void ITKImageWriter::writeAsOneFile(typename itk::Dream3DImage<TPixel, Dimensions>* image)
+template <typename TPixel, unsigned int Dimensions> void ITKImageWriter::writeImage(const DataContainer::Pointer& container, const DataArrayPath& path, const QString& fileName) const
 {
-  typedef itk::Dream3DImage<TPixel, Dimensions> ImageType;
-  typedef itk::ImageFileWriter<ImageType> FileWriterType;
-  typename FileWriterType::Pointer writer = FileWriterType::New();
-
-  QString progress = QString("Saving %1").arg(getFileName());
-  notifyStatusMessage(getHumanLabel(), progress);
+  using ToITKType = itk::InPlaceDream3DDataToImageFilter<TPixel, Dimensions>;
 
-  writer->SetInput(image);
-  writer->SetFileName(getFileName().toStdString().c_str());
-  writer->UseCompressionOn();
-  writer->Update();
+  typename ToITKType::Pointer toITK = ToITKType::New();
+  toITK->SetInput(container);
+  toITK->SetAttributeMatrixArrayName(path.getAttributeMatrixName().toStdString());
+  toITK->SetDataArrayName(path.getDataArrayName().toStdString());
+  toITK->SetInPlace(true);
+  toITK->Update();
+  this->writeAsOneFile<TPixel, Dimensions>(toITK->GetOutput(), fileName);
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename TPixel, typename UnusedTPixel, unsigned int Dimensions> 
-void ITKImageWriter::writeImage()
+template <typename TPixel, typename UnusedTPixel, unsigned int Dimension> void ITKImageWriter::writeSlices()
 {
-  using ImageType = itk::Dream3DImage<TPixel, Dimensions>;
-  using ToITKType = itk::InPlaceDream3DDataToImageFilter<TPixel, Dimensions>;
-  
-  DataArrayPath path = getImageArrayPath();
-  DataContainer::Pointer container = getDataContainerArray()->getDataContainer(path.getDataContainerName());
+  using ValueType = typename itk::NumericTraits<TPixel>::ValueType;
+  typename DataArray<ValueType>::Pointer source = std::dynamic_pointer_cast<DataArray<ValueType>>(m_SliceSource);
+  if(nullptr == source)
+  {
+    setErrorCondition(-21010);
+    notifyErrorMessage(getHumanLabel(), "The type of the selected array does not match its pixel type.", getErrorCondition());
+    return;
+  }
 
-  try
+  const DataArrayPath path = getImageArrayPath();
+  DataContainer::Pointer prototype = getDataContainerArray()->getDataContainer(path.getDataContainerName());
+  const QString geometryName = prototype->getGeometry()->getName();
+  QVector<size_t> tDims = prototype->getAttributeMatrix(path.getAttributeMatrixName())->getTupleDimensions();
+  const QVector<size_t> cDims = source->getComponentDimensions();
+  const size_t nComp = static_cast<size_t>(source->getNumberOfComponents());
+  const size_t numberOfTuples = tDims[0] * tDims[1];
+  const size_t* dims = m_SliceSourceDimensions;
+  size_t numberOfSlices = dims[0];
+  if(ITKImageWriter::XYPlane == m_Plane)
   {
-    typename ToITKType::Pointer toITK = ToITKType::New();
-    toITK->SetInput(container);
-    toITK->SetAttributeMatrixArrayName(path.getAttributeMatrixName().toStdString());
-    toITK->SetDataArrayName(path.getDataArrayName().toStdString());
-    toITK->SetInPlace(true);
-    toITK->Update();
-    if(this->is2DFormat() && Dimensions == 3)
+    numberOfSlices = dims[2];
+  }
+  else if(ITKImageWriter::XZPlane == m_Plane)
+  {
+    numberOfSlices = dims[1];
+  }
+  const ValueType* volume = source->getPointer(0);
+  const ITKPlaneExtractor<ValueType> extractor(volume, dims, nComp);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  const int numberOfThreads = m_NumberOfWriterThreads > 0 ? m_NumberOfWriterThreads : tbb::task_scheduler_init::default_num_threads();
+#else
+  const int numberOfThreads = 1;
+#endif
+
+  // XZ and YZ slices are extracted by blocks of consecutive slices, so that each pass over the volume
+  // fills several of them. A YZ block spans one cache line of source tuples; blocks are kept small enough
+  // to bound the scratch memory per thread and to leave a few blocks per writer thread.
+  size_t slicesPerBlock = 1;
+  if(ITKImageWriter::XYPlane != m_Plane)
+  {
+    const size_t tupleSize = sizeof(ValueType) * nComp;
+    const size_t sliceSize = std::max<size_t>(numberOfTuples * tupleSize, 1);
+    const size_t maxScratchSize = 64 * 1024 * 1024;
+    slicesPerBlock = std::max<size_t>(64 / tupleSize, 1);
+    slicesPerBlock = std::min(slicesPerBlock, std::max<size_t>(maxScratchSize / sliceSize, 1));
+    slicesPerBlock = std::min(slicesPerBlock, std::max<size_t>(numberOfSlices / (static_cast<size_t>(numberOfThreads) * 2), 1));
+  }
+  const size_t numberOfBlocks = (numberOfSlices + slicesPerBlock - 1) / slicesPerBlock;
+
+  // Extracts the slices of one block and writes them. XY slices are contiguous in the volume and are
+  // written from the volume itself, XZ and YZ slices are gathered into @p scratch.
+  auto writeBlock = [&](size_t block, std::vector<ValueType>& scratch) -> std::string {
+    const size_t first = block * slicesPerBlock;
+    const size_t count = std::min(slicesPerBlock, numberOfSlices - first);
+    const ValueType* blockBuffer = volume + first * numberOfTuples * nComp;
+    if(ITKImageWriter::XYPlane != m_Plane)
     {
-      typename ImageType::SizeType size = toITK->GetOutput()->GetLargestPossibleRegion().GetSize();
-      if(size[2] < 2)
+      scratch.resize(count * numberOfTuples * nComp);
+      if(ITKImageWriter::XZPlane == m_Plane)
       {
-        setErrorCondition(-21012);
-        notifyErrorMessage(getHumanLabel(), "Image is 2D, not 3D.", getErrorCondition());
-        return;
+        extractor.extractXZ(first, count, scratch.data());
       }
-      this->writeAs2DStack<TPixel, Dimensions>(toITK->GetOutput(), size[2]);
+      else
+      {
+        extractor.extractYZ(first, count, scratch.data());
+      }
+      blockBuffer = scratch.data();
     }
-    else
+
+    for(size_t i = 0; i < count; ++i)
     {
-      this->writeAsOneFile<TPixel, Dimensions>(toITK->GetOutput());
+      const QString fileName = getSliceFileName(first + i, numberOfSlices);
+      try
+      {
+        DataContainer::Pointer dc = DataContainer::New(prototype->getName());
+        ImageGeom::Pointer imageGeom = ImageGeom::CreateGeometry(geometryName);
+        imageGeom->setDimensions(tDims.data());
+        dc->setGeometry(imageGeom);
+        AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, path.getAttributeMatrixName(), AttributeMatrix::Type::Cell);
+        dc->addAttributeMatrix(am->getName(), am);
+        ValueType* sliceBuffer = const_cast<ValueType*>(blockBuffer + i * numberOfTuples * nComp);
+        typename DataArray<ValueType>::Pointer sliceData = DataArray<ValueType>::WrapPointer(sliceBuffer, numberOfTuples, cDims, path.getDataArrayName(), false);
+        am->addAttributeArray(sliceData->getName(), sliceData);
+        writeImage<TPixel, Dimension>(dc, path, fileName);
+      } catch(itk::ExceptionObject& err)
+      {
+        return fileName.toStdString() + ": " + err.GetDescription();
+      }
     }
-  } catch(itk::ExceptionObject& err)
+    return std::string();
+  };
+
+  auto notifyBlockSaved = [&](size_t block) {
+    const size_t first = block * slicesPerBlock;
+    for(size_t slice = first; slice < std::min(first + slicesPerBlock, numberOfSlices); ++slice)
+    {
+      notifyStatusMessage(getHumanLabel(), QString("Saved %1").arg(getSliceFileName(slice, numberOfSlices)));
+    }
+  };
+
+  std::vector<std::string> errors(numberOfBlocks);
+  std::atomic<bool> failed(false);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  // The number of tokens bounds the number of blocks in flight, hence the memory used by the XZ and YZ
+  // scratch buffers and by the encoders.
+  const size_t maxBlocksInFlight = static_cast<size_t>(numberOfThreads) * 2;
+  tbb::enumerable_thread_specific<std::vector<ValueType>> scratchBuffers;
+  size_t nextBlock = 0;
+  tbb::task_arena arena(numberOfThreads);
+  arena.execute([&] {
+    tbb::parallel_pipeline(maxBlocksInFlight, tbb::make_filter<void, size_t>(tbb::filter::serial_in_order,
+                                                                             [&](tbb::flow_control& fc) -> size_t {
+                                                                               if(nextBlock >= numberOfBlocks || failed || getCancel())
+                                                                               {
+                                                                                 fc.stop();
+                                                                                 return 0;
+                                                                               }
+                                                                               return nextBlock++;
+                                                                             }) &
+                                                  tbb::make_filter<size_t, size_t>(tbb::filter::parallel,
+                                                                                   [&](size_t block) -> size_t {
+                                                                                     errors[block] = writeBlock(block, scratchBuffers.local());
+                                                                                     if(!errors[block].empty())
+                                                                                     {
+                                                                                       failed = true;
+                                                                                     }
+                                                                                     return block;
+                                                                                   }) &
+                                                  tbb::make_filter<size_t, void>(tbb::filter::serial_in_order, notifyBlockSaved));
+  });
+#else
+  std::vector<ValueType> scratch;
+  for(size_t block = 0; block < numberOfBlocks && !failed && !getCancel(); ++block)
   {
-    setErrorCondition(-21011);
-    QString errorMessage = "ITK exception was thrown while writing output file: %1";
-    notifyErrorMessage(getHumanLabel(), errorMessage.arg(err.GetDescription()), getErrorCondition());
-    return;
+    errors[block] = writeBlock(block, scratch);
+    failed = !errors[block].empty();
+    notifyBlockSaved(block);
   }
-}
-
-#define ITKIW_PREP_DC(dimA, dimB)\
-  size_t dA = dimA;\
-  size_t dB = dimB;\
-  size_t numElements = dA * dB;\
-  AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, attributeMatrix->getName(), AttributeMatrix::Type::Cell);\
-  dc->addAttributeMatrix(am->getName(), am);\
-  imageGeom->setDimensions(tDims.data());\
-  IDataArray::Pointer sliceData = currentData->createNewArray(numElements, cDims, currentData->getName(), true);\
-  am->addAttributeArray(sliceData->getName(), sliceData);\
-    
+#endif
 
+  for(const std::string& error : errors)
+  {
+    if(!error.empty())
+    {
+      setErrorCondition(-21011);
+      QString errorMessage = "ITK exception was thrown while writing output file: %1";
+      notifyErrorMessage(getHumanLabel(), errorMessage.arg(QString::fromStdString(error)), getErrorCondition());
+      return;
+    }
+  }
+}
 
 // -----------------------------------------------------------------------------
 //
@@ -399,13 +511,7 @@ void ITKImageWriter::execute()
   size_t dims[3] = {0, 0, 0};
   ImageGeom::Pointer currentGeom = container->getGeometryAs<ImageGeom>();
   std::tie(dims[0], dims[1], dims[2]) = currentGeom->getDimensions();
-  
-  DataContainerArray::Pointer dca = DataContainerArray::New();
-  DataContainer::Pointer dc = DataContainer::New(container->getName());
-  dca->addDataContainer(dc);
-  ImageGeom::Pointer imageGeom = ImageGeom::CreateGeometry(attributeMatrix->getName());
-  dc->setGeometry(imageGeom);
-  
+
   IDataArray::Pointer currentData = attributeMatrix->getAttributeArray(path.getDataArrayName());
   QVector<size_t> cDims = currentData->getComponentDimensions();
   if(cDims.size() > 1)
@@ -415,89 +521,52 @@ void ITKImageWriter::execute()
     notifyErrorMessage(getHumanLabel(), errorMessage.arg(path.getDataArrayName()), getErrorCondition());
     return;
   }
-  size_t nComp = cDims[0];
-  
-  if(ITKImageWriter::XYPlane == m_Plane) // XY plane
+
+  QVector<size_t> tDims = {dims[0], dims[1], 1};
+  if(ITKImageWriter::XZPlane == m_Plane)
   {
-    QVector<size_t> tDims = { dims[0], dims[1], 1};
-    ITKIW_PREP_DC(dims[0], dims[1])
-    
-    for(size_t slice = 0; slice < dims[2]; ++slice)
-    {
-      for(size_t axisA = 0; axisA < dA; ++axisA)
-      {
-        for(size_t axisB = 0; axisB < dB; ++axisB)
-        {
-          size_t index = (slice * dA * dB) + (axisA * dB) + axisB;          
-          copyTuple(index, axisA, dB, axisB, nComp, currentData.get(), sliceData.get());
-        }
-      }
-      saveImageData(dca, slice, dims[2]);
-    }
+    tDims = {dims[0], dims[2], 1};
   }
-  else if(ITKImageWriter::XZPlane == m_Plane) // XZ plane
+  else if(ITKImageWriter::YZPlane == m_Plane)
   {
-    QVector<size_t> tDims = { dims[0], dims[2], 1};
-    ITKIW_PREP_DC(dims[2], dims[0])
-
-    for(size_t slice = 0; slice < dims[1]; ++slice)
-    {
-      for(size_t axisA = 0; axisA < dA; ++axisA)
-      {
-        for(size_t axisB = 0; axisB < dB; ++axisB)
-        {
-          size_t index = (dims[1] * axisA * dB) + (slice * dB) + axisB;
-          copyTuple(index, axisA, dB, axisB, nComp, currentData.get(), sliceData.get());
-        }
-      } 
-      saveImageData(dca, slice, dims[1]);
-    }
+    tDims = {dims[1], dims[2], 1};
   }
-  else if(ITKImageWriter::YZPlane == m_Plane) // YZ plane
-  {
-    QVector<size_t> tDims = { dims[1], dims[2], 1};
-    ITKIW_PREP_DC(dims[2], dims[1])
 
-    for(size_t slice = 0; slice < dims[0]; ++slice) // X 
-    {
-      for(size_t axisA = 0; axisA < dA; ++axisA) // Z
-      { 
-        for(size_t axisB = 0; axisB < dB; ++axisB) // Y
-        {
-          size_t index = (dims[0] * axisA * dB) + (axisB * dims[0]) + slice;
-          copyTuple(index, axisA, dB, axisB, nComp, currentData.get(), sliceData.get());
-        }
-      }
-      saveImageData(dca, slice, dims[0]);
-    }
+  // Prototype of one slice. Its array is never allocated: writeSlices() wraps the slices of the
+  // selected array instead.
+  DataContainerArray::Pointer dca = DataContainerArray::New();
+  DataContainer::Pointer dc = DataContainer::New(container->getName());
+  dca->addDataContainer(dc);
+  ImageGeom::Pointer imageGeom = ImageGeom::CreateGeometry(attributeMatrix->getName());
+  dc->setGeometry(imageGeom);
+  imageGeom->setDimensions(tDims.data());
+  AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, attributeMatrix->getName(), AttributeMatrix::Type::Cell);
+  dc->addAttributeMatrix(am->getName(), am);
+  IDataArray::Pointer sliceData = currentData->createNewArray(tDims[0] * tDims[1], cDims, currentData->getName(), false);
+  am->addAttributeArray(sliceData->getName(), sliceData);
+
+  m_SliceSource = currentData;
+  std::copy(dims, dims + 3, m_SliceSourceDimensions);
+  DataContainerArray::Pointer originalDataContainerArray = getDataContainerArray();
+  setDataContainerArray(dca);
+  Dream3DArraySwitchMacro(this->writeSlices, getImageArrayPath(), -21010);
+  setDataContainerArray(originalDataContainerArray);
+  m_SliceSource = IDataArray::NullPointer();
+  if(getErrorCondition() < 0)
+  {
+    return;
   }
-  
+
   notifyStatusMessage(getHumanLabel(), "Complete");
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-void ITKImageWriter::copyTuple(size_t index, size_t axisA, 
-                                size_t dB, size_t axisB,  size_t nComp,
-                               IDataArray* currentData, IDataArray* sliceData)
+QString ITKImageWriter::getSliceFileName(size_t slice, size_t maxSlice) const
 {
-  size_t indexNew = (axisA * dB) + axisB;
-  
-  void* source = currentData->getVoidPointer((nComp * index));
-  void* destination = sliceData->getVoidPointer(nComp * indexNew);
-  ::memcpy(destination, source, currentData->getTypeSize() * nComp); 
-  
-}
+  QFileInfo fi(getFileName());
 
-// -----------------------------------------------------------------------------
-//
-// -----------------------------------------------------------------------------
-void ITKImageWriter::saveImageData(DataContainerArray::Pointer dca, size_t slice, size_t maxSlice)
-{
-  QString originalFileName = getFileName();
-  QFileInfo fi(originalFileName);
-  
   QString adjustedFilePath;
   QTextStream out(&adjustedFilePath);
   out << fi.absolutePath() << "/" << fi.completeBaseName();
@@ -506,13 +575,7 @@ void ITKImageWriter::saveImageData(DataContainerArray::Pointer dca, size_t slice
     out << "_" << slice;
   }
   out << "." << fi.suffix();
-    
-  setFileName(adjustedFilePath);
-  DataContainerArray::Pointer originalDataContainerArray = getDataContainerArray();
-  setDataContainerArray(dca);
-  Dream3DArraySwitchMacro(this->writeImage, getImageArrayPath(), -21010);
-  setDataContainerArray(originalDataContainerArray);
-  setFileName(originalFileName);  
+  return adjustedFilePath;
 }
 
 // -----------------------------------------------------------------------------
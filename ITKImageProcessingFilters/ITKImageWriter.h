@@ -52,6 +52,7 @@ class ITKImageProcessing_EXPORT ITKImageWriter : public AbstractFilter
   PYB11_CREATE_BINDINGS(ITKImageWriter SUPERCLASS AbstractFilter)
   PYB11_PROPERTY(QString FileName READ getFileName WRITE setFileName)
   PYB11_PROPERTY(DataArrayPath ImageArrayPath READ getImageArrayPath WRITE setImageArrayPath)
+  PYB11_PROPERTY(int NumberOfWriterThreads READ getNumberOfWriterThreads WRITE setNumberOfWriterThreads)
 
 public:
   SIMPL_SHARED_POINTERS(ITKImageWriter)
@@ -72,6 +73,9 @@ public:
 
   SIMPL_FILTER_PARAMETER(int, Plane)
   Q_PROPERTY(int Plane READ getPlane WRITE setPlane)
+
+  SIMPL_FILTER_PARAMETER(int, NumberOfWriterThreads)
+  Q_PROPERTY(int NumberOfWriterThreads READ getNumberOfWriterThreads WRITE setNumberOfWriterThreads)
   
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
@@ -179,42 +183,33 @@ protected:
   void initialize();
 
   /**
-  * @brief Converts Dream3D data to an ITK image and calls the actual writer.
+  * @brief writeSlices Writes every slice of the selected plane. It is called through Dream3DArraySwitchMacro
+  * on a prototype container holding one (unallocated) slice, so that the pixel type and the dimension of
+  * the ITK image are chosen exactly as for a single slice. Blocks of consecutive slices are extracted with
+  * ITKPlaneExtractor and encoded concurrently, with at most a few blocks in flight per writer thread.
   */
-  template <typename TPixel, typename UnusedTPixel, unsigned int Dimension> void writeImage();
+  template <typename TPixel, typename UnusedTPixel, unsigned int Dimension> void writeSlices();
 
   /**
-  * @brief writeAs2DStack Writes 3D images as a stack of 2D images.
+  * @brief Converts Dream3D data to an ITK image and calls the actual writer. This method can be called
+  * concurrently on different containers and throws itk::ExceptionObject on failure.
   */
-  template <typename TPixel, unsigned int Dimensions> 
-  void writeAs2DStack(typename itk::Dream3DImage<TPixel, Dimensions>* image, unsigned long z_size);
+  template <typename TPixel, unsigned int Dimension> void writeImage(const DataContainer::Pointer& container, const DataArrayPath& path, const QString& fileName) const;
 
   /**
   * @brief writeAsOneFile Writes images as one file.
   */
-  template <typename TPixel, unsigned int Dimensions> 
-  void writeAsOneFile(typename itk::Dream3DImage<TPixel, Dimensions>* image);
-  
-  private:
-  /**
-   * @brief copyTuple
-   * @param index
-   * @param axisA
-   * @param dB
-   * @param axisB
-   * @param nComp
-   * @param currentData
-   * @param sliceData
-   */
-  void copyTuple(size_t index, size_t axisA, size_t dB, size_t axisB, size_t nComp,
-                               IDataArray* currentData, IDataArray* sliceData);
-  /**
-   * @brief saveImageData
-   * @param dca
-   * @param slice
-   * @param maxSlice
-   */
-  void saveImageData(DataContainerArray::Pointer dca, size_t slice, size_t maxSlice);                               
+  template <typename TPixel, unsigned int Dimensions> void writeAsOneFile(typename itk::Dream3DImage<TPixel, Dimensions>* image, const QString& fileName) const;
+
+private:
+  /**
+   * @brief getSliceFileName Returns the name of the file of @p slice. The slice index is only appended
+   * if there is more than one slice.
+   */
+  QString getSliceFileName(size_t slice, size_t maxSlice) const;
+
+  IDataArray::Pointer m_SliceSource;
+  size_t m_SliceSourceDimensions[3] = {0, 0, 0};
 
 public:
   ITKImageWriter(const ITKImageWriter&) = delete; // Copy Constructor Not Implemented
@@ -40,6 +40,7 @@
 #include "SIMPLib/FilterParameters/FileListInfoFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatVec3FilterParameter.h"
 #include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedChoicesFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -48,11 +49,66 @@
 
 #include "ITKImageProcessing/ITKImageProcessingConstants.h"
 #include "ITKImageProcessing/ITKImageProcessingVersion.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageIOFactoryMutex.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageIOMetaDataCache.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKSliceDecoder.h"
 #include "ITKImageProcessingPlugin.h"
 #include "SIMPLib/ITK/itkInPlaceImageToDream3DDataFilter.h"
 
 #include "itksys/SystemTools.hxx"
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+/**
+ * @brief The DecodeSlicesImpl class decodes a range of files of the stack, each one into its own slice
+ * of the output array.
+ */
+template <typename TPixel> class DecodeSlicesImpl
+{
+public:
+  DecodeSlicesImpl(const ITKSliceDecoder<TPixel>& decoder, const QVector<QString>& fileList, TPixel* data, std::vector<std::string>& errors, AbstractFilter* filter)
+  : m_Decoder(decoder)
+  , m_FileList(fileList)
+  , m_Data(data)
+  , m_Errors(errors)
+  , m_Filter(filter)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    const size_t numberOfPixels = m_Decoder.getNumberOfPixels();
+    for(size_t i = start; i < end; i++)
+    {
+      if(m_Filter->getCancel())
+      {
+        return;
+      }
+      m_Errors[i] = m_Decoder.decode(m_FileList[static_cast<int>(i)].toStdString(), m_Data + i * numberOfPixels);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const ITKSliceDecoder<TPixel>& m_Decoder;
+  const QVector<QString>& m_FileList;
+  TPixel* m_Data;
+  std::vector<std::string>& m_Errors;
+  AbstractFilter* m_Filter;
+};
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -61,6 +117,7 @@ ITKImportImageStack::ITKImportImageStack()
 , m_CellAttributeMatrixName(SIMPL::Defaults::CellAttributeMatrixName)
 , m_BoundsFile("")
 , m_ImageDataArrayName(SIMPL::CellData::ImageData)
+, m_NumberOfReaderThreads(0)
 {
   m_Origin.x = 0.0f;
   m_Origin.y = 0.0f;
@@ -91,6 +148,7 @@ void ITKImportImageStack::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_FILELISTINFO_FP("Input File List", InputFileListInfo, FilterParameter::Parameter, ITKImportImageStack));
   parameters.push_back(SIMPL_NEW_FLOAT_VEC3_FP("Origin", Origin, FilterParameter::Parameter, ITKImportImageStack, 0));
   parameters.push_back(SIMPL_NEW_FLOAT_VEC3_FP("Resolution", Resolution, FilterParameter::Parameter, ITKImportImageStack, 0));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Reader Threads (0: all cores)", NumberOfReaderThreads, FilterParameter::Parameter, ITKImportImageStack));
   parameters.push_back(SIMPL_NEW_STRING_FP("Data Container", DataContainerName, FilterParameter::CreatedArray, ITKImportImageStack));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Cell Attribute Matrix", CellAttributeMatrixName, FilterParameter::CreatedArray, ITKImportImageStack));
@@ -110,6 +168,7 @@ void ITKImportImageStack::readFilterParameters(AbstractFilterParametersReader* r
   setInputFileListInfo(reader->readFileListInfo("InputFileListInfo", getInputFileListInfo()));
   setOrigin(reader->readFloatVec3("Origin", getOrigin()));
   setResolution(reader->readFloatVec3("Resolution", getResolution()));
+  setNumberOfReaderThreads(reader->readValue("NumberOfReaderThreads", getNumberOfReaderThreads()));
   reader->closeFilterGroup();
 }
 
@@ -221,28 +280,23 @@ void ITKImportImageStack::readImage(const QVector<QString>& fileList, bool dataC
         return;
       }
     }
+    // The header of the first file is only parsed once per process, unless the file changes
     const QString filename = fileList[0];
-    itk::ImageIOBase::Pointer imageIO = itk::ImageIOFactory::CreateImageIO(filename.toLatin1(), itk::ImageIOFactory::ReadMode);
-    if(nullptr == imageIO)
+    ITKImageIOMetaDataCache::MetaData metaData;
+    const QString metaDataError = ITKImageIOMetaDataCache::Instance().getMetaData(filename, metaData);
+    if(!metaDataError.isEmpty())
     {
       setErrorCondition(-5);
-      QString errorMessage = "ITK could not read the given file \"%1\". Format is likely unsupported.";
-      notifyErrorMessage(getHumanLabel(), errorMessage.arg(filename), getErrorCondition());
+      notifyErrorMessage(getHumanLabel(), metaDataError, getErrorCondition());
       return;
     }
-    imageIO->SetFileName(filename.toLatin1());
-    imageIO->ReadImageInformation();
 
     using ComponentType = itk::ImageIOBase::IOComponentType;
-    const ComponentType type = imageIO->GetComponentType();
-    const unsigned int dimensions = imageIO->GetNumberOfDimensions();
+    const ComponentType type = metaData.componentType;
+    const size_t dimensions = metaData.dimensions.size();
     if(dimensions == 3)
     {
-      //      itk::ImageIOBase::SizeValueType dim0 = imageIO->GetDimensions(0);
-      //      itk::ImageIOBase::SizeValueType dim1 = imageIO->GetDimensions(1);
-      itk::ImageIOBase::SizeValueType dim2 = imageIO->GetDimensions(2);
-      // std::cout << "ITKImportImageStack: Input Image Dims: " << dim0 << ", " << dim1 << ", " << dim2 << std::endl;
-
+      const size_t dim2 = metaData.dimensions[2];
       if(dim2 != 1)
       {
         setErrorCondition(-2342342);
@@ -256,52 +310,75 @@ void ITKImportImageStack::readImage(const QVector<QString>& fileList, bool dataC
       QString msg;
       QTextStream out(&msg);
       out << "Slice image dimensions do not equal 2. The dimenions of the image are:";
-      for(unsigned int i = 0; i < dimensions; i++)
+      for(size_t i = 0; i < dimensions; i++)
       {
-        itk::ImageIOBase::SizeValueType dim = imageIO->GetDimensions(i);
-        out << dim;
+        out << metaData.dimensions[i];
         if(i != dimensions - 1)
         {
           out << ", ";
         }
       }
     }
+    // One slice per file
+    QVector<size_t> tDims(3, 1);
+    tDims[0] = dimensions > 0 ? metaData.dimensions[0] : 1;
+    tDims[1] = dimensions > 1 ? metaData.dimensions[1] : 1;
+    tDims[2] = static_cast<size_t>(fileList.size());
+
+    // The slices are decoded from clones of the ImageIO of the first file
+    itk::ImageIOBase::Pointer imageIO;
+    if(!dataCheck)
+    {
+      {
+        std::lock_guard<std::mutex> lock(ITKImageIOFactoryMutex());
+        imageIO = itk::ImageIOFactory::CreateImageIO(filename.toLatin1(), itk::ImageIOFactory::ReadMode);
+      }
+      if(nullptr == imageIO)
+      {
+        setErrorCondition(-5);
+        QString errorMessage = "ITK could not read the given file \"%1\". Format is likely unsupported.";
+        notifyErrorMessage(getHumanLabel(), errorMessage.arg(filename), getErrorCondition());
+        return;
+      }
+      imageIO->SetFileName(filename.toLatin1());
+      imageIO->ReadImageInformation();
+    }
 
     switch(type)
     {
     case itk::ImageIOBase::UCHAR:
-      readImageWithPixelType<unsigned char>(fileList, dataCheck);
+      readImageWithPixelType<unsigned char>(fileList, tDims, imageIO, dataCheck);
       break;
     case itk::ImageIOBase::CHAR:
-      readImageWithPixelType<char>(fileList, dataCheck);
+      readImageWithPixelType<char>(fileList, tDims, imageIO, dataCheck);
       break;
     case itk::ImageIOBase::USHORT:
-      readImageWithPixelType<unsigned short>(fileList, dataCheck);
+      readImageWithPixelType<unsigned short>(fileList, tDims, imageIO, dataCheck);
       break;
     case itk::ImageIOBase::SHORT:
-      readImageWithPixelType<short>(fileList, dataCheck);
+      readImageWithPixelType<short>(fileList, tDims, imageIO, dataCheck);
       break;
     case itk::ImageIOBase::UINT:
-      readImageWithPixelType<unsigned int>(fileList, dataCheck);
+      readImageWithPixelType<unsigned int>(fileList, tDims, imageIO, dataCheck);
       break;
     case itk::ImageIOBase::INT:
-      readImageWithPixelType<int>(fileList, dataCheck);
+      readImageWithPixelType<int>(fileList, tDims, imageIO, dataCheck);
       break;
     case itk::ImageIOBase::ULONG:
-      readImageWithPixelType<unsigned long>(fileList, dataCheck);
+      readImageWithPixelType<unsigned long>(fileList, tDims, imageIO, dataCheck);
       break;
     case itk::ImageIOBase::LONG:
-      readImageWithPixelType<long>(fileList, dataCheck);
+      readImageWithPixelType<long>(fileList, tDims, imageIO, dataCheck);
       break;
     case itk::ImageIOBase::FLOAT:
-      readImageWithPixelType<float>(fileList, dataCheck);
+      readImageWithPixelType<float>(fileList, tDims, imageIO, dataCheck);
       break;
     case itk::ImageIOBase::DOUBLE:
-      readImageWithPixelType<double>(fileList, dataCheck);
+      readImageWithPixelType<double>(fileList, tDims, imageIO, dataCheck);
       break;
     default:
       setErrorCondition(-4);
-      QString errorMessage = QString("Unsupported pixel type: %1.").arg(imageIO->GetComponentTypeAsString(type).c_str());
+      QString errorMessage = QString("Unsupported pixel type: %1.").arg(itk::ImageIOBase::GetComponentTypeAsString(type).c_str());
       notifyErrorMessage(getHumanLabel(), errorMessage, getErrorCondition());
       break;
     }
@@ -317,7 +394,7 @@ void ITKImportImageStack::readImage(const QVector<QString>& fileList, bool dataC
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename TPixel> void ITKImportImageStack::readImageWithPixelType(const QVector<QString>& fileList, bool dataCheck)
+template <typename TPixel> void ITKImportImageStack::readImageWithPixelType(const QVector<QString>& fileList, const QVector<size_t>& tDims, itk::ImageIOBase* imageIO, bool dataCheck)
 {
   DataContainer::Pointer container = getDataContainerArray()->getDataContainer(getDataContainerName());
   if(nullptr == container.get())
@@ -332,38 +409,52 @@ template <typename TPixel> void ITKImportImageStack::readImageWithPixelType(cons
   typedef itk::ImageSeriesReader<ImageType> ReaderType;
   typedef itk::InPlaceImageToDream3DDataFilter<TPixel, Dimension> ToDream3DType;
 
-  typename ReaderType::Pointer reader = ReaderType::New();
-  typename ReaderType::FileNamesContainer fileNames(fileList.size());
-  for(size_t fileIndex = 0; fileIndex < fileList.size(); ++fileIndex)
-  {
-    fileNames[fileIndex] = fileList[fileIndex].toStdString();
-  }
-  reader->SetFileNames(fileNames);
-
   if(dataCheck)
   {
-    readImageOutputInformation<TPixel>(reader, container);
+    readImageOutputInformation<TPixel>(tDims, container);
   }
   else
   {
-    typename ToDream3DType::Pointer toDream3DFilter = ToDream3DType::New();
-    toDream3DFilter->SetInput(reader->GetOutput());
-    toDream3DFilter->SetInPlace(true);
-    toDream3DFilter->SetAttributeMatrixArrayName(m_CellAttributeMatrixName.toStdString());
-    toDream3DFilter->SetDataArrayName(m_ImageDataArrayName.toStdString());
-    toDream3DFilter->SetDataContainer(container);
-    toDream3DFilter->Update();
+    typename ReaderType::Pointer reader = ReaderType::New();
+    typename ReaderType::FileNamesContainer fileNames(fileList.size());
+    for(size_t fileIndex = 0; fileIndex < fileList.size(); ++fileIndex)
+    {
+      fileNames[fileIndex] = fileList[fileIndex].toStdString();
+    }
+    reader->SetFileNames(fileNames);
+
+    // The array allocated by dataCheck() is filled in place when every file holds one slice of it
+    reader->UpdateOutputInformation();
+    const typename ImageType::SizeType size = reader->GetOutput()->GetLargestPossibleRegion().GetSize();
+    DataArrayPath path(getDataContainerName(), getCellAttributeMatrixName(), getImageDataArrayName());
+    typename DataArray<TPixel>::Pointer data = getDataContainerArray()->getPrereqArrayFromPath<DataArray<TPixel>, AbstractFilter>(this, path, QVector<size_t>(1, 1));
+    if(getErrorCondition() < 0)
+    {
+      return;
+    }
+    if(size[2] == static_cast<size_t>(fileList.size()) && data->getNumberOfTuples() == size[0] * size[1] * size[2] && imageIO->GetImageSizeInPixels() == size[0] * size[1])
+    {
+      decodeSlices<TPixel>(fileList, imageIO, *data);
+    }
+    else
+    {
+      typename ToDream3DType::Pointer toDream3DFilter = ToDream3DType::New();
+      toDream3DFilter->SetInput(reader->GetOutput());
+      toDream3DFilter->SetInPlace(true);
+      toDream3DFilter->SetAttributeMatrixArrayName(m_CellAttributeMatrixName.toStdString());
+      toDream3DFilter->SetDataArrayName(m_ImageDataArrayName.toStdString());
+      toDream3DFilter->SetDataContainer(container);
+      toDream3DFilter->Update();
+    }
+    if(getErrorCondition() < 0 || getCancel())
+    {
+      return;
+    }
   }
 
   ImageGeom::Pointer image = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
   image->setResolution(m_Resolution.x, m_Resolution.y, m_Resolution.z);
   image->setOrigin(m_Origin.x, m_Origin.y, m_Origin.z);
-  const typename ImageType::SizeType size = reader->GetOutput()->GetLargestPossibleRegion().GetSize();
-  QVector<size_t> tDims(Dimension, 1);
-  for(unsigned int i = 0; i < Dimension; i++)
-  {
-    tDims[i] = size[i];
-  }
   image->setDimensions(tDims[0], tDims[1], tDims[2]);
   container->setGeometry(image);
 }
@@ -371,19 +462,54 @@ template <typename TPixel> void ITKImportImageStack::readImageWithPixelType(cons
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
-template <typename TPixel> void ITKImportImageStack::readImageOutputInformation(typename itk::ImageSeriesReader<itk::Dream3DImage<TPixel, 3>>::Pointer& reader, DataContainer::Pointer& container)
+template <typename TPixel> void ITKImportImageStack::decodeSlices(const QVector<QString>& fileList, itk::ImageIOBase* imageIO, DataArray<TPixel>& data)
 {
-  const unsigned int Dimension = 3;
-  typedef itk::Dream3DImage<TPixel, Dimension> ImageType;
-
-  reader->UpdateOutputInformation();
-  const typename ImageType::SizeType size = reader->GetOutput()->GetLargestPossibleRegion().GetSize();
-  QVector<size_t> tDims(Dimension, 1);
-  for(unsigned int i = 0; i < Dimension; i++)
+  const ITKSliceDecoder<TPixel> decoder(imageIO);
+  const size_t numberOfSlices = static_cast<size_t>(fileList.size());
+  std::vector<std::string> errors(numberOfSlices);
+  DecodeSlicesImpl<TPixel> impl(decoder, fileList, data.getPointer(0), errors, this);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  const int numberOfThreads = m_NumberOfReaderThreads > 0 ? m_NumberOfReaderThreads : tbb::task_scheduler_init::default_num_threads();
+  tbb::task_arena arena(numberOfThreads);
+#else
+  const int numberOfThreads = 1;
+#endif
+  // Slices are decoded in chunks so that progress is reported in order and cancellation is checked
+  // regularly, while every thread of the arena still has a few files to decode in each chunk.
+  const size_t chunkSize = static_cast<size_t>(numberOfThreads) * 4;
+  for(size_t start = 0; start < numberOfSlices; start += chunkSize)
   {
-    tDims[i] = size[i];
+    if(getCancel())
+    {
+      return;
+    }
+    const size_t end = std::min(start + chunkSize, numberOfSlices);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    arena.execute([&] { tbb::parallel_for(tbb::blocked_range<size_t>(start, end, 1), impl, tbb::simple_partitioner()); });
+#else
+    impl.convert(start, end);
+#endif
+    for(size_t i = start; i < end; i++)
+    {
+      if(!errors[i].empty())
+      {
+        setErrorCondition(-55559);
+        QString errorMessage = "ITK exception was thrown while processing input file: %1";
+        notifyErrorMessage(getHumanLabel(), errorMessage.arg(QString::fromStdString(errors[i])), getErrorCondition());
+        return;
+      }
+    }
+    QString ss = QObject::tr("Imported %1 of %2 slices").arg(end).arg(numberOfSlices);
+    notifyStatusMessage(getHumanLabel(), ss);
   }
+}
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename TPixel> void ITKImportImageStack::readImageOutputInformation(const QVector<size_t>& tDims, DataContainer::Pointer& container)
+{
   QVector<size_t> cDims(1, 1);
   AttributeMatrix::Pointer cellAttrMat = container->createNonPrereqAttributeMatrix(this, m_CellAttributeMatrixName, tDims, AttributeMatrix::Type::Cell);
   if(getErrorCondition() < 0)
@@ -458,6 +584,7 @@ AbstractFilter::Pointer ITKImportImageStack::newFilterInstance(bool copyFilterPa
     SIMPL_COPY_INSTANCEVAR(InputFileListInfo)
     SIMPL_COPY_INSTANCEVAR(ImageStack)
     SIMPL_COPY_INSTANCEVAR(ImageDataArrayName)
+    SIMPL_COPY_INSTANCEVAR(NumberOfReaderThreads)
   }
   return filter;
 }
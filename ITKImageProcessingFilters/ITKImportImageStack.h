@@ -64,6 +64,7 @@ class ITKImageProcessing_EXPORT ITKImportImageStack : public AbstractFilter
   PYB11_PROPERTY(FileListInfo_t InputFileListInfo READ getInputFileListInfo WRITE setInputFileListInfo)
   PYB11_PROPERTY(int ImageStack READ getImageStack WRITE setImageStack)
   PYB11_PROPERTY(QString ImageDataArrayName READ getImageDataArrayName WRITE setImageDataArrayName)
+  PYB11_PROPERTY(int NumberOfReaderThreads READ getNumberOfReaderThreads WRITE setNumberOfReaderThreads)
 public:
   SIMPL_SHARED_POINTERS(ITKImportImageStack)
   SIMPL_FILTER_NEW_MACRO(ITKImportImageStack)
@@ -95,6 +96,9 @@ public:
   SIMPL_FILTER_PARAMETER(QString, ImageDataArrayName)
   Q_PROPERTY(QString ImageDataArrayName READ getImageDataArrayName WRITE setImageDataArrayName)
 
+  SIMPL_FILTER_PARAMETER(int, NumberOfReaderThreads)
+  Q_PROPERTY(int NumberOfReaderThreads READ getNumberOfReaderThreads WRITE setNumberOfReaderThreads)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -207,12 +211,22 @@ private:
    * is not read.
    */
   void readImage(const QVector<QString>& fileList, bool dataCheck);
-  template <typename TPixel> void readImageWithPixelType(const QVector<QString>& fileList, bool dataCheck);
+  /**
+   * @brief readImageWithPixelType Reads the stack as TPixel values. @p tDims is the size of the stack
+   * and @p imageIO the ImageIO of its first file, which is only needed when @p dataCheck is false.
+   */
+  template <typename TPixel> void readImageWithPixelType(const QVector<QString>& fileList, const QVector<size_t>& tDims, itk::ImageIOBase* imageIO, bool dataCheck);
+
+  /**
+   * @brief decodeSlices Decodes the files of the stack concurrently, each one straight into its slice of
+   * @p data. At most NumberOfReaderThreads files are decoded at once.
+   */
+  template <typename TPixel> void decodeSlices(const QVector<QString>& fileList, itk::ImageIOBase* imageIO, DataArray<TPixel>& data);
 
   /**
-  * @brief Reads image size, spacing and origin, and updates container information accordingly.
+  * @brief Creates the cell attribute matrix of size @p tDims and the (unallocated during preflight) image array.
   */
-  template <typename TPixel> void readImageOutputInformation(typename itk::ImageSeriesReader<itk::Dream3DImage<TPixel, 3>>::Pointer& reader, DataContainer::Pointer& container);
+  template <typename TPixel> void readImageOutputInformation(const QVector<size_t>& tDims, DataContainer::Pointer& container);
 
   DEFINE_DATAARRAY_VARIABLE(uint8_t, ImageData)
 
@@ -0,0 +1,718 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKLabelComponentsImage.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
+#include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
+#include "SIMPLib/FilterParameters/StringFilterParameter.h"
+
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "SIMPLib/ITK/Dream3DTemplateAliasMacro.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKParallelFor.h"
+
+namespace
+{
+// Slices (rows of 2D images) labeled by a task. It does not depend on the number of threads, so that
+// neither do the unions.
+const size_t k_BlockSlices = 4;
+const size_t k_BlockRows = 256;
+
+/**
+ * @brief The Run struct is a segment of foreground pixels of a row, from start to end (inclusive)
+ */
+struct Run
+{
+  uint32_t start;
+  uint32_t end;
+};
+
+/**
+ * @brief The ComponentLabeler class labels the connected components of the non-zero pixels of an image
+ * with a union-find over the runs of its rows.
+ *
+ * The rows are split in blocks of whole slices (whole rows for 2D images) whose runs are found and united
+ * in parallel, then the blocks are merged through the first slice (row) of each block. Every union links
+ * the root of larger index under the other, so that the root of a component is its first run in raster
+ * order and a single pass over the runs numbers the components in that order, as
+ * itk::ConnectedComponentImageFilter does. The size filtering and sorting of
+ * itk::RelabelComponentImageFilter only permute those numbers before the label image is written.
+ */
+class ComponentLabeler
+{
+public:
+  ComponentLabeler(size_t dimX, size_t dimY, size_t dimZ, ITKLabelComponentsImage::ConnectivityType connectivity)
+  : m_DimX(dimX)
+  , m_DimY(dimY)
+  , m_LineCount(dimY * dimZ)
+  , m_LinesPerBlock(dimZ > 1 ? dimY * k_BlockSlices : k_BlockRows)
+  , m_BorderLines(dimZ > 1 ? dimY : 1)
+  , m_Face(connectivity == ITKLabelComponentsImage::ConnectivityType::Face ? 0 : 1)
+  , m_Corner(connectivity == ITKLabelComponentsImage::ConnectivityType::FaceEdgeVertex ? 1 : 0)
+  , m_Diagonals(connectivity != ITKLabelComponentsImage::ConnectivityType::Face)
+  {
+    m_BlockCount = (m_LineCount + m_LinesPerBlock - 1) / m_LinesPerBlock;
+  }
+
+  /**
+   * @brief findRuns Finds the runs of non-zero pixels of @p data. The image is not used afterwards.
+   */
+  template <typename T> void findRuns(const T* data, int threads)
+  {
+    std::vector<std::vector<Run>> blockRuns(m_BlockCount);
+    m_LineStart.assign(m_LineCount + 1, 0);
+    ITKParallelFor::Run(threads, m_BlockCount, [&](size_t block) {
+      std::vector<Run>& runs = blockRuns[block];
+      for(size_t line = firstLine(block); line < lastLine(block); line++)
+      {
+        const T* row = data + line * m_DimX;
+        const size_t before = runs.size();
+        size_t x = 0;
+        while(x < m_DimX)
+        {
+          while(x < m_DimX && row[x] == static_cast<T>(0))
+          {
+            x++;
+          }
+          if(x == m_DimX)
+          {
+            break;
+          }
+          const size_t start = x;
+          while(x < m_DimX && row[x] != static_cast<T>(0))
+          {
+            x++;
+          }
+          runs.push_back({static_cast<uint32_t>(start), static_cast<uint32_t>(x - 1)});
+        }
+        m_LineStart[line + 1] = runs.size() - before;
+      }
+    });
+    for(size_t line = 0; line < m_LineCount; line++)
+    {
+      m_LineStart[line + 1] += m_LineStart[line];
+    }
+    m_Runs.resize(m_LineStart[m_LineCount]);
+    ITKParallelFor::Run(threads, m_BlockCount, [&](size_t block) {
+      std::copy(blockRuns[block].begin(), blockRuns[block].end(), m_Runs.begin() + m_LineStart[firstLine(block)]);
+      std::vector<Run>().swap(blockRuns[block]);
+    });
+  }
+
+  /**
+   * @brief unite Unites the overlapping runs of neighbor rows, block by block then across the blocks
+   */
+  void unite(int threads)
+  {
+    m_Parent.resize(m_Runs.size());
+    ITKParallelFor::Run(threads, m_BlockCount, [&](size_t block) {
+      const size_t first = firstLine(block);
+      for(size_t i = m_LineStart[first]; i < m_LineStart[lastLine(block)]; i++)
+      {
+        m_Parent[i] = i;
+      }
+      for(size_t line = first; line < lastLine(block); line++)
+      {
+        forEachPreviousLine(line, [&](size_t previous, uint32_t tolerance) {
+          if(previous >= first)
+          {
+            merge(line, previous, tolerance);
+          }
+        });
+      }
+    });
+    // Only the first slice of a block has neighbors in the previous one
+    for(size_t block = 1; block < m_BlockCount; block++)
+    {
+      const size_t first = firstLine(block);
+      for(size_t line = first; line < std::min(first + m_BorderLines, lastLine(block)); line++)
+      {
+        forEachPreviousLine(line, [&](size_t previous, uint32_t tolerance) {
+          if(previous < first)
+          {
+            merge(line, previous, tolerance);
+          }
+        });
+      }
+    }
+  }
+
+  /**
+   * @brief resolve Numbers the components in raster order and measures them
+   * @return The number of components
+   */
+  size_t resolve()
+  {
+    // The parent of a run precedes it: once the preceding runs hold their component number, the parent of
+    // a run gives its own. The parents are replaced by the numbers in place.
+    m_Sizes.assign(1, 0);
+    for(size_t i = 0; i < m_Parent.size(); i++)
+    {
+      const size_t parent = m_Parent[i];
+      if(parent == i)
+      {
+        m_Parent[i] = m_Sizes.size();
+        m_Sizes.push_back(0);
+      }
+      else
+      {
+        m_Parent[i] = m_Parent[parent];
+      }
+      m_Sizes[m_Parent[i]] += m_Runs[i].end - m_Runs[i].start + 1;
+    }
+    return m_Sizes.size() - 1;
+  }
+
+  /**
+   * @brief relabel Removes the components of less than @p minimumSize pixels and, if @p sort is set,
+   * numbers the others by decreasing size (by raster order for equal sizes)
+   * @return The number of remaining components
+   */
+  size_t relabel(uint64_t minimumSize, bool sort)
+  {
+    std::vector<size_t> kept;
+    kept.reserve(m_Sizes.size() - 1);
+    for(size_t component = 1; component < m_Sizes.size(); component++)
+    {
+      if(m_Sizes[component] >= minimumSize)
+      {
+        kept.push_back(component);
+      }
+    }
+    if(sort)
+    {
+      std::stable_sort(kept.begin(), kept.end(), [this](size_t a, size_t b) { return m_Sizes[a] > m_Sizes[b]; });
+    }
+    m_Labels.assign(m_Sizes.size(), 0);
+    for(size_t i = 0; i < kept.size(); i++)
+    {
+      m_Labels[kept[i]] = i + 1;
+    }
+    return kept.size();
+  }
+
+  /**
+   * @brief write Writes the label of every pixel in @p labels
+   */
+  template <typename L> void write(L* labels, int threads) const
+  {
+    ITKParallelFor::Run(threads, m_BlockCount, [&](size_t block) {
+      for(size_t line = firstLine(block); line < lastLine(block); line++)
+      {
+        L* row = labels + line * m_DimX;
+        std::fill(row, row + m_DimX, static_cast<L>(0));
+        for(size_t i = m_LineStart[line]; i < m_LineStart[line + 1]; i++)
+        {
+          std::fill(row + m_Runs[i].start, row + m_Runs[i].end + 1, static_cast<L>(m_Labels[m_Parent[i]]));
+        }
+      }
+    });
+  }
+
+private:
+  size_t m_DimX;
+  size_t m_DimY;
+  size_t m_LineCount;
+  size_t m_LinesPerBlock;
+  size_t m_BorderLines;
+  size_t m_BlockCount;
+  uint32_t m_Face;
+  uint32_t m_Corner;
+  bool m_Diagonals;
+
+  std::vector<size_t> m_LineStart;
+  std::vector<Run> m_Runs;
+  std::vector<size_t> m_Parent;
+  std::vector<uint64_t> m_Sizes;
+  std::vector<uint64_t> m_Labels;
+
+  size_t firstLine(size_t block) const
+  {
+    return block * m_LinesPerBlock;
+  }
+
+  size_t lastLine(size_t block) const
+  {
+    return std::min((block + 1) * m_LinesPerBlock, m_LineCount);
+  }
+
+  /**
+   * @brief forEachPreviousLine Calls @p function(previous, tolerance) for the rows preceding @p line that
+   * hold neighbors of its pixels. Two runs of those rows touch when their X ranges are at most tolerance
+   * pixels apart.
+   */
+  template <typename F> void forEachPreviousLine(size_t line, F function) const
+  {
+    const size_t y = line % m_DimY;
+    if(y > 0)
+    {
+      function(line - 1, m_Face);
+    }
+    if(line >= m_DimY)
+    {
+      const size_t below = line - m_DimY;
+      function(below, m_Face);
+      if(m_Diagonals && y > 0)
+      {
+        function(below - 1, m_Corner);
+      }
+      if(m_Diagonals && y + 1 < m_DimY)
+      {
+        function(below + 1, m_Corner);
+      }
+    }
+  }
+
+  /**
+   * @brief merge Unites the runs of rows @p a and @p b that touch
+   */
+  void merge(size_t a, size_t b, uint32_t tolerance)
+  {
+    size_t i = m_LineStart[a];
+    size_t j = m_LineStart[b];
+    while(i < m_LineStart[a + 1] && j < m_LineStart[b + 1])
+    {
+      const Run& r = m_Runs[i];
+      const Run& s = m_Runs[j];
+      if(static_cast<uint64_t>(r.start) <= static_cast<uint64_t>(s.end) + tolerance && static_cast<uint64_t>(s.start) <= static_cast<uint64_t>(r.end) + tolerance)
+      {
+        link(i, j);
+      }
+      // The run ending first cannot touch the next run of the other row
+      if(r.end < s.end)
+      {
+        i++;
+      }
+      else
+      {
+        j++;
+      }
+    }
+  }
+
+  size_t find(size_t i)
+  {
+    while(m_Parent[i] != i)
+    {
+      m_Parent[i] = m_Parent[m_Parent[i]];
+      i = m_Parent[i];
+    }
+    return i;
+  }
+
+  void link(size_t i, size_t j)
+  {
+    i = find(i);
+    j = find(j);
+    if(i < j)
+    {
+      m_Parent[j] = i;
+    }
+    else if(j < i)
+    {
+      m_Parent[i] = j;
+    }
+  }
+};
+
+/**
+ * @brief SmallestLabelType Returns the smallest label type holding @p count labels
+ */
+ITKLabelComponentsImage::LabelArrayType SmallestLabelType(size_t count)
+{
+  if(count <= std::numeric_limits<uint8_t>::max())
+  {
+    return ITKLabelComponentsImage::LabelArrayType::UInt8;
+  }
+  if(count <= std::numeric_limits<uint16_t>::max())
+  {
+    return ITKLabelComponentsImage::LabelArrayType::UInt16;
+  }
+  if(count <= std::numeric_limits<uint32_t>::max())
+  {
+    return ITKLabelComponentsImage::LabelArrayType::UInt32;
+  }
+  return ITKLabelComponentsImage::LabelArrayType::UInt64;
+}
+
+/**
+ * @brief MaximumLabel Returns the largest label of @p type
+ */
+uint64_t MaximumLabel(ITKLabelComponentsImage::LabelArrayType type)
+{
+  switch(type)
+  {
+  case ITKLabelComponentsImage::LabelArrayType::UInt8:
+    return std::numeric_limits<uint8_t>::max();
+  case ITKLabelComponentsImage::LabelArrayType::UInt16:
+    return std::numeric_limits<uint16_t>::max();
+  case ITKLabelComponentsImage::LabelArrayType::UInt32:
+    return std::numeric_limits<uint32_t>::max();
+  default:
+    return std::numeric_limits<uint64_t>::max();
+  }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKLabelComponentsImage::ITKLabelComponentsImage()
+: m_Connectivity(static_cast<int>(ConnectivityType::Face))
+, m_MinimumObjectSize(0)
+, m_SortByObjectSize(false)
+, m_LabelType(static_cast<int>(LabelArrayType::UInt32))
+, m_ObjectCount(0.0)
+, m_OriginalObjectCount(0.0)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKLabelComponentsImage::~ITKLabelComponentsImage() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKLabelComponentsImage::setupFilterParameters()
+{
+  FilterParameterVector parameters;
+
+  {
+    ChoiceFilterParameter::Pointer parameter = ChoiceFilterParameter::New();
+    parameter->setHumanLabel("Connectivity");
+    parameter->setPropertyName("Connectivity");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(ITKLabelComponentsImage, this, Connectivity));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(ITKLabelComponentsImage, this, Connectivity));
+
+    QVector<QString> choices;
+    choices.push_back("Faces (6, 4 in 2D)");
+    choices.push_back("Faces and Edges (18, 8 in 2D)");
+    choices.push_back("Faces, Edges and Vertices (26, 8 in 2D)");
+    parameter->setChoices(choices);
+    parameter->setCategory(FilterParameter::Parameter);
+    parameters.push_back(parameter);
+  }
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Minimum Object Size", MinimumObjectSize, FilterParameter::Parameter, ITKLabelComponentsImage));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Sort By Object Size", SortByObjectSize, FilterParameter::Parameter, ITKLabelComponentsImage));
+  {
+    ChoiceFilterParameter::Pointer parameter = ChoiceFilterParameter::New();
+    parameter->setHumanLabel("Label Type");
+    parameter->setPropertyName("LabelType");
+    parameter->setSetterCallback(SIMPL_BIND_SETTER(ITKLabelComponentsImage, this, LabelType));
+    parameter->setGetterCallback(SIMPL_BIND_GETTER(ITKLabelComponentsImage, this, LabelType));
+
+    QVector<QString> choices;
+    choices.push_back("Smallest fitting type");
+    choices.push_back("unsigned char");
+    choices.push_back("unsigned short");
+    choices.push_back("unsigned int");
+    choices.push_back("unsigned long");
+    parameter->setChoices(choices);
+    parameter->setCategory(FilterParameter::Parameter);
+    parameters.push_back(parameter);
+  }
+
+  QStringList linkedProps;
+  linkedProps << "NewCellArrayName";
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKLabelComponentsImage, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKLabelComponentsImage));
+  parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
+  {
+    DataArraySelectionFilterParameter::RequirementType req =
+        DataArraySelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, 1, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Attribute Array to filter", SelectedCellArrayPath, FilterParameter::RequiredArray, ITKLabelComponentsImage, req));
+  }
+  parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::CreatedArray));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Filtered Array", NewCellArrayName, FilterParameter::CreatedArray, ITKLabelComponentsImage));
+
+  setFilterParameters(parameters);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKLabelComponentsImage::readFilterParameters(AbstractFilterParametersReader* reader, int index)
+{
+  reader->openFilterGroup(this, index);
+  setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
+  setNewCellArrayName(reader->readString("NewCellArrayName", getNewCellArrayName()));
+  setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
+  setConnectivity(reader->readValue("Connectivity", getConnectivity()));
+  setMinimumObjectSize(reader->readValue("MinimumObjectSize", getMinimumObjectSize()));
+  setSortByObjectSize(reader->readValue("SortByObjectSize", getSortByObjectSize()));
+  setLabelType(reader->readValue("LabelType", getLabelType()));
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
+  reader->closeFilterGroup();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKLabelComponentsImage::dataCheck()
+{
+  setErrorCondition(0);
+  setWarningCondition(0);
+
+  // Check consistency of parameters
+  if(m_Connectivity < static_cast<int>(ConnectivityType::Face) || m_Connectivity > static_cast<int>(ConnectivityType::FaceEdgeVertex))
+  {
+    setErrorCondition(-55600);
+    notifyErrorMessage(getHumanLabel(), "Unsupported connectivity", getErrorCondition());
+    return;
+  }
+  if(m_LabelType < static_cast<int>(LabelArrayType::Smallest) || m_LabelType > static_cast<int>(LabelArrayType::UInt64))
+  {
+    setErrorCondition(-55601);
+    notifyErrorMessage(getHumanLabel(), "Unsupported label type", getErrorCondition());
+    return;
+  }
+  if(m_MinimumObjectSize < 0)
+  {
+    setErrorCondition(-55602);
+    notifyErrorMessage(getHumanLabel(), "The minimum object size must be positive or zero", getErrorCondition());
+    return;
+  }
+
+  imageCheck<InputPixelType, Dimension>(getSelectedCellArrayPath());
+  if(getErrorCondition() < 0 || !getSaveAsNewArray())
+  {
+    return;
+  }
+
+  // The label array is created once the objects are counted, by filter(). The preflight shows it with
+  // unsigned int labels when the type is not fixed.
+  DataArrayPath labelPath(getSelectedCellArrayPath().getDataContainerName(), getSelectedCellArrayPath().getAttributeMatrixName(), getNewCellArrayName());
+  if(!getInPreflight())
+  {
+    AttributeMatrix::Pointer attrMat = getDataContainerArray()->getAttributeMatrix(labelPath);
+    if(getNewCellArrayName().isEmpty() || attrMat->doesAttributeArrayExist(getNewCellArrayName()))
+    {
+      setErrorCondition(-55603);
+      notifyErrorMessage(getHumanLabel(), QString("The name '%1' is not available for the label array").arg(getNewCellArrayName()), getErrorCondition());
+    }
+    return;
+  }
+  QVector<size_t> cDims(1, 1);
+  switch(static_cast<LabelArrayType>(m_LabelType))
+  {
+  case LabelArrayType::UInt8:
+    getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<uint8_t>, AbstractFilter, uint8_t>(this, labelPath, 0, cDims);
+    break;
+  case LabelArrayType::UInt16:
+    getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<uint16_t>, AbstractFilter, uint16_t>(this, labelPath, 0, cDims);
+    break;
+  case LabelArrayType::UInt64:
+    getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<uint64_t>, AbstractFilter, uint64_t>(this, labelPath, 0, cDims);
+    break;
+  default:
+    getDataContainerArray()->createNonPrereqArrayFromPath<DataArray<uint32_t>, AbstractFilter, uint32_t>(this, labelPath, 0, cDims);
+    break;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKLabelComponentsImage::dataCheckInternal()
+{
+  IDataArray::Pointer inputArray = getDataContainerArray()->getPrereqIDataArrayFromPath<IDataArray, AbstractFilter>(this, getSelectedCellArrayPath());
+  if(getErrorCondition() < 0)
+  {
+    return;
+  }
+  if(inputArray->getNumberOfComponents() != 1)
+  {
+    setErrorCondition(-55604);
+    notifyErrorMessage(getHumanLabel(), "The labeled array must have a single component", getErrorCondition());
+    return;
+  }
+  Dream3DArraySwitchMacro(this->dataCheck, getSelectedCellArrayPath(), -4);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename LabelValueType> typename DataArray<LabelValueType>::Pointer ITKLabelComponentsImage::createLabelArray(size_t numberOfTuples)
+{
+  AttributeMatrix::Pointer attrMat = getDataContainerArray()->getAttributeMatrix(getSelectedCellArrayPath());
+  QString name = getNewCellArrayName();
+  if(!getSaveAsNewArray())
+  {
+    name = getSelectedCellArrayPath().getDataArrayName();
+    attrMat->removeAttributeArray(name);
+  }
+  typename DataArray<LabelValueType>::Pointer labels = DataArray<LabelValueType>::CreateArray(numberOfTuples, QVector<size_t>(1, 1), name, true);
+  attrMat->addAttributeArray(name, labels);
+  return labels;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKLabelComponentsImage::filter()
+{
+  using ValueType = typename itk::NumericTraits<InputPixelType>::ValueType;
+  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getSelectedCellArrayPath().getDataContainerName());
+  AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix(getSelectedCellArrayPath().getAttributeMatrixName());
+  typename DataArray<ValueType>::Pointer input = std::dynamic_pointer_cast<DataArray<ValueType>>(attrMat->getAttributeArray(getSelectedCellArrayPath().getDataArrayName()));
+  ImageGeom::Pointer imageGeom = dc->getGeometryAs<ImageGeom>();
+  size_t dims[3] = {0, 0, 0};
+  std::tie(dims[0], dims[1], dims[2]) = imageGeom->getDimensions();
+  if(nullptr == input || dims[0] * dims[1] * dims[2] == 0)
+  {
+    return;
+  }
+
+  const int threads = ITKThreadingPolicy::Instance().getNumberOfThreads(getNumberOfThreads());
+  ComponentLabeler labeler(dims[0], dims[1], dims[2], static_cast<ConnectivityType>(m_Connectivity));
+  size_t count = 0;
+  {
+    ITKThreadingPolicy::AffinityScope affinity;
+    ITKDataStructureLock::Release release;
+    labeler.findRuns(input->getPointer(0), threads);
+    if(getCancel())
+    {
+      return;
+    }
+    notifyStatusMessage(getHumanLabel(), "Uniting the runs of pixels");
+    labeler.unite(threads);
+    m_OriginalObjectCount = static_cast<double>(labeler.resolve());
+    count = labeler.relabel(static_cast<uint64_t>(m_MinimumObjectSize), m_SortByObjectSize);
+    m_ObjectCount = static_cast<double>(count);
+  }
+  input = nullptr;
+  if(getCancel())
+  {
+    return;
+  }
+
+  LabelArrayType type = static_cast<LabelArrayType>(m_LabelType);
+  if(type == LabelArrayType::Smallest)
+  {
+    type = SmallestLabelType(count);
+  }
+  else if(count > MaximumLabel(type))
+  {
+    setErrorCondition(-55605);
+    notifyErrorMessage(getHumanLabel(), QString("The %1 objects do not fit in the selected label type").arg(count), getErrorCondition());
+    return;
+  }
+
+  // Without Save as New Array, the input is removed before the labels are allocated
+  const size_t numberOfTuples = dims[0] * dims[1] * dims[2];
+  switch(type)
+  {
+  case LabelArrayType::UInt8:
+  {
+    uint8_t* labels = createLabelArray<uint8_t>(numberOfTuples)->getPointer(0);
+    ITKThreadingPolicy::AffinityScope affinity;
+    ITKDataStructureLock::Release release;
+    labeler.write(labels, threads);
+    break;
+  }
+  case LabelArrayType::UInt16:
+  {
+    uint16_t* labels = createLabelArray<uint16_t>(numberOfTuples)->getPointer(0);
+    ITKThreadingPolicy::AffinityScope affinity;
+    ITKDataStructureLock::Release release;
+    labeler.write(labels, threads);
+    break;
+  }
+  case LabelArrayType::UInt32:
+  {
+    uint32_t* labels = createLabelArray<uint32_t>(numberOfTuples)->getPointer(0);
+    ITKThreadingPolicy::AffinityScope affinity;
+    ITKDataStructureLock::Release release;
+    labeler.write(labels, threads);
+    break;
+  }
+  default:
+  {
+    uint64_t* labels = createLabelArray<uint64_t>(numberOfTuples)->getPointer(0);
+    ITKThreadingPolicy::AffinityScope affinity;
+    ITKDataStructureLock::Release release;
+    labeler.write(labels, threads);
+    break;
+  }
+  }
+
+  {
+    QString outputVal = "ObjectCount :%1";
+    notifyWarningMessage(getHumanLabel(), outputVal.arg(m_ObjectCount), 0);
+  }
+  {
+    QString outputVal = "OriginalObjectCount :%1";
+    notifyWarningMessage(getHumanLabel(), outputVal.arg(m_OriginalObjectCount), 0);
+  }
+  notifyStatusMessage(getHumanLabel(), "Complete");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKLabelComponentsImage::filterInternal()
+{
+  Dream3DArraySwitchMacro(this->filter, getSelectedCellArrayPath(), -4);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKLabelComponentsImage::canRunConcurrently() const
+{
+  // The label array is created by the filter itself, its type is not known before
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer ITKLabelComponentsImage::newFilterInstance(bool copyFilterParameters) const
+{
+  ITKLabelComponentsImage::Pointer filter = ITKLabelComponentsImage::New();
+  if(true == copyFilterParameters)
+  {
+    copyFilterParameterInstanceVariables(filter.get());
+  }
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString ITKLabelComponentsImage::getHumanLabel() const
+{
+  return "ITK::Label Components Image Filter";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QUuid ITKLabelComponentsImage::getUuid()
+{
+  return QUuid("{8e2f6c3a-41d7-4b95-a0c8-73e5d19b4f26}");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString ITKLabelComponentsImage::getSubGroupName() const
+{
+  return "ITK SegmentationPostProcessing";
+}
@@ -0,0 +1,158 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Winconsistent-missing-override"
+#endif
+
+#include "ITKImageProcessingBase.h"
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+
+/**
+ * @brief The ITKLabelComponentsImage class. See [Filter documentation](@ref ITKLabelComponentsImage) for details.
+ */
+class ITKImageProcessing_EXPORT ITKLabelComponentsImage : public ITKImageProcessingBase
+{
+  Q_OBJECT
+  PYB11_CREATE_BINDINGS(ITKLabelComponentsImage SUPERCLASS ITKImageProcessingBase)
+  PYB11_PROPERTY(int Connectivity READ getConnectivity WRITE setConnectivity)
+  PYB11_PROPERTY(int MinimumObjectSize READ getMinimumObjectSize WRITE setMinimumObjectSize)
+  PYB11_PROPERTY(bool SortByObjectSize READ getSortByObjectSize WRITE setSortByObjectSize)
+  PYB11_PROPERTY(int LabelType READ getLabelType WRITE setLabelType)
+  PYB11_PROPERTY(double ObjectCount READ getObjectCount WRITE setObjectCount)
+  PYB11_PROPERTY(double OriginalObjectCount READ getOriginalObjectCount WRITE setOriginalObjectCount)
+
+public:
+  SIMPL_SHARED_POINTERS(ITKLabelComponentsImage)
+  SIMPL_FILTER_NEW_MACRO(ITKLabelComponentsImage)
+  SIMPL_TYPE_MACRO_SUPER_OVERRIDE(ITKLabelComponentsImage, AbstractFilter)
+
+  ~ITKLabelComponentsImage() override;
+
+  /**
+   * @brief The ConnectivityType enum lists the neighbors of a pixel (in 2D, Face is 4-connectivity and the
+   * others 8-connectivity)
+   */
+  enum class ConnectivityType : int
+  {
+    Face = 0,          // 6 neighbors
+    FaceEdge = 1,      // 18 neighbors
+    FaceEdgeVertex = 2 // 26 neighbors
+  };
+
+  /**
+   * @brief The LabelArrayType enum lists the types of the label array. Smallest picks the smallest unsigned
+   * type holding the number of objects once they are counted, so the preflight cannot report it (it reports
+   * UInt32, the default).
+   */
+  enum class LabelArrayType : int
+  {
+    Smallest = 0,
+    UInt8 = 1,
+    UInt16 = 2,
+    UInt32 = 3,
+    UInt64 = 4
+  };
+
+  SIMPL_FILTER_PARAMETER(int, Connectivity)
+  Q_PROPERTY(int Connectivity READ getConnectivity WRITE setConnectivity)
+
+  SIMPL_FILTER_PARAMETER(int, MinimumObjectSize)
+  Q_PROPERTY(int MinimumObjectSize READ getMinimumObjectSize WRITE setMinimumObjectSize)
+
+  SIMPL_FILTER_PARAMETER(bool, SortByObjectSize)
+  Q_PROPERTY(bool SortByObjectSize READ getSortByObjectSize WRITE setSortByObjectSize)
+
+  SIMPL_FILTER_PARAMETER(int, LabelType)
+  Q_PROPERTY(int LabelType READ getLabelType WRITE setLabelType)
+
+  SIMPL_FILTER_PARAMETER(double, ObjectCount)
+  Q_PROPERTY(double ObjectCount READ getObjectCount)
+
+  SIMPL_FILTER_PARAMETER(double, OriginalObjectCount)
+  Q_PROPERTY(double OriginalObjectCount READ getOriginalObjectCount)
+
+  /**
+   * @brief newFilterInstance Reimplemented from @see AbstractFilter class
+   */
+  AbstractFilter::Pointer newFilterInstance(bool copyFilterParameters) const override;
+
+  /**
+   * @brief getHumanLabel Reimplemented from @see AbstractFilter class
+   */
+  const QString getHumanLabel() const override;
+
+  /**
+   * @brief getSubGroupName Reimplemented from @see AbstractFilter class
+   */
+  const QString getSubGroupName() const override;
+
+  /**
+   * @brief getUuid Return the unique identifier for this filter.
+   * @return A QUuid object.
+   */
+  const QUuid getUuid() override;
+
+  /**
+   * @brief setupFilterParameters Reimplemented from @see AbstractFilter class
+   */
+  void setupFilterParameters() override;
+
+  /**
+   * @brief readFilterParameters Reimplemented from @see AbstractFilter class
+   */
+  void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
+
+  /**
+   * @brief canRunConcurrently Reimplemented from @see ITKImageBase class. The label array is created
+   * once the objects are counted.
+   */
+  bool canRunConcurrently() const override;
+
+protected:
+  ITKLabelComponentsImage();
+
+  /**
+   * @brief dataCheckInternal overloads dataCheckInternal in ITKImageBase and calls templated dataCheck
+   */
+  void virtual dataCheckInternal() override;
+
+  /**
+   * @brief dataCheck Checks for the appropriate parameter values and availability of arrays
+   */
+  template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void dataCheck();
+
+  /**
+   * @brief filterInternal overloads filterInternal in ITKImageBase and calls templated filter
+   */
+  void virtual filterInternal() override;
+
+  /**
+   * @brief Labels the components and writes the label array
+   */
+  template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void filter();
+
+  /**
+   * @brief createLabelArray Creates the label array with @p LabelValueType values, in place of the input
+   * array unless Save as New Array is set
+   */
+  template <typename LabelValueType> typename DataArray<LabelValueType>::Pointer createLabelArray(size_t numberOfTuples);
+
+private:
+  ITKLabelComponentsImage(const ITKLabelComponentsImage&) = delete;            // Copy Constructor Not Implemented
+  ITKLabelComponentsImage(ITKLabelComponentsImage&&) = delete;                 // Move Constructor Not Implemented
+  ITKLabelComponentsImage& operator=(const ITKLabelComponentsImage&) = delete; // Copy Assignment Not Implemented
+  ITKLabelComponentsImage& operator=(ITKLabelComponentsImage&&) = delete;      // Move Assignment Not Implemented
+};
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
@@ -10,6 +10,7 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -19,6 +20,8 @@
 #include "SIMPLib/ITK/Dream3DTemplateAliasMacro.h"
 #include "SIMPLib/ITK/itkDream3DImage.h"
 
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKScaleSpace.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -48,6 +51,7 @@ void ITKLaplacianRecursiveGaussianImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKLaplacianRecursiveGaussianImage, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKLaplacianRecursiveGaussianImage));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -72,6 +76,7 @@ void ITKLaplacianRecursiveGaussianImage::readFilterParameters(AbstractFilterPara
   setSigma(reader->readValue("Sigma", getSigma()));
   setNormalizeAcrossScale(reader->readValue("NormalizeAcrossScale", getNormalizeAcrossScale()));
 
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
   reader->closeFilterGroup();
 }
 
@@ -101,6 +106,50 @@ void ITKLaplacianRecursiveGaussianImage::dataCheckInternal()
 // -----------------------------------------------------------------------------
 
 template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKLaplacianRecursiveGaussianImage::filter()
+{
+  // The scale space cache holds images of scalar pixels
+  this->filter<InputPixelType, OutputPixelType, Dimension>(std::is_arithmetic<InputPixelType>());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKLaplacianRecursiveGaussianImage::filter(std::true_type)
+{
+  typedef ITKScaleSpace<InputPixelType, Dimension> ScaleSpaceType;
+  const double sigma = static_cast<double>(m_Sigma);
+  const bool normalizeAcrossScale = static_cast<bool>(m_NormalizeAcrossScale);
+  auto compute = [sigma, normalizeAcrossScale](ScaleSpaceType& scaleSpace) {
+    typename itk::Dream3DImage<OutputPixelType, Dimension>::Pointer output = scaleSpace.template createImage<OutputPixelType>();
+    OutputPixelType* laplacian = output->GetBufferPointer();
+    const size_t numberOfPixels = output->GetLargestPossibleRegion().GetNumberOfPixels();
+    std::fill(laplacian, laplacian + numberOfPixels, static_cast<OutputPixelType>(0));
+    for(unsigned int d = 0; d < Dimension; d++)
+    {
+      std::array<int, Dimension> orders;
+      orders.fill(0);
+      orders[d] = 2;
+      typename ScaleSpaceType::RealImageType::Pointer derivative = scaleSpace.get(ScaleSpaceType::Derivative(sigma, orders, normalizeAcrossScale));
+      const typename ScaleSpaceType::RealPixelType* values = derivative->GetBufferPointer();
+      const double spacing = output->GetSpacing()[d];
+      const double scale = 1.0 / (spacing * spacing);
+      for(size_t i = 0; i < numberOfPixels; i++)
+      {
+        laplacian[i] += static_cast<OutputPixelType>(values[i] * scale);
+      }
+    }
+    return output;
+  };
+  if(!this->filterScaleSpace<InputPixelType, OutputPixelType, Dimension>(compute))
+  {
+    this->filter<InputPixelType, OutputPixelType, Dimension>(std::false_type());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKLaplacianRecursiveGaussianImage::filter(std::false_type)
 {
   typedef itk::Dream3DImage<InputPixelType, Dimension> InputImageType;
   typedef itk::Dream3DImage<OutputPixelType, Dimension> OutputImageType;
@@ -110,7 +159,6 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
   filter->SetSigma(static_cast<double>(m_Sigma));
   filter->SetNormalizeAcrossScale(static_cast<bool>(m_NormalizeAcrossScale));
   this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
-
 }
 
 // -----------------------------------------------------------------------------
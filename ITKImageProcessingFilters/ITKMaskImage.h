@@ -76,6 +76,11 @@ public:
    */
   void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
 
+  /**
+   * @brief canRunConcurrently Reimplemented from @see ITKImageBase class
+   */
+  bool canRunConcurrently() const override;
+
 protected:
   SIMPL_INSTANCE_PROPERTY(DataContainerArray::Pointer, MaskContainerArray)
 
@@ -20,6 +20,8 @@
 #include <SIMPLib/FilterParameters/FloatVec3FilterParameter.h>
 #include <itkMedianImageFilter.h>
 
+#include <type_traits>
+
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
 
 /**
@@ -73,6 +75,11 @@ public:
    */
   void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  bool isStreamable() const override;
+
 protected:
   ITKMedianImage();
 
@@ -96,6 +103,17 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+  * @brief Applies itk::HistogramMedianImageFilter, whose cost does not grow with the volume of the
+  * neighborhood, to 8 and 16 bit integer pixels
+  */
+  template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter(std::true_type histogramEngine);
+
+  /**
+  * @brief Applies itk::MedianImageFilter to the other pixel types
+  */
+  template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter(std::false_type histogramEngine);
+
 private:
   ITKMedianImage(const ITKMedianImage&) = delete;    // Copy Constructor Not Implemented
   ITKMedianImage(ITKMedianImage&&) = delete;         // Move Constructor Not Implemented
@@ -10,6 +10,7 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -19,6 +20,10 @@
 #include "SIMPLib/ITK/Dream3DTemplateAliasMacro.h"
 #include "SIMPLib/ITK/itkDream3DImage.h"
 
+#include <itkMinMaxCurvatureFlowFunction.h>
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkIterativeDiffusionImageFilter.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -50,6 +55,7 @@ void ITKMinMaxCurvatureFlowImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKMinMaxCurvatureFlowImage, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKMinMaxCurvatureFlowImage));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -75,6 +81,7 @@ void ITKMinMaxCurvatureFlowImage::readFilterParameters(AbstractFilterParametersR
   setNumberOfIterations(reader->readValue("NumberOfIterations", getNumberOfIterations()));
   setStencilRadius(reader->readValue("StencilRadius", getStencilRadius()));
 
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
   reader->closeFilterGroup();
 }
 
@@ -105,6 +112,34 @@ void ITKMinMaxCurvatureFlowImage::dataCheckInternal()
 // -----------------------------------------------------------------------------
 
 template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKMinMaxCurvatureFlowImage::filter()
+{
+  // The ping-pong engine reads and writes scalar pixels directly
+  this->filter<InputPixelType, OutputPixelType, Dimension>(std::is_arithmetic<InputPixelType>());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKMinMaxCurvatureFlowImage::filter(std::true_type)
+{
+  typedef typename itk::NumericTraits<InputPixelType>::RealType RealPixelType;
+  typedef itk::Image<RealPixelType, Dimension> RealImageType;
+  typedef itk::MinMaxCurvatureFlowFunction<RealImageType> FunctionType;
+  typedef itk::IterativeDiffusionImageFilter<itk::Dream3DImage<InputPixelType, Dimension>, itk::Dream3DImage<InputPixelType, Dimension>, FunctionType> FilterType;
+
+  typename FunctionType::Pointer function = FunctionType::New();
+  function->SetTimeStep(static_cast<double>(m_TimeStep));
+  function->SetStencilRadius(static_cast<int>(m_StencilRadius));
+  typename FilterType::Pointer filter = FilterType::New();
+  filter->SetDifferenceFunction(function);
+  filter->SetNumberOfIterations(static_cast<uint32_t>(m_NumberOfIterations));
+  this->ITKImageProcessingBase::filter<InputPixelType, InputPixelType, Dimension, FilterType>(filter);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKMinMaxCurvatureFlowImage::filter(std::false_type)
 {
   typedef typename itk::NumericTraits<InputPixelType>::RealType FloatPixelType;
   typedef itk::Dream3DImage<FloatPixelType, Dimension> FloatImageType;
@@ -115,7 +150,6 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
   filter->SetNumberOfIterations(static_cast<uint32_t>(m_NumberOfIterations));
   filter->SetStencilRadius(static_cast<int>(m_StencilRadius));
   this->ITKImageProcessingBase::filterCastToFloat<InputPixelType, InputPixelType, Dimension, FilterType, FloatImageType>(filter);
-
 }
 
 // -----------------------------------------------------------------------------
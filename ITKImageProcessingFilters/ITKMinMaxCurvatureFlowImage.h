@@ -21,6 +21,8 @@
 #include <SIMPLib/FilterParameters/IntFilterParameter.h>
 #include <itkMinMaxCurvatureFlowImageFilter.h>
 
+#include <type_traits>
+
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
 
 /**
@@ -105,6 +107,16 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+  * @brief Runs the finite difference function of itk::MinMaxCurvatureFlowImageFilter with itk::IterativeDiffusionImageFilter, to scalar pixels
+  */
+  template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter(std::true_type pingPong);
+
+  /**
+  * @brief Applies itk::MinMaxCurvatureFlowImageFilter to the pixels cast to real ones, to the other pixel types
+  */
+  template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter(std::false_type pingPong);
+
 private:
   ITKMinMaxCurvatureFlowImage(const ITKMinMaxCurvatureFlowImage&) = delete;    // Copy Constructor Not Implemented
   ITKMinMaxCurvatureFlowImage(ITKMinMaxCurvatureFlowImage&&) = delete;         // Move Constructor Not Implemented
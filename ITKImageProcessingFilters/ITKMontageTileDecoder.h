@@ -0,0 +1,301 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <QtCore/QDir>
+#include <QtCore/QFileInfo>
+#include <QtCore/QHash>
+#include <QtCore/QSet>
+#include <QtCore/QString>
+#include <QtCore/QVector>
+
+#include "SIMPLib/DataArrays/DataArray.hpp"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
+#include "SIMPLib/DataContainers/DataContainer.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageIOFactoryMutex.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKSliceDecoder.h"
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
+/**
+ * @brief The ITKMontageTileDecoder class decodes the tiles of a montage concurrently, each one straight into
+ * a caller-owned buffer: either the array of the tile, or its slice of a packed tile stack. The functions
+ * that follow the class are shared by the montage importers.
+ *
+ * Every tile is read by an ImageIO cloned from the one that read the header of the first tile. Tiles are
+ * decoded in chunks of a few tiles per thread so that progress is reported in order and cancellation is
+ * checked regularly.
+ */
+template <typename TPixel> class ITKMontageTileDecoder
+{
+public:
+  /**
+   * @param prototype ImageIO that read the information of the first tile
+   * @param numberOfComponents Number of components of the decoded pixels
+   */
+  ITKMontageTileDecoder(itk::ImageIOBase* prototype, unsigned int numberOfComponents)
+  : m_Decoder(prototype, numberOfComponents)
+  {
+  }
+
+  /**
+   * @brief decode Decodes fileList[i] into buffers[i] for every tile whose buffer is not null, at most
+   * @p numberOfThreads tiles at once (0 uses all the cores). If @p allowConversion is false, tiles that do not
+   * have the pixel type of the buffers are left to the caller.
+   * @return The error message of each tile, empty for the tiles that were decoded or skipped
+   */
+  std::vector<std::string> decode(AbstractFilter* filter, const QVector<QString>& fileList, const std::vector<TPixel*>& buffers, bool allowConversion, int numberOfThreads) const
+  {
+    const size_t numberOfTiles = static_cast<size_t>(fileList.size());
+    std::vector<std::string> errors(numberOfTiles);
+    DecodeTilesImpl impl(m_Decoder, fileList, buffers, errors, allowConversion, filter);
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    numberOfThreads = numberOfThreads > 0 ? numberOfThreads : tbb::task_scheduler_init::default_num_threads();
+    tbb::task_arena arena(numberOfThreads);
+#else
+    numberOfThreads = 1;
+#endif
+    const size_t chunkSize = static_cast<size_t>(numberOfThreads) * 4;
+    for(size_t start = 0; start < numberOfTiles && !filter->getCancel(); start += chunkSize)
+    {
+      const size_t end = std::min(start + chunkSize, numberOfTiles);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+      arena.execute([&] { tbb::parallel_for(tbb::blocked_range<size_t>(start, end, 1), impl, tbb::simple_partitioner()); });
+#else
+      impl.convert(start, end);
+#endif
+      QString ss = QObject::tr("Imported %1 of %2 tiles").arg(end).arg(numberOfTiles);
+      filter->notifyStatusMessage(filter->getMessagePrefix(), filter->getHumanLabel(), ss);
+    }
+    return errors;
+  }
+
+  /**
+   * @brief getNumberOfPixels Returns the number of pixels of a tile
+   */
+  size_t getNumberOfPixels() const
+  {
+    return m_Decoder.getNumberOfPixels();
+  }
+
+  /**
+   * @brief DecodeStack Decodes tile i of @p fileList into slice i of @p stack, converting the tiles to the
+   * pixel type of the stack if needed.
+   * @return An empty string on success, the error message of the first tile that failed otherwise
+   */
+  static std::string DecodeStack(AbstractFilter* filter, const QVector<QString>& fileList, itk::ImageIOBase* prototype, DataArray<TPixel>& stack, int numberOfThreads)
+  {
+    const ITKMontageTileDecoder<TPixel> decoder(prototype, static_cast<unsigned int>(stack.getNumberOfComponents()));
+    const size_t tileSize = decoder.getNumberOfPixels() * static_cast<size_t>(stack.getNumberOfComponents());
+    if(tileSize * static_cast<size_t>(fileList.size()) != stack.getSize())
+    {
+      return "The size of the tile stack does not match the size of the tiles";
+    }
+    std::vector<TPixel*> buffers(static_cast<size_t>(fileList.size()));
+    for(size_t i = 0; i < buffers.size(); i++)
+    {
+      buffers[i] = stack.getPointer(i * tileSize);
+    }
+    const std::vector<std::string> errors = decoder.decode(filter, fileList, buffers, true, numberOfThreads);
+    std::vector<std::string>::const_iterator error = std::find_if(errors.begin(), errors.end(), [](const std::string& message) { return !message.empty(); });
+    return error != errors.end() ? *error : std::string();
+  }
+
+protected:
+  /**
+   * @brief The DecodeTilesImpl class decodes a range of tiles, each one into its own buffer. Tiles without
+   * a destination buffer are skipped.
+   */
+  class DecodeTilesImpl
+  {
+  public:
+    DecodeTilesImpl(const ITKSliceDecoder<TPixel>& decoder, const QVector<QString>& fileList, const std::vector<TPixel*>& buffers, std::vector<std::string>& errors, bool allowConversion,
+                    AbstractFilter* filter)
+    : m_Decoder(decoder)
+    , m_FileList(fileList)
+    , m_Buffers(buffers)
+    , m_Errors(errors)
+    , m_AllowConversion(allowConversion)
+    , m_Filter(filter)
+    {
+    }
+
+    void convert(size_t start, size_t end) const
+    {
+      for(size_t i = start; i < end; i++)
+      {
+        if(m_Filter->getCancel())
+        {
+          return;
+        }
+        if(nullptr != m_Buffers[i])
+        {
+          m_Errors[i] = m_Decoder.decode(m_FileList[static_cast<int>(i)].toStdString(), m_Buffers[i], m_AllowConversion);
+        }
+      }
+    }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    void operator()(const tbb::blocked_range<size_t>& r) const
+    {
+      convert(r.begin(), r.end());
+    }
+#endif
+
+  private:
+    const ITKSliceDecoder<TPixel>& m_Decoder;
+    const QVector<QString>& m_FileList;
+    const std::vector<TPixel*>& m_Buffers;
+    std::vector<std::string>& m_Errors;
+    bool m_AllowConversion;
+    AbstractFilter* m_Filter;
+  };
+
+private:
+  ITKSliceDecoder<TPixel> m_Decoder;
+};
+
+/**
+ * @brief ITKExistingTileFiles Returns the files of @p fileList that exist, in the same order. Every directory
+ * of the list is read once, instead of querying the file system for each file. The names are compared as
+ * they are listed; a file missing from the listing is still looked up, since the file systems of Windows and
+ * macOS do not match names case-sensitively.
+ */
+inline QVector<QString> ITKExistingTileFiles(const QVector<QString>& fileList)
+{
+  QHash<QString, QSet<QString>> directories;
+  QVector<QString> existingFiles;
+  for(const QString& filePath : fileList)
+  {
+    const QFileInfo fi(filePath);
+    QHash<QString, QSet<QString>>::iterator directory = directories.find(fi.absolutePath());
+    if(directory == directories.end())
+    {
+      QSet<QString> names;
+      for(const QString& name : QDir(fi.absolutePath()).entryList(QDir::Files | QDir::Hidden | QDir::System))
+      {
+        names.insert(name);
+      }
+      directory = directories.insert(fi.absolutePath(), names);
+    }
+    if(directory->contains(fi.fileName()) || fi.exists())
+    {
+      existingFiles.push_back(filePath);
+    }
+  }
+  return existingFiles;
+}
+
+/**
+ * @brief ITKCreateTileStack Lays out @p attrMat, which has the size of one tile, and the image geometry of
+ * @p container for a packed tile stack of @p numberOfTiles tiles, then adds to @p attrMat the array of the
+ * stack, with the type and the components of @p prototypeArray. Tile i is the slice Z = i of the stack.
+ * @return The stack, nullptr if the tiles are not 2D images
+ */
+inline IDataArray::Pointer ITKCreateTileStack(const DataContainer::Pointer& container, const AttributeMatrix::Pointer& attrMat, const IDataArray::Pointer& prototypeArray, const QString& name,
+                                              size_t numberOfTiles, bool allocate)
+{
+  QVector<size_t> tDims = attrMat->getTupleDimensions();
+  tDims.resize(3);
+  if(tDims[2] > 1)
+  {
+    return IDataArray::NullPointer();
+  }
+  tDims[2] = numberOfTiles;
+  attrMat->setTupleDimensions(tDims);
+  ImageGeom::Pointer image = container->getGeometryAs<ImageGeom>();
+  if(nullptr != image.get())
+  {
+    image->setDimensions(tDims[0], tDims[1], tDims[2]);
+  }
+  IDataArray::Pointer stack = prototypeArray->createNewArray(attrMat->getNumberOfTuples(), prototypeArray->getComponentDimensions(), name, allocate);
+  attrMat->addAttributeArray(name, stack);
+  return stack;
+}
+
+/**
+ * @brief ITKCreateTileImageIO Creates the ImageIO that reads the header of @p fileName, the prototype of
+ * the ImageIO of every tile of a montage.
+ * @return nullptr if the file cannot be read
+ */
+inline itk::ImageIOBase::Pointer ITKCreateTileImageIO(const QString& fileName)
+{
+  itk::ImageIOBase::Pointer prototype;
+  try
+  {
+    {
+      std::lock_guard<std::mutex> lock(ITKImageIOFactoryMutex());
+      prototype = itk::ImageIOFactory::CreateImageIO(fileName.toLatin1(), itk::ImageIOFactory::ReadMode);
+    }
+    if(nullptr != prototype)
+    {
+      prototype->SetFileName(fileName.toLatin1());
+      prototype->ReadImageInformation();
+    }
+  } catch(itk::ExceptionObject&)
+  {
+    prototype = nullptr;
+  }
+  return prototype;
+}
+
+/**
+ * @brief ITKDecodeTileStack Decodes the tiles into @p stack if it is a DataArray<TPixel>.
+ * @return false if @p stack holds another primitive type
+ */
+template <typename TPixel>
+bool ITKDecodeTileStack(AbstractFilter* filter, const QVector<QString>& fileList, itk::ImageIOBase* prototype, const IDataArray::Pointer& stack, int numberOfThreads, std::string& error)
+{
+  typename DataArray<TPixel>::Pointer array = std::dynamic_pointer_cast<DataArray<TPixel>>(stack);
+  if(nullptr == array.get())
+  {
+    return false;
+  }
+  error = ITKMontageTileDecoder<TPixel>::DecodeStack(filter, fileList, prototype, *array, numberOfThreads);
+  return true;
+}
+
+/**
+ * @brief ITKDecodeTileStack Decodes tile i of @p fileList into slice i of @p stack, whatever the primitive
+ * type of the stack.
+ * @return An empty string on success, the error message otherwise
+ */
+inline std::string ITKDecodeTileStack(AbstractFilter* filter, const QVector<QString>& fileList, const IDataArray::Pointer& stack, int numberOfThreads)
+{
+  if(fileList.isEmpty())
+  {
+    return std::string();
+  }
+  itk::ImageIOBase::Pointer prototype = ITKCreateTileImageIO(fileList[0]);
+  if(nullptr == prototype)
+  {
+    return fileList[0].toStdString() + ": could not read the image information";
+  }
+  std::string error;
+  if(ITKDecodeTileStack<uint8_t>(filter, fileList, prototype, stack, numberOfThreads, error) || ITKDecodeTileStack<int8_t>(filter, fileList, prototype, stack, numberOfThreads, error) ||
+     ITKDecodeTileStack<uint16_t>(filter, fileList, prototype, stack, numberOfThreads, error) || ITKDecodeTileStack<int16_t>(filter, fileList, prototype, stack, numberOfThreads, error) ||
+     ITKDecodeTileStack<uint32_t>(filter, fileList, prototype, stack, numberOfThreads, error) || ITKDecodeTileStack<int32_t>(filter, fileList, prototype, stack, numberOfThreads, error) ||
+     ITKDecodeTileStack<float>(filter, fileList, prototype, stack, numberOfThreads, error) || ITKDecodeTileStack<double>(filter, fileList, prototype, stack, numberOfThreads, error))
+  {
+    return error;
+  }
+  return "The pixel type of the tiles is not supported by the packed tile stack";
+}
@@ -84,6 +84,11 @@ public:
    */
   void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
 
+  /**
+   * @brief canRunConcurrently Reimplemented from @see ITKImageBase class
+   */
+  bool canRunConcurrently() const override;
+
 protected:
   SIMPL_INSTANCE_PROPERTY(DataContainerArray::Pointer, MarkerContainerArray)
 
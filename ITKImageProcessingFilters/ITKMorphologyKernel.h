@@ -0,0 +1,53 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <itkFlatStructuringElement.h>
+
+/**
+ * @brief The ITKMorphologyKernel class builds the flat structuring elements of the morphology filters
+ * from their Kernel Type parameter (0: Annulus, 1: Ball, 2: Box, 3: Cross).
+ *
+ * The elements are not decomposed by ITK (the polygon decomposition of a ball is an approximation). The
+ * grayscale and binary filters apply the elements made of segments with itk::FlatMorphologyImageFilter instead, which is
+ * exact, and the others with the ITK filters.
+ */
+class ITKMorphologyKernel
+{
+public:
+  enum class Type : int
+  {
+    Annulus = 0,
+    Ball = 1,
+    Box = 2,
+    Cross = 3
+  };
+
+  /**
+   * @brief Create Writes in @p element the structuring element of type @p kernelType and radius @p radius
+   * @return false if the type is not supported
+   */
+  template <unsigned int Dimension>
+  static bool Create(int kernelType, const typename itk::FlatStructuringElement<Dimension>::RadiusType& radius, itk::FlatStructuringElement<Dimension>& element)
+  {
+    typedef itk::FlatStructuringElement<Dimension> StructuringElementType;
+    switch(static_cast<Type>(kernelType))
+    {
+    case Type::Annulus:
+      element = StructuringElementType::Annulus(radius, false);
+      return true;
+    case Type::Ball:
+      element = StructuringElementType::Ball(radius, false);
+      return true;
+    case Type::Box:
+      element = StructuringElementType::Box(radius);
+      return true;
+    case Type::Cross:
+      element = StructuringElementType::Cross(radius);
+      return true;
+    }
+    return false;
+  }
+};
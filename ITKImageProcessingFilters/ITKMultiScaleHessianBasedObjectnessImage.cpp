@@ -12,6 +12,7 @@
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
 #include "SIMPLib/FilterParameters/DoubleFilterParameter.h"
 #include "SIMPLib/FilterParameters/IntFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -24,6 +25,10 @@
 #include "SIMPLib/ITK/Dream3DTemplateAliasMacro.h"
 #include "SIMPLib/ITK/itkDream3DImage.h"
 
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKScaleSpace.h"
+
+#include <cmath>
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -67,6 +72,7 @@ void ITKMultiScaleHessianBasedObjectnessImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKMultiScaleHessianBasedObjectnessImage, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKMultiScaleHessianBasedObjectnessImage));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -98,6 +104,7 @@ void ITKMultiScaleHessianBasedObjectnessImage::readFilterParameters(AbstractFilt
   setSigmaMaximum(reader->readValue("SigmaMaximum", getSigmaMaximum()));
   setNumberOfSigmaSteps(reader->readValue("NumberOfSigmaSteps", getNumberOfSigmaSteps()));
 
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
   reader->closeFilterGroup();
 }
 
@@ -127,6 +134,100 @@ void ITKMultiScaleHessianBasedObjectnessImage::dataCheckInternal()
 // -----------------------------------------------------------------------------
 
 template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKMultiScaleHessianBasedObjectnessImage::filter()
+{
+  // The scale space cache holds images of scalar pixels
+  this->filter<InputPixelType, OutputPixelType, Dimension>(std::is_arithmetic<InputPixelType>());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKMultiScaleHessianBasedObjectnessImage::filter(std::true_type)
+{
+  typedef ITKScaleSpace<InputPixelType, Dimension> ScaleSpaceType;
+  typedef typename itk::NumericTraits<InputPixelType>::RealType RealType;
+  typedef itk::SymmetricSecondRankTensor<RealType, Dimension> HessianPixelType;
+  typedef itk::Image<HessianPixelType, Dimension> HessianImageType;
+  typedef itk::Image<OutputPixelType, Dimension> MeasureImageType;
+  typedef itk::HessianToObjectnessMeasureImageFilter<HessianImageType, MeasureImageType> ObjectnessFilterType;
+  typedef typename itk::NumericTraits<OutputPixelType>::ScalarRealType BufferValueType;
+
+  const double sigmaMinimum = static_cast<double>(m_SigmaMinimum);
+  const double sigmaMaximum = static_cast<double>(m_SigmaMaximum);
+  const unsigned int numberOfSigmaSteps = static_cast<unsigned int>(m_NumberOfSigmaSteps);
+  auto compute = [&](ScaleSpaceType& scaleSpace) {
+    const size_t numberOfPixels = scaleSpace.getInput()->GetLargestPossibleRegion().GetNumberOfPixels();
+    const typename HessianImageType::SpacingType spacing = scaleSpace.getInput()->GetSpacing();
+    std::vector<BufferValueType> response(numberOfPixels, itk::NumericTraits<BufferValueType>::NonpositiveMin());
+
+    // Same scales as itk::MultiScaleHessianBasedMeasureImageFilter, evenly spaced on a logarithmic scale
+    const double stepSize = std::max(1e-10, (std::log(sigmaMaximum) - std::log(sigmaMinimum)) / (numberOfSigmaSteps - 1.0));
+    double sigma = sigmaMinimum;
+    int scaleLevel = 1;
+    while(sigma <= sigmaMaximum && numberOfSigmaSteps > 0)
+    {
+      typename HessianImageType::Pointer hessian = HessianImageType::New();
+      hessian->CopyInformation(scaleSpace.getInput());
+      hessian->SetRegions(scaleSpace.getInput()->GetLargestPossibleRegion());
+      hessian->Allocate();
+      HessianPixelType* tensors = hessian->GetBufferPointer();
+      // Components in the order of itk::SymmetricSecondRankTensor: (0,0), (0,1), ..., (1,1), ...
+      unsigned int element = 0;
+      for(unsigned int a = 0; a < Dimension; a++)
+      {
+        for(unsigned int b = a; b < Dimension; b++, element++)
+        {
+          std::array<int, Dimension> orders;
+          orders.fill(0);
+          orders[a]++;
+          orders[b]++;
+          typename ScaleSpaceType::RealImageType::Pointer derivative = scaleSpace.get(ScaleSpaceType::Derivative(sigma, orders, true));
+          const typename ScaleSpaceType::RealPixelType* values = derivative->GetBufferPointer();
+          const RealType scale = static_cast<RealType>(1.0 / (spacing[a] * spacing[b]));
+          for(size_t i = 0; i < numberOfPixels; i++)
+          {
+            tensors[i][element] = static_cast<RealType>(values[i]) * scale;
+          }
+        }
+      }
+
+      typename ObjectnessFilterType::Pointer objectnessFilter = ObjectnessFilterType::New();
+      objectnessFilter->SetInput(hessian);
+      objectnessFilter->SetObjectDimension(static_cast<unsigned int>(m_ObjectDimension));
+      objectnessFilter->SetAlpha(static_cast<double>(m_Alpha));
+      objectnessFilter->SetBeta(static_cast<double>(m_Beta));
+      objectnessFilter->SetGamma(static_cast<double>(m_Gamma));
+      objectnessFilter->SetBrightObject(static_cast<bool>(m_BrightObject));
+      objectnessFilter->SetScaleObjectnessMeasure(static_cast<bool>(m_ScaleObjectnessMeasure));
+      scaleSpace.update(objectnessFilter.GetPointer());
+      const OutputPixelType* measure = objectnessFilter->GetOutput()->GetBufferPointer();
+      for(size_t i = 0; i < numberOfPixels; i++)
+      {
+        response[i] = std::max(response[i], static_cast<BufferValueType>(measure[i]));
+      }
+
+      if(numberOfSigmaSteps == 1)
+      {
+        break;
+      }
+      sigma = std::exp(std::log(sigmaMinimum) + stepSize * scaleLevel);
+      scaleLevel++;
+    }
+
+    typename itk::Dream3DImage<OutputPixelType, Dimension>::Pointer output = scaleSpace.template createImage<OutputPixelType>();
+    std::transform(response.begin(), response.end(), output->GetBufferPointer(), [](BufferValueType value) { return static_cast<OutputPixelType>(value); });
+    return output;
+  };
+  if(!this->filterScaleSpace<InputPixelType, OutputPixelType, Dimension>(compute))
+  {
+    this->filter<InputPixelType, OutputPixelType, Dimension>(std::false_type());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKMultiScaleHessianBasedObjectnessImage::filter(std::false_type)
 {
   typedef itk::Dream3DImage<InputPixelType, Dimension> InputImageType;
   typedef itk::Dream3DImage<OutputPixelType, Dimension> OutputImageType;
@@ -0,0 +1,48 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <functional>
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#endif
+
+/**
+ * @brief The ITKParallelFor class runs the tasks of the filters of this plugin that split their work in
+ * blocks of their own instead of running an ITK filter. The tasks run in a TBB arena of the number of threads
+ * of the filter (see ITKThreadingPolicy), and one after the other without TBB.
+ */
+class ITKParallelFor
+{
+public:
+  /**
+   * @brief Run Calls @p function(i) for i in [0, @p count), on at most @p threads threads
+   */
+  static void Run(int threads, size_t count, const std::function<void(size_t)>& function)
+  {
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    if(threads > 1 && count > 1)
+    {
+      tbb::task_arena arena(threads);
+      arena.execute([&] {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, count, 1), [&](const tbb::blocked_range<size_t>& r) {
+          for(size_t i = r.begin(); i < r.end(); i++)
+          {
+            function(i);
+          }
+        });
+      });
+      return;
+    }
+#endif
+    for(size_t i = 0; i < count; i++)
+    {
+      function(i);
+    }
+  }
+};
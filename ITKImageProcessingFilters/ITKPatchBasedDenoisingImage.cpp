@@ -8,6 +8,7 @@
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/ChoiceFilterParameter.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -15,6 +16,11 @@
 #include "SIMPLib/Geometry/ImageGeom.h"
 
 #include <itkGaussianRandomSpatialNeighborSubsampler.h>
+#include <itkImageRegionConstIterator.h>
+#include <itkRegionOfInterestImageFilter.h>
+
+#include <algorithm>
+#include <cmath>
 
 #include "SIMPLib/ITK/Dream3DTemplateAliasMacro.h"
 #include "SIMPLib/ITK/itkDream3DImage.h"
@@ -37,6 +43,7 @@ ITKPatchBasedDenoisingImage::ITKPatchBasedDenoisingImage()
   m_KernelBandwidthUpdateFrequency = StaticCastScalar<double, double, double>(3u);
   m_KernelBandwidthFractionPixelsForEstimation = StaticCastScalar<double, double, double>(0.2);
   m_NoiseModel = 0; //  NOMODEL
+  m_SinglePrecision = false;
 }
 
 // -----------------------------------------------------------------------------
@@ -80,10 +87,17 @@ void ITKPatchBasedDenoisingImage::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("KernelBandwidthMultiplicationFactor", KernelBandwidthMultiplicationFactor, FilterParameter::Parameter, ITKPatchBasedDenoisingImage));
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("KernelBandwidthUpdateFrequency", KernelBandwidthUpdateFrequency, FilterParameter::Parameter, ITKPatchBasedDenoisingImage));
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("KernelBandwidthFractionPixelsForEstimation", KernelBandwidthFractionPixelsForEstimation, FilterParameter::Parameter, ITKPatchBasedDenoisingImage));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Single Precision", SinglePrecision, FilterParameter::Parameter, ITKPatchBasedDenoisingImage));
+
+  QStringList streamingProps;
+  streamingProps << "SlabSize";
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Streamed Execution", StreamedExecution, FilterParameter::Parameter, ITKPatchBasedDenoisingImage, streamingProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Slab Size (Slices)", SlabSize, FilterParameter::Parameter, ITKPatchBasedDenoisingImage));
 
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKPatchBasedDenoisingImage, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKPatchBasedDenoisingImage));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -117,7 +131,11 @@ void ITKPatchBasedDenoisingImage::readFilterParameters(AbstractFilterParametersR
   setKernelBandwidthMultiplicationFactor(reader->readValue("KernelBandwidthMultiplicationFactor", getKernelBandwidthMultiplicationFactor()));
   setKernelBandwidthUpdateFrequency(reader->readValue("KernelBandwidthUpdateFrequency", getKernelBandwidthUpdateFrequency()));
   setKernelBandwidthFractionPixelsForEstimation(reader->readValue("KernelBandwidthFractionPixelsForEstimation", getKernelBandwidthFractionPixelsForEstimation()));
+  setSinglePrecision(reader->readValue("SinglePrecision", getSinglePrecision()));
+  setStreamedExecution(reader->readValue("StreamedExecution", getStreamedExecution()));
+  setSlabSize(reader->readValue("SlabSize", getSlabSize()));
 
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
   reader->closeFilterGroup();
 }
 
@@ -134,6 +152,12 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
 
   setErrorCondition(0);
   setWarningCondition(0);
+  if(getStreamedExecution() && getSlabSize() < 1)
+  {
+    setErrorCondition(-55610);
+    notifyErrorMessage(getHumanLabel(), "Slab Size must be at least 1 slice", getErrorCondition());
+    return;
+  }
   ITKImageProcessingBase::dataCheck<InputPixelType, OutputPixelType, Dimension>();
 }
 
@@ -142,60 +166,238 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
 // -----------------------------------------------------------------------------
 void ITKPatchBasedDenoisingImage::dataCheckInternal()
 {
-  Dream3DArraySwitchMacroOutputType(this->dataCheck, getSelectedCellArrayPath(), -4, double, 0);
+  if(m_SinglePrecision)
+  {
+    Dream3DArraySwitchMacroOutputType(this->dataCheck, getSelectedCellArrayPath(), -4, float, 0);
+  }
+  else
+  {
+    Dream3DArraySwitchMacroOutputType(this->dataCheck, getSelectedCellArrayPath(), -4, double, 0);
+  }
 }
 
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 
-template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKPatchBasedDenoisingImage::filter()
+template <typename RealImageType>
+typename itk::PatchBasedDenoisingImageFilter<RealImageType, RealImageType>::Pointer ITKPatchBasedDenoisingImage::createFilter(unsigned int numberOfComponents, double noiseSigma) const
 {
-  typedef itk::Dream3DImage<OutputPixelType, Dimension> RealImageType;
-  // define filter
   typedef itk::PatchBasedDenoisingImageFilter<RealImageType, RealImageType> FilterType;
   typename FilterType::Pointer filter = FilterType::New();
-  typedef itk::InPlaceDream3DDataToImageFilter<InputPixelType, Dimension> toITKType;
-  DataArrayPath dap = getSelectedCellArrayPath();
-  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(dap.getDataContainerName());
-  typename toITKType::Pointer toITK = toITKType::New();
-  toITK->SetInput(dc);
-  toITK->SetInPlace(true);
-  toITK->SetAttributeMatrixArrayName(getSelectedCellArrayPath().getAttributeMatrixName().toStdString());
-  toITK->SetDataArrayName(getSelectedCellArrayPath().getDataArrayName().toStdString());
-  typename FilterType::RealArrayType a(toITK->GetOutput()->GetNumberOfComponentsPerPixel());
+  typename FilterType::RealArrayType a(numberOfComponents);
   a.Fill(m_KernelBandwidthSigma);
   filter->SetKernelBandwidthSigma(a);
   filter->SetPatchRadius(static_cast<uint32_t>(m_PatchRadius));
   filter->SetNumberOfIterations(static_cast<uint32_t>(m_NumberOfIterations));
-  if(this->m_NoiseSigma != 0.0)
-    filter->SetNoiseSigma(this->m_NoiseSigma);
+  if(noiseSigma != 0.0)
+    filter->SetNoiseSigma(noiseSigma);
   filter->SetNoiseModelFidelityWeight(static_cast<double>(m_NoiseModelFidelityWeight));
   filter->SetAlwaysTreatComponentsAsEuclidean(static_cast<bool>(m_AlwaysTreatComponentsAsEuclidean));
   filter->SetKernelBandwidthEstimation(static_cast<bool>(m_KernelBandwidthEstimation));
   filter->SetKernelBandwidthMultiplicationFactor(static_cast<double>(m_KernelBandwidthMultiplicationFactor));
   filter->SetKernelBandwidthUpdateFrequency(static_cast<uint32_t>(m_KernelBandwidthUpdateFrequency));
   filter->SetKernelBandwidthFractionPixelsForEstimation(static_cast<double>(m_KernelBandwidthFractionPixelsForEstimation));
-  filter->SetNumberOfThreads(this->getNumberOfThreads());
   typedef itk::Statistics::GaussianRandomSpatialNeighborSubsampler<typename FilterType::PatchSampleType, typename RealImageType::RegionType> SamplerType;
   typename SamplerType::Pointer sampler = SamplerType::New();
   sampler->SetVariance(m_SampleVariance);
-  sampler->SetRadius(itk::Math::Floor<unsigned int>(std::sqrt(m_SampleVariance) * 2.5));
+  sampler->SetRadius(getSamplerRadius());
   sampler->SetNumberOfResultsRequested(m_NumberOfSamplePatches);
   filter->SetSampler(sampler);
   typedef typename itk::PatchBasedDenoisingBaseImageFilter<RealImageType, RealImageType>::NoiseModelType NoiseModelType;
   NoiseModelType noiseModel = static_cast<NoiseModelType>(m_NoiseModel);
   filter->SetNoiseModel(noiseModel);
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+unsigned int ITKPatchBasedDenoisingImage::getSamplerRadius() const
+{
+  return itk::Math::Floor<unsigned int>(std::sqrt(m_SampleVariance) * 2.5);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKPatchBasedDenoisingImage::filter()
+{
+  if(getStreamedExecution() && !isPipelineStage())
+  {
+    filterSlabs<InputPixelType, OutputPixelType, Dimension>();
+    return;
+  }
+  typedef itk::Dream3DImage<OutputPixelType, Dimension> RealImageType;
+  // define filter
+  typedef itk::PatchBasedDenoisingImageFilter<RealImageType, RealImageType> FilterType;
+  typedef itk::InPlaceDream3DDataToImageFilter<InputPixelType, Dimension> toITKType;
+  DataArrayPath dap = getSelectedCellArrayPath();
+  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(dap.getDataContainerName());
+  typename toITKType::Pointer toITK = toITKType::New();
+  toITK->SetInput(dc);
+  toITK->SetInPlace(true);
+  toITK->SetAttributeMatrixArrayName(getSelectedCellArrayPath().getAttributeMatrixName().toStdString());
+  toITK->SetDataArrayName(getSelectedCellArrayPath().getDataArrayName().toStdString());
+  typename FilterType::Pointer filter = createFilter<RealImageType>(toITK->GetOutput()->GetNumberOfComponentsPerPixel(), m_NoiseSigma);
 
   this->ITKImageProcessingBase::filterCastToFloat<InputPixelType, OutputPixelType, Dimension, FilterType, RealImageType>(filter);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKPatchBasedDenoisingImage::filterSlabs()
+{
+  typedef itk::Dream3DImage<InputPixelType, Dimension> InputImageType;
+  typedef itk::Dream3DImage<OutputPixelType, Dimension> RealImageType;
+  typedef itk::PatchBasedDenoisingImageFilter<RealImageType, RealImageType> FilterType;
+  typedef itk::RegionOfInterestImageFilter<InputImageType, RealImageType> ExtractorType;
+  typedef typename RealImageType::RegionType RegionType;
+  typedef typename itk::NumericTraits<InputPixelType>::ValueType InputValueType;
+  typedef typename itk::NumericTraits<OutputPixelType>::ValueType OutputValueType;
+
+  const DataArrayPath selectedArray = getSelectedCellArrayPath();
+  const QString outputArrayName = getSaveAsNewArray() ? getNewCellArrayName() : selectedArray.getDataArrayName();
+  try
+  {
+    DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(selectedArray.getDataContainerName());
+    AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix(selectedArray.getAttributeMatrixName());
+    typename DataArray<InputValueType>::Pointer inputArray = std::dynamic_pointer_cast<DataArray<InputValueType>>(attrMat->getAttributeArray(selectedArray.getDataArrayName()));
+
+    // A new array was already created by dataCheck(). The input array is only replaced once every slab is
+    // done, since the slabs read the slices around them.
+    typename DataArray<OutputValueType>::Pointer outputArray;
+    if(getSaveAsNewArray())
+    {
+      outputArray = std::dynamic_pointer_cast<DataArray<OutputValueType>>(attrMat->getAttributeArray(outputArrayName));
+    }
+    const bool createOutputArray = (nullptr == outputArray || !outputArray->isAllocated());
+    if(createOutputArray)
+    {
+      QVector<size_t> cDims = ITKDream3DHelper::GetComponentsDimensions<OutputPixelType>();
+      outputArray = DataArray<OutputValueType>::CreateArray(attrMat->getNumberOfTuples(), cDims, outputArrayName, true);
+    }
+    OutputPixelType* outputBuffer = reinterpret_cast<OutputPixelType*>(outputArray->getPointer(0));
+
+    // Without a noise sigma, each slab would take 5% of its own intensity range
+    double noiseSigma = m_NoiseSigma;
+    if(noiseSigma == 0.0 && m_NoiseModel != 0 && inputArray->getSize() > 0)
+    {
+      const InputValueType* values = inputArray->getPointer(0);
+      const std::pair<const InputValueType*, const InputValueType*> range = std::minmax_element(values, values + inputArray->getSize());
+      noiseSigma = 0.05 * (static_cast<double>(*range.second) - static_cast<double>(*range.first));
+    }
+
+    itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New();
+    interruption->SetFilter(this);
+    {
+      typedef itk::InPlaceDream3DDataToImageFilter<InputPixelType, Dimension> toITKType;
+      typename toITKType::Pointer toITK = toITKType::New();
+      toITK->SetInput(dc);
+      toITK->SetInPlace(true);
+      toITK->SetAttributeMatrixArrayName(selectedArray.getAttributeMatrixName().toStdString());
+      toITK->SetDataArrayName(selectedArray.getDataArrayName().toStdString());
+      toITK->Update();
+      typename InputImageType::Pointer input = toITK->GetOutput();
+
+      const RegionType largestRegion = input->GetLargestPossibleRegion();
+      const unsigned int slabDimension = Dimension - 1;
+      const itk::SizeValueType numberOfSlices = largestRegion.GetSize(slabDimension);
+      const itk::SizeValueType slabSize = std::min<itk::SizeValueType>(std::max(getSlabSize(), 1), numberOfSlices);
+      const size_t pixelsPerSlice = largestRegion.GetNumberOfPixels() / numberOfSlices;
+
+      // Each iteration compares the patch of a pixel to patches sampled around it: a slab needs the slices
+      // within the sampler radius plus the patch radius, in pixels, of its own, for every iteration. The patch
+      // radius in pixels grows along the axes of small spacing.
+      double maxSpacing = 0.0;
+      for(unsigned int d = 0; d < Dimension; d++)
+      {
+        maxSpacing = std::max(maxSpacing, static_cast<double>(input->GetSpacing()[d]));
+      }
+      const itk::SizeValueType patchRadius = static_cast<itk::SizeValueType>(std::ceil(m_PatchRadius * maxSpacing / input->GetSpacing()[slabDimension]));
+      const itk::SizeValueType halo = static_cast<itk::SizeValueType>(m_NumberOfIterations) * (patchRadius + getSamplerRadius());
+
+      // Other filters may use the data structure while the slabs are processed
+      ITKThreadingPolicy::AffinityScope affinity;
+      ITKDataStructureLock::Release release;
+      for(itk::SizeValueType slice = 0; slice < numberOfSlices; slice += slabSize)
+      {
+        if(getCancel())
+        {
+          return;
+        }
+        const itk::SizeValueType slices = std::min(slabSize, numberOfSlices - slice);
+        const itk::SizeValueType first = (slice > halo) ? slice - halo : 0;
+        const itk::SizeValueType last = std::min(slice + slices + halo, numberOfSlices);
+        RegionType padded = largestRegion;
+        padded.SetIndex(slabDimension, largestRegion.GetIndex(slabDimension) + static_cast<itk::IndexValueType>(first));
+        padded.SetSize(slabDimension, last - first);
+
+        typename ExtractorType::Pointer extractor = ExtractorType::New();
+        extractor->SetInput(input);
+        extractor->SetRegionOfInterest(padded);
+        typename FilterType::Pointer filter = createFilter<RealImageType>(input->GetNumberOfComponentsPerPixel(), noiseSigma);
+        filter->SetInput(extractor->GetOutput());
+        // The extracted slab belongs to this loop
+        enableInPlace(filter.GetPointer(), 0);
+        ITKThreadingPolicy::Instance().apply(extractor.GetPointer(), getNumberOfThreads());
+        ITKThreadingPolicy::Instance().apply(filter.GetPointer(), getNumberOfThreads());
+        filter->AddObserver(itk::ProgressEvent(), interruption);
+        filter->Update();
+
+        // The extracted image starts at the first padded slice
+        RealImageType* output = filter->GetOutput();
+        RegionType slab = output->GetLargestPossibleRegion();
+        slab.SetIndex(slabDimension, slab.GetIndex(slabDimension) + static_cast<itk::IndexValueType>(slice - first));
+        slab.SetSize(slabDimension, slices);
+        OutputPixelType* destination = outputBuffer + slice * pixelsPerSlice;
+        itk::ImageRegionConstIterator<RealImageType> it(output, slab);
+        for(it.GoToBegin(); !it.IsAtEnd(); ++it, ++destination)
+        {
+          *destination = it.Get();
+        }
+        QString ss = QObject::tr("Denoised slices %1 to %2 of %3").arg(slice).arg(slice + slices - 1).arg(numberOfSlices);
+        notifyStatusMessage(getHumanLabel(), ss);
+      }
+    }
+
+    if(!getSaveAsNewArray())
+    {
+      // Remove the original input data array and put the denoised output in its place
+      attrMat->removeAttributeArray(selectedArray.getDataArrayName());
+    }
+    if(createOutputArray)
+    {
+      attrMat->addAttributeArray(outputArray->getName(), outputArray);
+    }
+  } catch(itk::ExceptionObject& err)
+  {
+    if(!getCancel())
+    {
+      setErrorCondition(-55557);
+      QString errorMessage = "ITK exception was thrown while streaming input image: %1";
+      notifyErrorMessage(getHumanLabel(), errorMessage.arg(err.GetDescription()), getErrorCondition());
+    }
+    return;
+  }
+
+  notifyStatusMessage(getHumanLabel(), "Complete");
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
 void ITKPatchBasedDenoisingImage::filterInternal()
 {
-  Dream3DArraySwitchMacroOutputType(this->filter, getSelectedCellArrayPath(), -4, double, 0);
+  if(m_SinglePrecision)
+  {
+    Dream3DArraySwitchMacroOutputType(this->filter, getSelectedCellArrayPath(), -4, float, 0);
+  }
+  else
+  {
+    Dream3DArraySwitchMacroOutputType(this->filter, getSelectedCellArrayPath(), -4, double, 0);
+  }
 }
 
 // -----------------------------------------------------------------------------
@@ -42,7 +42,7 @@ class ITKImageProcessing_EXPORT ITKPatchBasedDenoisingImage : public ITKImagePro
   PYB11_PROPERTY(double KernelBandwidthUpdateFrequency READ getKernelBandwidthUpdateFrequency WRITE setKernelBandwidthUpdateFrequency)
   PYB11_PROPERTY(double KernelBandwidthFractionPixelsForEstimation READ getKernelBandwidthFractionPixelsForEstimation WRITE setKernelBandwidthFractionPixelsForEstimation)
   PYB11_PROPERTY(int NoiseModel READ getNoiseModel WRITE setNoiseModel)
-  PYB11_PROPERTY(int NumberOfThreads READ getNumberOfThreads WRITE setNumberOfThreads)
+  PYB11_PROPERTY(bool SinglePrecision READ getSinglePrecision WRITE setSinglePrecision)
 
 public:
   SIMPL_SHARED_POINTERS(ITKPatchBasedDenoisingImage)
@@ -90,8 +90,12 @@ public:
   SIMPL_FILTER_PARAMETER(int, NoiseModel)
   Q_PROPERTY(int NoiseModel READ getNoiseModel WRITE setNoiseModel)
 
-  SIMPL_FILTER_PARAMETER(int, NumberOfThreads)
-  Q_PROPERTY(int NumberOfThreads READ getNumberOfThreads WRITE setNumberOfThreads)
+  /**
+   * @brief SinglePrecision Denoises float pixels instead of double ones, halving the memory of the filter.
+   * The output array is then a float array.
+   */
+  SIMPL_FILTER_PARAMETER(bool, SinglePrecision)
+  Q_PROPERTY(bool SinglePrecision READ getSinglePrecision WRITE setSinglePrecision)
 
   /**
    * @brief newFilterInstance Reimplemented from @see AbstractFilter class
@@ -147,6 +151,24 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+   * @brief Applies the filter to one slab of slices at a time, each slab being denoised with the slices
+   * whose patches its pixels may be compared to
+   */
+  template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filterSlabs();
+
+  /**
+   * @brief createFilter Returns an itk::PatchBasedDenoisingImageFilter set up with the parameters of this
+   * filter, for images of @p numberOfComponents components. @p noiseSigma is only set if it is not 0.
+   */
+  template <typename RealImageType>
+  typename itk::PatchBasedDenoisingImageFilter<RealImageType, RealImageType>::Pointer createFilter(unsigned int numberOfComponents, double noiseSigma) const;
+
+  /**
+   * @brief getSamplerRadius Returns the radius, in pixels, of the region where patches are sampled
+   */
+  unsigned int getSamplerRadius() const;
+
 private:
   ITKPatchBasedDenoisingImage(const ITKPatchBasedDenoisingImage&) = delete; // Copy Constructor Not Implemented
   ITKPatchBasedDenoisingImage(ITKPatchBasedDenoisingImage&&) = delete;      // Move Constructor Not Implemented
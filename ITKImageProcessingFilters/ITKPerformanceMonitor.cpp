@@ -0,0 +1,251 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#include "ITKPerformanceMonitor.h"
+
+#include <QtCore/QMutexLocker>
+#include <QtCore/QTextStream>
+
+#ifdef _WIN32
+#include <windows.h>
+
+#include <psapi.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "psapi.lib")
+#endif
+#else
+#include <sys/resource.h>
+#endif
+
+// Monitoring starts enabled when a trace file is named in the environment: the monitor, which opens the
+// file, is then created by the first phase measured.
+std::atomic<bool> ITKPerformanceMonitor::s_Enabled(!qgetenv("ITKIMAGEPROCESSING_TRACE_FILE").isEmpty());
+
+namespace
+{
+/**
+ * @brief JSONString Quotes @p value for a JSON document
+ */
+QString JSONString(const QString& value)
+{
+  QString escaped = value;
+  escaped.replace('\\', "\\\\").replace('"', "\\\"");
+  return QString("\"%1\"").arg(escaped);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKPerformanceMonitor::Phase::Phase(std::vector<PhaseRecord>* records, const AbstractFilter* filter, const char* name, quint64 invocation)
+: m_Records(records)
+, m_Filter(filter)
+, m_Name(name)
+, m_Invocation(invocation)
+{
+  if(nullptr == m_Records)
+  {
+    return;
+  }
+  // Creates the monitor before the phase starts, start times are counted from its creation
+  ITKPerformanceMonitor::Instance();
+  m_StartPeakResidentSize = PeakResidentSize();
+  m_StartCpuTime = ProcessCpuTime();
+  m_Start = std::chrono::steady_clock::now();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKPerformanceMonitor::Phase::~Phase()
+{
+  if(nullptr == m_Records)
+  {
+    return;
+  }
+  const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+  ITKPerformanceMonitor& monitor = ITKPerformanceMonitor::Instance();
+  PhaseRecord record;
+  record.filterName = m_Filter->getHumanLabel();
+  record.phase = QString::fromLatin1(m_Name);
+  record.invocation = m_Invocation;
+  record.startTime = monitor.elapsedTime(m_Start);
+  record.wallTime = std::chrono::duration<double, std::milli>(end - m_Start).count();
+  record.cpuTime = ProcessCpuTime() - m_StartCpuTime;
+  record.peakResidentSizeDelta = PeakResidentSize() - m_StartPeakResidentSize;
+  record.allocatedBytes = m_AllocatedBytes;
+  m_Records->push_back(record);
+  monitor.write(record);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKPerformanceMonitor::ITKPerformanceMonitor()
+: m_Invocations(0)
+, m_Origin(std::chrono::steady_clock::now())
+{
+  const QString traceFile = QString::fromLocal8Bit(qgetenv("ITKIMAGEPROCESSING_TRACE_FILE"));
+  if(!traceFile.isEmpty())
+  {
+    setTraceFile(traceFile);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKPerformanceMonitor& ITKPerformanceMonitor::Instance()
+{
+  static ITKPerformanceMonitor monitor;
+  return monitor;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKPerformanceMonitor::setEnabled(bool enabled)
+{
+  s_Enabled.store(enabled);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKPerformanceMonitor::setTraceFile(const QString& fileName)
+{
+  QMutexLocker locker(&m_Mutex);
+  if(m_TraceFile.isOpen())
+  {
+    m_TraceFile.close();
+  }
+  s_Enabled.store(true);
+  if(fileName.isEmpty())
+  {
+    return true;
+  }
+  m_TraceFile.setFileName(fileName);
+  if(!m_TraceFile.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text))
+  {
+    return false;
+  }
+  m_CSVTrace = fileName.endsWith(".csv", Qt::CaseInsensitive);
+  QTextStream out(&m_TraceFile);
+  if(m_CSVTrace)
+  {
+    out << "invocation,filter,phase,start_ms,wall_ms,cpu_ms,peak_rss_delta_bytes,allocated_bytes\n";
+  }
+  else
+  {
+    // The closing bracket of the array is optional in the Trace Event format, which lets records be appended
+    out << "[\n";
+  }
+  out.flush();
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ITKPerformanceMonitor::getTraceFile() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_TraceFile.isOpen() ? m_TraceFile.fileName() : QString();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+quint64 ITKPerformanceMonitor::nextInvocation()
+{
+  return ++m_Invocations;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKPerformanceMonitor::write(const PhaseRecord& record)
+{
+  QMutexLocker locker(&m_Mutex);
+  if(!m_TraceFile.isOpen())
+  {
+    return;
+  }
+  QTextStream out(&m_TraceFile);
+  if(m_CSVTrace)
+  {
+    QString filterName = record.filterName;
+    filterName.replace('"', "\"\"");
+    out << record.invocation << ",\"" << filterName << "\"," << record.phase << "," << QString::number(record.startTime, 'f', 3) << "," << QString::number(record.wallTime, 'f', 3) << ","
+        << QString::number(record.cpuTime, 'f', 3) << "," << record.peakResidentSizeDelta << "," << record.allocatedBytes << "\n";
+  }
+  else
+  {
+    // Complete events, one row per filter invocation, in microseconds
+    out << "{\"name\":" << JSONString(record.phase) << ",\"cat\":" << JSONString(record.filterName) << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << record.invocation
+        << ",\"ts\":" << QString::number(record.startTime * 1000.0, 'f', 1) << ",\"dur\":" << QString::number(record.wallTime * 1000.0, 'f', 1)
+        << ",\"args\":{\"cpu_ms\":" << QString::number(record.cpuTime, 'f', 3) << ",\"peak_rss_delta_bytes\":" << record.peakResidentSizeDelta << ",\"allocated_bytes\":" << record.allocatedBytes << "}},\n";
+  }
+  out.flush();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKPerformanceMonitor::elapsedTime(std::chrono::steady_clock::time_point time) const
+{
+  return std::chrono::duration<double, std::milli>(time - m_Origin).count();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKPerformanceMonitor::ProcessCpuTime()
+{
+#ifdef _WIN32
+  FILETIME creationTime, exitTime, kernelTime, userTime;
+  if(!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+  {
+    return 0.0;
+  }
+  // FILETIME counts 100 ns intervals
+  const quint64 kernel = (static_cast<quint64>(kernelTime.dwHighDateTime) << 32) | kernelTime.dwLowDateTime;
+  const quint64 user = (static_cast<quint64>(userTime.dwHighDateTime) << 32) | userTime.dwLowDateTime;
+  return static_cast<double>(kernel + user) / 10000.0;
+#else
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    return 0.0;
+  }
+  return (usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000.0 + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000.0;
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 ITKPerformanceMonitor::PeakResidentSize()
+{
+#ifdef _WIN32
+  PROCESS_MEMORY_COUNTERS counters;
+  if(!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+  {
+    return 0;
+  }
+  return static_cast<qint64>(counters.PeakWorkingSetSize);
+#else
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage) != 0)
+  {
+    return 0;
+  }
+#ifdef __APPLE__
+  return static_cast<qint64>(usage.ru_maxrss);
+#else
+  // Linux reports kilobytes
+  return static_cast<qint64>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
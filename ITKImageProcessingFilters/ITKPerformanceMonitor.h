@@ -0,0 +1,148 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include <QtCore/QFile>
+#include <QtCore/QMutex>
+#include <QtCore/QString>
+
+#include "SIMPLib/Filtering/AbstractFilter.h"
+
+#include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+
+/**
+ * @brief The ITKPerformanceMonitor class measures the phases of the ITK filters of this plugin: wall time,
+ * CPU time of the process, growth of the peak resident set size and bytes of image buffers allocated.
+ *
+ * Monitoring is off by default and a disabled Phase only costs the test of a flag. It is turned on by
+ * setEnabled() or setTraceFile(), or by naming a trace file in the ITKIMAGEPROCESSING_TRACE_FILE environment
+ * variable. The measures of a filter invocation are kept by the filter (see ITKImageBase::getPerformanceRecords())
+ * and, when a trace file is set, appended to it: CSV if its name ends with ".csv", otherwise the Trace Event
+ * JSON format that chrome://tracing and Perfetto display as a timeline.
+ */
+class ITKImageProcessing_EXPORT ITKPerformanceMonitor
+{
+public:
+  /**
+   * @brief The PhaseRecord struct holds the measures of one phase of one filter invocation. Times are in
+   * milliseconds, start times are counted from the creation of the monitor.
+   */
+  struct PhaseRecord
+  {
+    QString filterName;
+    QString phase;
+    quint64 invocation = 0;
+    double startTime = 0.0;
+    double wallTime = 0.0;
+    double cpuTime = 0.0;
+    qint64 peakResidentSizeDelta = 0;
+    qint64 allocatedBytes = 0;
+  };
+
+  /**
+   * @brief The Phase class measures the scope it lives in and appends its record to @p records when it is
+   * destroyed. Nothing is measured when @p records is null, which is what the filters pass when monitoring
+   * is disabled.
+   */
+  class ITKImageProcessing_EXPORT Phase
+  {
+  public:
+    Phase(std::vector<PhaseRecord>* records, const AbstractFilter* filter, const char* name, quint64 invocation);
+    ~Phase();
+
+    /**
+     * @brief setAllocatedBytes Sets the bytes of image buffers allocated during the phase
+     */
+    void setAllocatedBytes(qint64 bytes)
+    {
+      m_AllocatedBytes = bytes;
+    }
+
+    Phase(const Phase&) = delete;            // Copy Constructor Not Implemented
+    Phase(Phase&&) = delete;                 // Move Constructor Not Implemented
+    Phase& operator=(const Phase&) = delete; // Copy Assignment Not Implemented
+    Phase& operator=(Phase&&) = delete;      // Move Assignment Not Implemented
+
+  private:
+    std::vector<PhaseRecord>* m_Records;
+    const AbstractFilter* m_Filter;
+    const char* m_Name;
+    quint64 m_Invocation;
+    std::chrono::steady_clock::time_point m_Start;
+    double m_StartCpuTime = 0.0;
+    qint64 m_StartPeakResidentSize = 0;
+    qint64 m_AllocatedBytes = 0;
+  };
+
+  /**
+   * @brief Instance Returns the monitor shared by every filter of the process
+   */
+  static ITKPerformanceMonitor& Instance();
+
+  /**
+   * @brief IsEnabled Returns true if the filters measure their phases
+   */
+  static bool IsEnabled()
+  {
+    return s_Enabled.load(std::memory_order_relaxed);
+  }
+
+  void setEnabled(bool enabled);
+
+  /**
+   * @brief setTraceFile Enables monitoring and appends the records of every following filter invocation to
+   * @p fileName, which is truncated first. An empty name closes the trace file but leaves monitoring enabled.
+   * @return false if the file cannot be opened
+   */
+  bool setTraceFile(const QString& fileName);
+  QString getTraceFile() const;
+
+  /**
+   * @brief nextInvocation Returns a new number identifying a filter invocation in the records
+   */
+  quint64 nextInvocation();
+
+  /**
+   * @brief write Appends @p record to the trace file, if any
+   */
+  void write(const PhaseRecord& record);
+
+  /**
+   * @brief elapsedTime Returns the milliseconds elapsed since the creation of the monitor
+   */
+  double elapsedTime(std::chrono::steady_clock::time_point time) const;
+
+  /**
+   * @brief ProcessCpuTime Returns the user and system CPU time used by all the threads of the process, in milliseconds
+   */
+  static double ProcessCpuTime();
+
+  /**
+   * @brief PeakResidentSize Returns the peak resident set size of the process, in bytes
+   */
+  static qint64 PeakResidentSize();
+
+protected:
+  ITKPerformanceMonitor();
+
+private:
+  static std::atomic<bool> s_Enabled;
+
+  mutable QMutex m_Mutex;
+  QFile m_TraceFile;
+  bool m_CSVTrace = false;
+  std::atomic<quint64> m_Invocations;
+  const std::chrono::steady_clock::time_point m_Origin;
+
+public:
+  ITKPerformanceMonitor(const ITKPerformanceMonitor&) = delete;            // Copy Constructor Not Implemented
+  ITKPerformanceMonitor(ITKPerformanceMonitor&&) = delete;                 // Move Constructor Not Implemented
+  ITKPerformanceMonitor& operator=(const ITKPerformanceMonitor&) = delete; // Copy Assignment Not Implemented
+  ITKPerformanceMonitor& operator=(ITKPerformanceMonitor&&) = delete;      // Move Assignment Not Implemented
+};
@@ -0,0 +1,125 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+/**
+ * @brief The ITKPlaneExtractor class copies XZ and YZ planes of a volume stored in X fastest order
+ * into contiguous buffers.
+ *
+ * Several consecutive planes are extracted per pass over the source so that every cache line read
+ * from the volume is used for all of them. YZ planes are a transpose of the volume: the copy is done
+ * in tiles of TileSize tuples so that the rows read for a tile stay in cache while each of the planes
+ * is written. The tuple copy is specialized on the number of components for the common cases (1 to 4).
+ */
+template <typename T> class ITKPlaneExtractor
+{
+public:
+  static const size_t TileSize = 64;
+
+  /**
+   * @param volume First value of the volume
+   * @param dims Number of tuples along X, Y and Z
+   * @param numberOfComponents Number of values per tuple
+   */
+  ITKPlaneExtractor(const T* volume, const size_t dims[3], size_t numberOfComponents)
+  : m_Volume(volume)
+  , m_NumberOfComponents(numberOfComponents)
+  {
+    std::copy(dims, dims + 3, m_Dims);
+  }
+
+  /**
+   * @brief extractXZ Copies the planes y = @p first to @p first + @p count - 1. Plane i is written at
+   * @p planes + i * dims[0] * dims[2] * numberOfComponents, X fastest.
+   */
+  void extractXZ(size_t first, size_t count, T* planes) const
+  {
+    const size_t rowSize = m_Dims[0] * m_NumberOfComponents;
+    const size_t planeSize = rowSize * m_Dims[2];
+    for(size_t z = 0; z < m_Dims[2]; ++z)
+    {
+      // The rows of the planes are consecutive in the volume
+      const T* source = m_Volume + (z * m_Dims[1] + first) * rowSize;
+      for(size_t i = 0; i < count; ++i)
+      {
+        std::copy(source + i * rowSize, source + (i + 1) * rowSize, planes + i * planeSize + z * rowSize);
+      }
+    }
+  }
+
+  /**
+   * @brief extractYZ Copies the planes x = @p first to @p first + @p count - 1. Plane i is written at
+   * @p planes + i * dims[1] * dims[2] * numberOfComponents, Y fastest.
+   */
+  void extractYZ(size_t first, size_t count, T* planes) const
+  {
+    switch(m_NumberOfComponents)
+    {
+    case 1:
+      extractYZ(first, count, planes, TupleCopy<1>());
+      break;
+    case 2:
+      extractYZ(first, count, planes, TupleCopy<2>());
+      break;
+    case 3:
+      extractYZ(first, count, planes, TupleCopy<3>());
+      break;
+    case 4:
+      extractYZ(first, count, planes, TupleCopy<4>());
+      break;
+    default:
+      extractYZ(first, count, planes, TupleCopy<0>(m_NumberOfComponents));
+      break;
+    }
+  }
+
+protected:
+  /**
+   * @brief The TupleCopy struct copies one tuple of NComp values, or of a number of values only known at
+   * run time when NComp is 0.
+   */
+  template <size_t NComp> struct TupleCopy
+  {
+    TupleCopy(size_t numberOfComponents = NComp)
+    : size(NComp > 0 ? NComp : numberOfComponents)
+    {
+    }
+    inline void operator()(T* destination, const T* source) const
+    {
+      for(size_t c = 0; c < (NComp > 0 ? NComp : size); ++c)
+      {
+        destination[c] = source[c];
+      }
+    }
+    const size_t size;
+  };
+
+  template <typename CopyType> void extractYZ(size_t first, size_t count, T* planes, const CopyType& copyTuple) const
+  {
+    const size_t nComp = copyTuple.size;
+    const size_t planeTuples = m_Dims[1] * m_Dims[2];
+    for(size_t tile = 0; tile < planeTuples; tile += TileSize)
+    {
+      const size_t tileEnd = std::min(tile + TileSize, planeTuples);
+      for(size_t i = 0; i < count; ++i)
+      {
+        T* destination = planes + i * planeTuples * nComp;
+        const T* source = m_Volume + (first + i) * nComp;
+        for(size_t zy = tile; zy < tileEnd; ++zy)
+        {
+          copyTuple(destination + zy * nComp, source + zy * m_Dims[0] * nComp);
+        }
+      }
+    }
+  }
+
+private:
+  const T* m_Volume;
+  size_t m_Dims[3];
+  size_t m_NumberOfComponents;
+};
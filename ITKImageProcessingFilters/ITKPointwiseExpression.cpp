@@ -0,0 +1,851 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#include "ITKPointwiseExpression.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
+namespace
+{
+using Opcode = ITKPointwiseExpression::Opcode;
+using Operands = ITKPointwiseExpression::Operands;
+using Instruction = ITKPointwiseExpression::Instruction;
+
+// Operations of the instructions, shared by the evaluation of the programs and the folding of the constants
+struct NegateOp
+{
+  double operator()(double a) const
+  {
+    return -a;
+  }
+};
+struct AbsOp
+{
+  double operator()(double a) const
+  {
+    return std::abs(a);
+  }
+};
+struct SqrtOp
+{
+  double operator()(double a) const
+  {
+    return std::sqrt(a);
+  }
+};
+struct SquareOp
+{
+  double operator()(double a) const
+  {
+    return a * a;
+  }
+};
+struct ExpOp
+{
+  double operator()(double a) const
+  {
+    return std::exp(a);
+  }
+};
+struct LogOp
+{
+  double operator()(double a) const
+  {
+    return std::log(a);
+  }
+};
+struct Log10Op
+{
+  double operator()(double a) const
+  {
+    return std::log10(a);
+  }
+};
+struct SinOp
+{
+  double operator()(double a) const
+  {
+    return std::sin(a);
+  }
+};
+struct CosOp
+{
+  double operator()(double a) const
+  {
+    return std::cos(a);
+  }
+};
+struct TanOp
+{
+  double operator()(double a) const
+  {
+    return std::tan(a);
+  }
+};
+struct AsinOp
+{
+  double operator()(double a) const
+  {
+    return std::asin(a);
+  }
+};
+struct AcosOp
+{
+  double operator()(double a) const
+  {
+    return std::acos(a);
+  }
+};
+struct AtanOp
+{
+  double operator()(double a) const
+  {
+    return std::atan(a);
+  }
+};
+struct FloorOp
+{
+  double operator()(double a) const
+  {
+    return std::floor(a);
+  }
+};
+struct CeilOp
+{
+  double operator()(double a) const
+  {
+    return std::ceil(a);
+  }
+};
+struct AddOp
+{
+  double operator()(double a, double b) const
+  {
+    return a + b;
+  }
+};
+struct SubtractOp
+{
+  double operator()(double a, double b) const
+  {
+    return a - b;
+  }
+};
+struct MultiplyOp
+{
+  double operator()(double a, double b) const
+  {
+    return a * b;
+  }
+};
+struct DivideOp
+{
+  double operator()(double a, double b) const
+  {
+    return a / b;
+  }
+};
+struct PowerOp
+{
+  double operator()(double a, double b) const
+  {
+    return std::pow(a, b);
+  }
+};
+struct MinimumOp
+{
+  double operator()(double a, double b) const
+  {
+    return b < a ? b : a;
+  }
+};
+struct MaximumOp
+{
+  double operator()(double a, double b) const
+  {
+    return a < b ? b : a;
+  }
+};
+
+/**
+ * @brief UnaryLoop Applies @p op to the @p count values of @p a
+ */
+template <typename Op> void UnaryLoop(double* a, size_t count, Op op)
+{
+  for(size_t i = 0; i < count; i++)
+  {
+    a[i] = op(a[i]);
+  }
+}
+
+/**
+ * @brief BinaryLoop Applies @p op to the @p count values of @p a and those of @p b, or @p constant
+ */
+template <typename Op> void BinaryLoop(double* a, const double* b, double constant, Operands operands, size_t count, Op op)
+{
+  switch(operands)
+  {
+  case Operands::Stack:
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = op(a[i], b[i]);
+    }
+    break;
+  case Operands::StackConstant:
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = op(a[i], constant);
+    }
+    break;
+  case Operands::ConstantStack:
+    for(size_t i = 0; i < count; i++)
+    {
+      a[i] = op(constant, a[i]);
+    }
+    break;
+  }
+}
+
+/**
+ * @brief Run Runs @p program on the @p count values of @p values. Stack slot k of the program is
+ * scratch[k * BlockSize, (k + 1) * BlockSize).
+ */
+void Run(const std::vector<Instruction>& program, double* values, size_t count, double* scratch)
+{
+  const size_t blockSize = ITKPointwiseExpression::BlockSize;
+  size_t depth = 0;
+  for(const Instruction& instruction : program)
+  {
+    double* top = scratch + (depth > 0 ? depth - 1 : 0) * blockSize;
+    switch(instruction.opcode)
+    {
+    case Opcode::Variable:
+      std::copy(values, values + count, scratch + depth * blockSize);
+      depth++;
+      break;
+    case Opcode::Constant:
+      std::fill(scratch + depth * blockSize, scratch + depth * blockSize + count, instruction.constant);
+      depth++;
+      break;
+    case Opcode::Negate:
+      UnaryLoop(top, count, NegateOp());
+      break;
+    case Opcode::Abs:
+      UnaryLoop(top, count, AbsOp());
+      break;
+    case Opcode::Sqrt:
+      UnaryLoop(top, count, SqrtOp());
+      break;
+    case Opcode::Square:
+      UnaryLoop(top, count, SquareOp());
+      break;
+    case Opcode::Exp:
+      UnaryLoop(top, count, ExpOp());
+      break;
+    case Opcode::Log:
+      UnaryLoop(top, count, LogOp());
+      break;
+    case Opcode::Log10:
+      UnaryLoop(top, count, Log10Op());
+      break;
+    case Opcode::Sin:
+      UnaryLoop(top, count, SinOp());
+      break;
+    case Opcode::Cos:
+      UnaryLoop(top, count, CosOp());
+      break;
+    case Opcode::Tan:
+      UnaryLoop(top, count, TanOp());
+      break;
+    case Opcode::Asin:
+      UnaryLoop(top, count, AsinOp());
+      break;
+    case Opcode::Acos:
+      UnaryLoop(top, count, AcosOp());
+      break;
+    case Opcode::Atan:
+      UnaryLoop(top, count, AtanOp());
+      break;
+    case Opcode::Floor:
+      UnaryLoop(top, count, FloorOp());
+      break;
+    case Opcode::Ceil:
+      UnaryLoop(top, count, CeilOp());
+      break;
+    default:
+    {
+      // Binary instructions either pop the value on top of the stack or use their constant
+      double* a = top;
+      const double* b = top;
+      if(instruction.operands == Operands::Stack)
+      {
+        a = top - blockSize;
+        depth--;
+      }
+      switch(instruction.opcode)
+      {
+      case Opcode::Add:
+        BinaryLoop(a, b, instruction.constant, instruction.operands, count, AddOp());
+        break;
+      case Opcode::Subtract:
+        BinaryLoop(a, b, instruction.constant, instruction.operands, count, SubtractOp());
+        break;
+      case Opcode::Multiply:
+        BinaryLoop(a, b, instruction.constant, instruction.operands, count, MultiplyOp());
+        break;
+      case Opcode::Divide:
+        BinaryLoop(a, b, instruction.constant, instruction.operands, count, DivideOp());
+        break;
+      case Opcode::Power:
+        BinaryLoop(a, b, instruction.constant, instruction.operands, count, PowerOp());
+        break;
+      case Opcode::Minimum:
+        BinaryLoop(a, b, instruction.constant, instruction.operands, count, MinimumOp());
+        break;
+      case Opcode::Maximum:
+        BinaryLoop(a, b, instruction.constant, instruction.operands, count, MaximumOp());
+        break;
+      default:
+        break;
+      }
+    }
+    }
+  }
+  std::copy(scratch, scratch + count, values);
+}
+
+/**
+ * @brief The Node struct is a node of the syntax tree of an expression
+ */
+struct Node
+{
+  using Pointer = std::shared_ptr<Node>;
+
+  Opcode opcode;
+  double value;
+  std::vector<Pointer> children;
+
+  bool isConstant() const
+  {
+    return opcode == Opcode::Constant;
+  }
+};
+
+Node::Pointer MakeConstant(double value)
+{
+  Node::Pointer node = std::make_shared<Node>();
+  node->opcode = Opcode::Constant;
+  node->value = value;
+  return node;
+}
+
+Node::Pointer MakeVariable()
+{
+  Node::Pointer node = std::make_shared<Node>();
+  node->opcode = Opcode::Variable;
+  node->value = 0.0;
+  return node;
+}
+
+/**
+ * @brief MakeOperation Returns the operation @p opcode of @p children, computed right away if all of them
+ * are constants
+ */
+Node::Pointer MakeOperation(Opcode opcode, const std::vector<Node::Pointer>& children)
+{
+  bool constant = true;
+  std::vector<Instruction> program;
+  for(const Node::Pointer& child : children)
+  {
+    constant = constant && child->isConstant();
+    program.push_back({Opcode::Constant, Operands::Stack, child->value});
+  }
+  if(constant)
+  {
+    program.push_back({opcode, Operands::Stack, 0.0});
+    double value = 0.0;
+    std::vector<double> scratch(children.size() * ITKPointwiseExpression::BlockSize);
+    Run(program, &value, 1, scratch.data());
+    return MakeConstant(value);
+  }
+  Node::Pointer node = std::make_shared<Node>();
+  node->opcode = opcode;
+  node->value = 0.0;
+  node->children = children;
+  return node;
+}
+
+Node::Pointer MakeOperation(Opcode opcode, const Node::Pointer& a)
+{
+  return MakeOperation(opcode, std::vector<Node::Pointer>{a});
+}
+
+Node::Pointer MakeOperation(Opcode opcode, const Node::Pointer& a, const Node::Pointer& b)
+{
+  return MakeOperation(opcode, std::vector<Node::Pointer>{a, b});
+}
+
+/**
+ * @brief The Parser class builds the syntax tree of an expression by recursive descent
+ */
+class Parser
+{
+public:
+  explicit Parser(const QString& text)
+  : m_Text(text)
+  , m_Position(0)
+  {
+  }
+
+  Node::Pointer parse()
+  {
+    skipSpaces();
+    if(m_Position >= m_Text.size())
+    {
+      setError("The expression is empty");
+      return Node::Pointer();
+    }
+    Node::Pointer node = parseSum();
+    if(node && m_Position < m_Text.size())
+    {
+      setError(QString("Unexpected '%1'").arg(m_Text[m_Position]));
+      return Node::Pointer();
+    }
+    return node;
+  }
+
+  QString getError() const
+  {
+    return m_Error;
+  }
+
+private:
+  QString m_Text;
+  int m_Position;
+  QString m_Error;
+
+  void setError(const QString& message)
+  {
+    if(m_Error.isEmpty())
+    {
+      m_Error = QString("%1 at character %2 of the expression").arg(message).arg(m_Position + 1);
+    }
+  }
+
+  void skipSpaces()
+  {
+    while(m_Position < m_Text.size() && m_Text[m_Position].isSpace())
+    {
+      m_Position++;
+    }
+  }
+
+  bool accept(QChar c)
+  {
+    skipSpaces();
+    if(m_Position < m_Text.size() && m_Text[m_Position] == c)
+    {
+      m_Position++;
+      skipSpaces();
+      return true;
+    }
+    return false;
+  }
+
+  // sum := product (('+' | '-') product)*
+  Node::Pointer parseSum()
+  {
+    Node::Pointer node = parseProduct();
+    while(node)
+    {
+      if(accept('+'))
+      {
+        Node::Pointer right = parseProduct();
+        node = right ? MakeOperation(Opcode::Add, node, right) : right;
+      }
+      else if(accept('-'))
+      {
+        Node::Pointer right = parseProduct();
+        node = right ? MakeOperation(Opcode::Subtract, node, right) : right;
+      }
+      else
+      {
+        break;
+      }
+    }
+    return node;
+  }
+
+  // product := unary (('*' | '/') unary)*
+  Node::Pointer parseProduct()
+  {
+    Node::Pointer node = parseUnary();
+    while(node)
+    {
+      if(accept('*'))
+      {
+        Node::Pointer right = parseUnary();
+        node = right ? MakeOperation(Opcode::Multiply, node, right) : right;
+      }
+      else if(accept('/'))
+      {
+        Node::Pointer right = parseUnary();
+        node = right ? MakeOperation(Opcode::Divide, node, right) : right;
+      }
+      else
+      {
+        break;
+      }
+    }
+    return node;
+  }
+
+  // unary := ('-' | '+') unary | power
+  Node::Pointer parseUnary()
+  {
+    if(accept('-'))
+    {
+      Node::Pointer node = parseUnary();
+      return node ? MakeOperation(Opcode::Negate, node) : node;
+    }
+    if(accept('+'))
+    {
+      return parseUnary();
+    }
+    return parsePower();
+  }
+
+  // power := primary ('^' unary)?, so that -x^2 is -(x^2) and x^2^3 is x^(2^3)
+  Node::Pointer parsePower()
+  {
+    Node::Pointer node = parsePrimary();
+    if(node && accept('^'))
+    {
+      Node::Pointer exponent = parseUnary();
+      node = exponent ? MakeOperation(Opcode::Power, node, exponent) : exponent;
+    }
+    return node;
+  }
+
+  // primary := number | identifier | identifier '(' arguments ')' | '(' sum ')'
+  Node::Pointer parsePrimary()
+  {
+    skipSpaces();
+    if(m_Position >= m_Text.size())
+    {
+      setError("Unexpected end");
+      return Node::Pointer();
+    }
+    const QChar c = m_Text[m_Position];
+    if(accept('('))
+    {
+      Node::Pointer node = parseSum();
+      if(node && !accept(')'))
+      {
+        setError("Missing ')'");
+        return Node::Pointer();
+      }
+      return node;
+    }
+    if(c.isDigit() || c == '.')
+    {
+      return parseNumber();
+    }
+    if(c.isLetter() || c == '_')
+    {
+      return parseIdentifier();
+    }
+    setError(QString("Unexpected '%1'").arg(c));
+    return Node::Pointer();
+  }
+
+  Node::Pointer parseNumber()
+  {
+    const int start = m_Position;
+    while(m_Position < m_Text.size() && (m_Text[m_Position].isDigit() || m_Text[m_Position] == '.'))
+    {
+      m_Position++;
+    }
+    if(m_Position < m_Text.size() && (m_Text[m_Position] == 'e' || m_Text[m_Position] == 'E'))
+    {
+      int end = m_Position + 1;
+      if(end < m_Text.size() && (m_Text[end] == '+' || m_Text[end] == '-'))
+      {
+        end++;
+      }
+      if(end < m_Text.size() && m_Text[end].isDigit())
+      {
+        m_Position = end;
+        while(m_Position < m_Text.size() && m_Text[m_Position].isDigit())
+        {
+          m_Position++;
+        }
+      }
+    }
+    bool ok = false;
+    const double value = m_Text.mid(start, m_Position - start).toDouble(&ok);
+    if(!ok)
+    {
+      m_Position = start;
+      setError("Invalid number");
+      return Node::Pointer();
+    }
+    skipSpaces();
+    return MakeConstant(value);
+  }
+
+  Node::Pointer parseIdentifier()
+  {
+    const int start = m_Position;
+    while(m_Position < m_Text.size() && (m_Text[m_Position].isLetterOrNumber() || m_Text[m_Position] == '_'))
+    {
+      m_Position++;
+    }
+    const QString name = m_Text.mid(start, m_Position - start).toLower();
+    skipSpaces();
+    if(m_Position >= m_Text.size() || m_Text[m_Position] != '(')
+    {
+      if(name == "x")
+      {
+        return MakeVariable();
+      }
+      if(name == "pi")
+      {
+        return MakeConstant(3.14159265358979323846);
+      }
+      m_Position = start;
+      setError(QString("Unknown variable '%1'").arg(name));
+      return Node::Pointer();
+    }
+
+    accept('(');
+    std::vector<Node::Pointer> arguments;
+    if(!accept(')'))
+    {
+      do
+      {
+        Node::Pointer argument = parseSum();
+        if(!argument)
+        {
+          return argument;
+        }
+        arguments.push_back(argument);
+      } while(accept(','));
+      if(!accept(')'))
+      {
+        setError("Missing ')'");
+        return Node::Pointer();
+      }
+    }
+    const int end = m_Position;
+    m_Position = start;
+    Node::Pointer node = makeFunction(name, arguments);
+    m_Position = end;
+    return node;
+  }
+
+  /**
+   * @brief makeFunction Returns the call of function @p name, the functions of the pointwise ITK filters
+   * being written with the operations of the programs
+   */
+  Node::Pointer makeFunction(const QString& name, const std::vector<Node::Pointer>& args)
+  {
+    struct Function
+    {
+      const char* name;
+      size_t arity;
+      Opcode opcode;
+    };
+    static const Function functions[] = {{"abs", 1, Opcode::Abs},   {"sqrt", 1, Opcode::Sqrt},       {"square", 1, Opcode::Square}, {"exp", 1, Opcode::Exp},   {"log", 1, Opcode::Log},
+                                         {"log10", 1, Opcode::Log10}, {"sin", 1, Opcode::Sin},       {"cos", 1, Opcode::Cos},       {"tan", 1, Opcode::Tan},   {"asin", 1, Opcode::Asin},
+                                         {"acos", 1, Opcode::Acos},   {"atan", 1, Opcode::Atan},     {"floor", 1, Opcode::Floor},   {"ceil", 1, Opcode::Ceil}, {"min", 2, Opcode::Minimum},
+                                         {"max", 2, Opcode::Maximum}, {"pow", 2, Opcode::Power}};
+    for(const Function& function : functions)
+    {
+      if(name == function.name)
+      {
+        if(!checkArity(name, args, function.arity))
+        {
+          return Node::Pointer();
+        }
+        return MakeOperation(function.opcode, args);
+      }
+    }
+
+    if(name == "expneg" && checkArity(name, args, 1))
+    {
+      return MakeOperation(Opcode::Exp, MakeOperation(Opcode::Negate, args[0]));
+    }
+    if(name == "boundedreciprocal" && checkArity(name, args, 1))
+    {
+      return MakeOperation(Opcode::Divide, MakeConstant(1.0), MakeOperation(Opcode::Add, MakeConstant(1.0), args[0]));
+    }
+    if(name == "clamp" && checkArity(name, args, 3))
+    {
+      return MakeOperation(Opcode::Minimum, MakeOperation(Opcode::Maximum, args[0], args[1]), args[2]);
+    }
+    if(name == "shiftscale" && checkArity(name, args, 3))
+    {
+      return MakeOperation(Opcode::Multiply, MakeOperation(Opcode::Add, args[0], args[1]), args[2]);
+    }
+    if(name == "invert" && checkArity(name, args, 2))
+    {
+      return MakeOperation(Opcode::Subtract, args[1], args[0]);
+    }
+    if(name == "sigmoid" && checkArity(name, args, 5))
+    {
+      // (outputMaximum - outputMinimum) / (1 + exp(-(a - beta) / alpha)) + outputMinimum
+      Node::Pointer exponent = MakeOperation(Opcode::Negate, MakeOperation(Opcode::Divide, MakeOperation(Opcode::Subtract, args[0], args[2]), args[1]));
+      Node::Pointer denominator = MakeOperation(Opcode::Add, MakeConstant(1.0), MakeOperation(Opcode::Exp, exponent));
+      Node::Pointer range = MakeOperation(Opcode::Subtract, args[4], args[3]);
+      return MakeOperation(Opcode::Add, MakeOperation(Opcode::Divide, range, denominator), args[3]);
+    }
+    if(m_Error.isEmpty())
+    {
+      setError(QString("Unknown function '%1'").arg(name));
+    }
+    return Node::Pointer();
+  }
+
+  bool checkArity(const QString& name, const std::vector<Node::Pointer>& args, size_t arity)
+  {
+    if(args.size() != arity)
+    {
+      setError(QString("Function '%1' takes %2 argument(s), not %3").arg(name).arg(arity).arg(args.size()));
+      return false;
+    }
+    return true;
+  }
+};
+
+/**
+ * @brief Emit Appends the instructions computing @p node to @p program
+ */
+void Emit(const Node::Pointer& node, std::vector<Instruction>& program, size_t& depth, size_t& maxDepth)
+{
+  switch(node->children.size())
+  {
+  case 0:
+    program.push_back({node->opcode, Operands::Stack, node->value});
+    depth++;
+    maxDepth = std::max(maxDepth, depth);
+    break;
+  case 1:
+    Emit(node->children[0], program, depth, maxDepth);
+    program.push_back({node->opcode, Operands::Stack, 0.0});
+    break;
+  default:
+  {
+    // Constants are folded, at most one of the operands is a constant
+    const Node::Pointer& left = node->children[0];
+    const Node::Pointer& right = node->children[1];
+    if(right->isConstant())
+    {
+      Emit(left, program, depth, maxDepth);
+      program.push_back({node->opcode, Operands::StackConstant, right->value});
+    }
+    else if(left->isConstant())
+    {
+      Emit(right, program, depth, maxDepth);
+      program.push_back({node->opcode, Operands::ConstantStack, left->value});
+    }
+    else
+    {
+      Emit(left, program, depth, maxDepth);
+      Emit(right, program, depth, maxDepth);
+      program.push_back({node->opcode, Operands::Stack, 0.0});
+      depth--;
+    }
+  }
+  }
+}
+} // namespace
+
+const size_t ITKPointwiseExpression::BlockSize;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKPointwiseExpression::ITKPointwiseExpression()
+: m_StackDepth(0)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKPointwiseExpression::~ITKPointwiseExpression() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKPointwiseExpression::compile(const QString& expression)
+{
+  m_Program.clear();
+  m_StackDepth = 0;
+  m_ErrorMessage.clear();
+
+  Parser parser(expression);
+  Node::Pointer root = parser.parse();
+  if(!root)
+  {
+    m_ErrorMessage = parser.getError();
+    return false;
+  }
+  size_t depth = 0;
+  Emit(root, m_Program, depth, m_StackDepth);
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKPointwiseExpression::isValid() const
+{
+  return !m_Program.empty();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ITKPointwiseExpression::getErrorMessage() const
+{
+  return m_ErrorMessage;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ITKPointwiseExpression::getNumberOfInstructions() const
+{
+  return m_Program.size();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+size_t ITKPointwiseExpression::getScratchSize() const
+{
+  return m_StackDepth * BlockSize;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKPointwiseExpression::evaluate(double* values, size_t count, double* scratch) const
+{
+  Run(m_Program, values, std::min(count, BlockSize), scratch);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+double ITKPointwiseExpression::evaluate(double x) const
+{
+  std::vector<double> scratch(getScratchSize());
+  evaluate(&x, 1, scratch.data());
+  return x;
+}
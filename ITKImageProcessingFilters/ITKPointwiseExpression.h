@@ -0,0 +1,131 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <QtCore/QString>
+
+#include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+
+/**
+ * @brief The ITKPointwiseExpression class compiles an expression of the pixel value x, such as
+ * "sqrt(abs(x - 100)) * 2", into a program that evaluates it on blocks of values.
+ *
+ * The expression uses numbers, x, pi, the operators + - * / ^ (power), parentheses and the functions
+ * abs, sqrt, square, exp, expneg (exp(-x)), log, log10, sin, cos, tan, asin, acos, atan, floor, ceil,
+ * min(a, b), max(a, b), pow(a, b), clamp(a, low, high), shiftscale(a, shift, scale) ((a + shift) * scale),
+ * invert(a, maximum) (maximum - a), boundedreciprocal(a) (1 / (1 + a)) and
+ * sigmoid(a, alpha, beta, outputMinimum, outputMaximum), the functions of the pointwise ITK filters.
+ *
+ * Sub-expressions that do not depend on x are computed once by compile(). Each instruction of the program
+ * is then applied to a whole block of values at once, in a loop the compiler can vectorize, instead of
+ * interpreting the expression pixel by pixel.
+ */
+class ITKImageProcessing_EXPORT ITKPointwiseExpression
+{
+public:
+  /**
+   * @brief Largest number of values given to evaluate() at once
+   */
+  static const size_t BlockSize = 1024;
+
+  ITKPointwiseExpression();
+  ~ITKPointwiseExpression();
+
+  ITKPointwiseExpression(const ITKPointwiseExpression&) = default;
+  ITKPointwiseExpression(ITKPointwiseExpression&&) = default;
+  ITKPointwiseExpression& operator=(const ITKPointwiseExpression&) = default;
+  ITKPointwiseExpression& operator=(ITKPointwiseExpression&&) = default;
+
+  /**
+   * @brief compile Compiles @p expression, replacing the current program
+   * @return false if the expression is not valid, see getErrorMessage()
+   */
+  bool compile(const QString& expression);
+
+  /**
+   * @brief isValid Returns true if an expression was successfully compiled
+   */
+  bool isValid() const;
+
+  /**
+   * @brief getErrorMessage Returns why the last compile() failed
+   */
+  QString getErrorMessage() const;
+
+  /**
+   * @brief getNumberOfInstructions Returns the number of instructions of the program, each one a pass
+   * over a block of values
+   */
+  size_t getNumberOfInstructions() const;
+
+  /**
+   * @brief getScratchSize Returns the number of values of the scratch buffer evaluate() needs
+   */
+  size_t getScratchSize() const;
+
+  /**
+   * @brief evaluate Replaces the @p count values of @p values, at most BlockSize, by the value of the
+   * expression. @p scratch must hold getScratchSize() values.
+   */
+  void evaluate(double* values, size_t count, double* scratch) const;
+
+  /**
+   * @brief evaluate Returns the value of the expression for @p x
+   */
+  double evaluate(double x) const;
+
+  enum class Opcode : int
+  {
+    Variable,
+    Constant,
+    Negate,
+    Abs,
+    Sqrt,
+    Square,
+    Exp,
+    Log,
+    Log10,
+    Sin,
+    Cos,
+    Tan,
+    Asin,
+    Acos,
+    Atan,
+    Floor,
+    Ceil,
+    Add,
+    Subtract,
+    Multiply,
+    Divide,
+    Power,
+    Minimum,
+    Maximum
+  };
+
+  /**
+   * @brief Operands of a binary instruction: the two values on top of the stack, the value on top of the
+   * stack and a constant, or a constant and the value on top of the stack
+   */
+  enum class Operands : int
+  {
+    Stack,
+    StackConstant,
+    ConstantStack
+  };
+
+  struct Instruction
+  {
+    Opcode opcode;
+    Operands operands;
+    double constant;
+  };
+
+private:
+  std::vector<Instruction> m_Program;
+  size_t m_StackDepth;
+  QString m_ErrorMessage;
+};
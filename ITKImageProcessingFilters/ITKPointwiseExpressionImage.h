@@ -0,0 +1,110 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Winconsistent-missing-override"
+#endif
+
+#include "ITKImageProcessingBase.h"
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKPointwiseExpression.h"
+
+/**
+ * @brief The ITKPointwiseExpressionImage class. See [Filter documentation](@ref ITKPointwiseExpressionImage) for details.
+ */
+class ITKImageProcessing_EXPORT ITKPointwiseExpressionImage : public ITKImageProcessingBase
+{
+  Q_OBJECT
+  PYB11_CREATE_BINDINGS(ITKPointwiseExpressionImage SUPERCLASS ITKImageProcessingBase)
+  PYB11_PROPERTY(QString Expression READ getExpression WRITE setExpression)
+
+public:
+  SIMPL_SHARED_POINTERS(ITKPointwiseExpressionImage)
+  SIMPL_FILTER_NEW_MACRO(ITKPointwiseExpressionImage)
+  SIMPL_TYPE_MACRO_SUPER_OVERRIDE(ITKPointwiseExpressionImage, AbstractFilter)
+
+  ~ITKPointwiseExpressionImage() override;
+
+  SIMPL_FILTER_PARAMETER(QString, Expression)
+  Q_PROPERTY(QString Expression READ getExpression WRITE setExpression)
+
+  /**
+   * @brief newFilterInstance Reimplemented from @see AbstractFilter class
+   */
+  AbstractFilter::Pointer newFilterInstance(bool copyFilterParameters) const override;
+
+  /**
+   * @brief getHumanLabel Reimplemented from @see AbstractFilter class
+   */
+  const QString getHumanLabel() const override;
+
+  /**
+   * @brief getSubGroupName Reimplemented from @see AbstractFilter class
+   */
+  const QString getSubGroupName() const override;
+
+  /**
+   * @brief getUuid Return the unique identifier for this filter.
+   * @return A QUuid object.
+   */
+  const QUuid getUuid() override;
+
+  /**
+   * @brief setupFilterParameters Reimplemented from @see AbstractFilter class
+   */
+  void setupFilterParameters() override;
+
+  /**
+   * @brief readFilterParameters Reimplemented from @see AbstractFilter class
+   */
+  void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
+
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class
+   */
+  bool isStreamable() const override;
+
+protected:
+  ITKPointwiseExpressionImage();
+
+  /**
+   * @brief dataCheckInternal overloads dataCheckInternal in ITKImageBase and calls templated dataCheck
+   */
+  void virtual dataCheckInternal() override;
+
+  /**
+   * @brief dataCheck Checks for the appropriate parameter values and availability of arrays
+   */
+  template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void dataCheck();
+
+  /**
+   * @brief filterInternal overloads filterInternal in ITKImageBase and calls templated filter
+   */
+  void virtual filterInternal() override;
+
+  /**
+   * @brief Applies the filter
+   */
+  template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
+
+private:
+  ITKPointwiseExpression m_CompiledExpression;
+
+public:
+  ITKPointwiseExpressionImage(const ITKPointwiseExpressionImage&) = delete;            // Copy Constructor Not Implemented
+  ITKPointwiseExpressionImage(ITKPointwiseExpressionImage&&) = delete;                 // Move Constructor Not Implemented
+  ITKPointwiseExpressionImage& operator=(const ITKPointwiseExpressionImage&) = delete; // Copy Assignment Not Implemented
+  ITKPointwiseExpressionImage& operator=(ITKPointwiseExpressionImage&&) = delete;      // Move Assignment Not Implemented
+};
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,814 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKProjectionStatisticsImage.h"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
+#include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
+#include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
+#include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
+#include "SIMPLib/FilterParameters/StringFilterParameter.h"
+
+#include "SIMPLib/Geometry/ImageGeom.h"
+
+#include "SIMPLib/ITK/Dream3DTemplateAliasMacro.h"
+
+#include "ITKImageProcessing/ITKImageProcessingConstants.h"
+#include "ITKImageProcessing/ITKImageProcessingVersion.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKParallelFor.h"
+
+namespace
+{
+// Slices swept between two merges of the partial projections along Y
+const size_t k_SlabSlices = 8;
+// Rows of a task. It does not depend on the number of threads, so that neither do the results.
+const size_t k_BlockRows = 64;
+
+const QString k_MaximumName("Maximum");
+const QString k_MinimumName("Minimum");
+const QString k_MeanName("Mean");
+const QString k_StandardDeviationName("StandardDeviation");
+const QString k_SumName("Sum");
+
+/**
+ * @brief The Statistics struct lists the statistics to compute
+ */
+struct Statistics
+{
+  bool maximum;
+  bool minimum;
+  bool mean;
+  bool standardDeviation;
+  bool sum;
+
+  bool moments() const
+  {
+    return mean || standardDeviation;
+  }
+};
+
+/**
+ * @brief The Accumulator class holds the running statistics of the pixels of a projection plane. The
+ * maximum, minimum, mean, standard deviation and sum live in the output arrays when those are given,
+ * the standard deviation holding the sum of the squared deviations (Welford's M2) until finalize(). The
+ * mean and M2 are updated with Welford's algorithm and the sum is compensated (Kahan).
+ */
+template <typename T> class Accumulator
+{
+public:
+  Accumulator()
+  : m_Statistics({false, false, false, false, false})
+  , m_Maximum(nullptr)
+  , m_Minimum(nullptr)
+  , m_Mean(nullptr)
+  , m_M2(nullptr)
+  , m_Sum(nullptr)
+  , m_Compensation(nullptr)
+  {
+  }
+
+  /**
+   * @brief setup Prepares @p size entries, stored in the given outputs or, for the null ones that the
+   * statistics need, in buffers of the accumulator
+   */
+  void setup(size_t size, const Statistics& statistics, T* maximum, T* minimum, double* mean, double* standardDeviation, double* sum)
+  {
+    m_Statistics = statistics;
+    m_Maximum = Storage(statistics.maximum, maximum, m_MaximumStorage, size);
+    m_Minimum = Storage(statistics.minimum, minimum, m_MinimumStorage, size);
+    m_Mean = Storage(statistics.moments(), mean, m_MeanStorage, size);
+    m_M2 = Storage(statistics.moments(), standardDeviation, m_M2Storage, size);
+    m_Sum = Storage(statistics.sum, sum, m_SumStorage, size);
+    m_Compensation = Storage<double>(statistics.sum, nullptr, m_CompensationStorage, size);
+    reset(0, size);
+  }
+
+  /**
+   * @brief reset Empties the entries [@p begin, @p end)
+   */
+  void reset(size_t begin, size_t end)
+  {
+    for(size_t i = begin; i < end; i++)
+    {
+      if(m_Statistics.maximum)
+      {
+        m_Maximum[i] = std::numeric_limits<T>::lowest();
+      }
+      if(m_Statistics.minimum)
+      {
+        m_Minimum[i] = std::numeric_limits<T>::max();
+      }
+      if(m_Statistics.moments())
+      {
+        m_Mean[i] = 0.0;
+        m_M2[i] = 0.0;
+      }
+      if(m_Statistics.sum)
+      {
+        m_Sum[i] = 0.0;
+        m_Compensation[i] = 0.0;
+      }
+    }
+  }
+
+  /**
+   * @brief add Adds @p values[i] to entry @p offset + i, for i in [0, @p count). Each entry already holds
+   * the same number of values, n - 1 with @p inverseCount = 1 / n.
+   */
+  void add(size_t offset, const T* values, size_t count, double inverseCount)
+  {
+    // One loop per statistic, each of which the compiler can vectorize
+    if(m_Statistics.maximum)
+    {
+      T* maximum = m_Maximum + offset;
+      for(size_t i = 0; i < count; i++)
+      {
+        maximum[i] = values[i] > maximum[i] ? values[i] : maximum[i];
+      }
+    }
+    if(m_Statistics.minimum)
+    {
+      T* minimum = m_Minimum + offset;
+      for(size_t i = 0; i < count; i++)
+      {
+        minimum[i] = values[i] < minimum[i] ? values[i] : minimum[i];
+      }
+    }
+    if(m_Statistics.moments())
+    {
+      double* mean = m_Mean + offset;
+      double* m2 = m_M2 + offset;
+      for(size_t i = 0; i < count; i++)
+      {
+        const double value = static_cast<double>(values[i]);
+        const double delta = value - mean[i];
+        mean[i] += delta * inverseCount;
+        m2[i] += delta * (value - mean[i]);
+      }
+    }
+    if(m_Statistics.sum)
+    {
+      double* sum = m_Sum + offset;
+      double* compensation = m_Compensation + offset;
+      for(size_t i = 0; i < count; i++)
+      {
+        const double y = static_cast<double>(values[i]) - compensation[i];
+        const double t = sum[i] + y;
+        compensation[i] = (t - sum[i]) - y;
+        sum[i] = t;
+      }
+    }
+  }
+
+  /**
+   * @brief merge Merges entry @p j of @p other, which holds @p otherCount values, into entry @p i, which
+   * holds @p count values (Chan et al.)
+   */
+  void merge(size_t i, double count, const Accumulator& other, size_t j, double otherCount)
+  {
+    if(m_Statistics.maximum)
+    {
+      m_Maximum[i] = other.m_Maximum[j] > m_Maximum[i] ? other.m_Maximum[j] : m_Maximum[i];
+    }
+    if(m_Statistics.minimum)
+    {
+      m_Minimum[i] = other.m_Minimum[j] < m_Minimum[i] ? other.m_Minimum[j] : m_Minimum[i];
+    }
+    if(m_Statistics.moments())
+    {
+      const double total = count + otherCount;
+      const double delta = other.m_Mean[j] - m_Mean[i];
+      m_Mean[i] += delta * otherCount / total;
+      m_M2[i] += other.m_M2[j] + delta * delta * count * otherCount / total;
+    }
+    if(m_Statistics.sum)
+    {
+      addCompensated(i, other.m_Sum[j]);
+      addCompensated(i, -other.m_Compensation[j]);
+    }
+  }
+
+  /**
+   * @brief finalize Turns the entries [@p begin, @p end), which hold @p count values each, into the
+   * statistics: the standard deviation (with count - 1 degrees of freedom, as the ITK projection) and the
+   * compensated sum
+   */
+  void finalize(size_t begin, size_t end, double count)
+  {
+    for(size_t i = begin; i < end; i++)
+    {
+      if(m_Statistics.standardDeviation)
+      {
+        m_M2[i] = count > 1.0 ? std::sqrt(m_M2[i] / (count - 1.0)) : 0.0;
+      }
+      if(m_Statistics.sum)
+      {
+        m_Sum[i] -= m_Compensation[i];
+        m_Compensation[i] = 0.0;
+      }
+    }
+  }
+
+private:
+  Statistics m_Statistics;
+  T* m_Maximum;
+  T* m_Minimum;
+  double* m_Mean;
+  double* m_M2;
+  double* m_Sum;
+  double* m_Compensation;
+  std::vector<T> m_MaximumStorage;
+  std::vector<T> m_MinimumStorage;
+  std::vector<double> m_MeanStorage;
+  std::vector<double> m_M2Storage;
+  std::vector<double> m_SumStorage;
+  std::vector<double> m_CompensationStorage;
+
+  template <typename V> static V* Storage(bool needed, V* output, std::vector<V>& storage, size_t size)
+  {
+    if(!needed)
+    {
+      return nullptr;
+    }
+    if(nullptr != output)
+    {
+      return output;
+    }
+    storage.resize(size);
+    return storage.data();
+  }
+
+  void addCompensated(size_t i, double value)
+  {
+    const double y = value - m_Compensation[i];
+    const double t = m_Sum[i] + y;
+    m_Compensation[i] = (t - m_Sum[i]) - y;
+    m_Sum[i] = t;
+  }
+};
+
+/**
+ * @brief The ProjectionSweep class computes the projections of a volume along X, Y and Z in one sweep.
+ *
+ * The rows of each slab of slices are split in blocks of k_BlockRows rows, processed concurrently. Each
+ * row is read once and used for all the projections:
+ * - along X, the row is the whole projected line: its statistics are computed right away, with two passes
+ *   over the row while it is in the cache;
+ * - along Z, the row is added to the accumulators of its own (x, y) pixels, which belong to its block;
+ * - along Y, the row is added to the partial accumulators of its block, merged in the order of the blocks
+ *   at the end of the slab.
+ */
+template <typename T> class ProjectionSweep
+{
+public:
+  struct Outputs
+  {
+    T* maximum;
+    T* minimum;
+    double* mean;
+    double* standardDeviation;
+    double* sum;
+  };
+
+  ProjectionSweep(const T* data, size_t nx, size_t ny, size_t nz, const Statistics& statistics)
+  : m_Data(data)
+  , m_Statistics(statistics)
+  , m_NumberOfBlocks((ny + k_BlockRows - 1) / k_BlockRows)
+  {
+    m_Dimensions[0] = nx;
+    m_Dimensions[1] = ny;
+    m_Dimensions[2] = nz;
+    m_Project[0] = m_Project[1] = m_Project[2] = false;
+  }
+
+  /**
+   * @brief setOutputs Requests the projection along @p axis, written in @p outputs
+   */
+  void setOutputs(int axis, const Outputs& outputs)
+  {
+    const size_t nx = m_Dimensions[0];
+    const size_t ny = m_Dimensions[1];
+    const size_t nz = m_Dimensions[2];
+    m_Project[axis] = true;
+    if(axis == 0)
+    {
+      m_XOutputs = outputs;
+    }
+    else if(axis == 1)
+    {
+      m_YAccumulator.setup(nx * nz, m_Statistics, outputs.maximum, outputs.minimum, outputs.mean, outputs.standardDeviation, outputs.sum);
+      m_YPartials.resize(m_NumberOfBlocks);
+      for(Accumulator<T>& partial : m_YPartials)
+      {
+        partial.setup(k_SlabSlices * nx, m_Statistics, nullptr, nullptr, nullptr, nullptr, nullptr);
+      }
+    }
+    else
+    {
+      m_ZAccumulator.setup(nx * ny, m_Statistics, outputs.maximum, outputs.minimum, outputs.mean, outputs.standardDeviation, outputs.sum);
+    }
+  }
+
+  /**
+   * @brief run Sweeps the volume with @p threads threads. @p progress is called after each slab with the
+   * number of slices swept and returns false to cancel.
+   * @return false if canceled
+   */
+  bool run(int threads, const std::function<bool(size_t)>& progress)
+  {
+    const size_t nx = m_Dimensions[0];
+    const size_t ny = m_Dimensions[1];
+    const size_t nz = m_Dimensions[2];
+    for(size_t z0 = 0; z0 < nz; z0 += k_SlabSlices)
+    {
+      const size_t z1 = std::min(z0 + k_SlabSlices, nz);
+      ITKParallelFor::Run(threads, m_NumberOfBlocks, [&](size_t block) { sweepBlock(block, z0, z1); });
+      if(m_Project[1])
+      {
+        // Merges the partial projections of the blocks, in order, into those of the slab
+        ITKParallelFor::Run(threads, z1 - z0, [&](size_t dz) {
+          const size_t offset = (z0 + dz) * nx;
+          for(size_t x = 0; x < nx; x++)
+          {
+            double count = 0.0;
+            for(size_t block = 0; block < m_NumberOfBlocks; block++)
+            {
+              const double rows = static_cast<double>(std::min(k_BlockRows, ny - block * k_BlockRows));
+              m_YAccumulator.merge(offset + x, count, m_YPartials[block], dz * nx + x, rows);
+              count += rows;
+            }
+          }
+          m_YAccumulator.finalize(offset, offset + nx, static_cast<double>(ny));
+        });
+      }
+      if(!progress(z1))
+      {
+        return false;
+      }
+    }
+    if(m_Project[2])
+    {
+      m_ZAccumulator.finalize(0, nx * ny, static_cast<double>(nz));
+    }
+    return true;
+  }
+
+private:
+  const T* m_Data;
+  Statistics m_Statistics;
+  size_t m_Dimensions[3];
+  bool m_Project[3];
+  size_t m_NumberOfBlocks;
+  Outputs m_XOutputs;
+  Accumulator<T> m_YAccumulator;
+  std::vector<Accumulator<T>> m_YPartials;
+  Accumulator<T> m_ZAccumulator;
+
+  /**
+   * @brief sweepBlock Processes the rows of @p block in the slices [@p z0, @p z1)
+   */
+  void sweepBlock(size_t block, size_t z0, size_t z1)
+  {
+    const size_t nx = m_Dimensions[0];
+    const size_t ny = m_Dimensions[1];
+    const size_t y0 = block * k_BlockRows;
+    const size_t y1 = std::min(y0 + k_BlockRows, ny);
+    if(m_Project[1])
+    {
+      m_YPartials[block].reset(0, (z1 - z0) * nx);
+    }
+    // Row by row, the slices of the slab in order, so that the Z accumulators of the row stay in the cache
+    for(size_t y = y0; y < y1; y++)
+    {
+      for(size_t z = z0; z < z1; z++)
+      {
+        const T* row = m_Data + (z * ny + y) * nx;
+        if(m_Project[0])
+        {
+          projectRow(row, y + ny * z);
+        }
+        if(m_Project[1])
+        {
+          m_YPartials[block].add((z - z0) * nx, row, nx, 1.0 / static_cast<double>(y - y0 + 1));
+        }
+        if(m_Project[2])
+        {
+          m_ZAccumulator.add(y * nx, row, nx, 1.0 / static_cast<double>(z + 1));
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief projectRow Writes the statistics of @p row, the projection along X of pixel @p index
+   */
+  void projectRow(const T* row, size_t index)
+  {
+    const size_t nx = m_Dimensions[0];
+    if(m_Statistics.maximum)
+    {
+      T maximum = std::numeric_limits<T>::lowest();
+      for(size_t x = 0; x < nx; x++)
+      {
+        maximum = row[x] > maximum ? row[x] : maximum;
+      }
+      m_XOutputs.maximum[index] = maximum;
+    }
+    if(m_Statistics.minimum)
+    {
+      T minimum = std::numeric_limits<T>::max();
+      for(size_t x = 0; x < nx; x++)
+      {
+        minimum = row[x] < minimum ? row[x] : minimum;
+      }
+      m_XOutputs.minimum[index] = minimum;
+    }
+    if(!m_Statistics.sum && !m_Statistics.moments())
+    {
+      return;
+    }
+    // The whole line is at hand: compensated sum, then the squared deviations from the mean
+    double sum = 0.0;
+    double compensation = 0.0;
+    for(size_t x = 0; x < nx; x++)
+    {
+      const double y = static_cast<double>(row[x]) - compensation;
+      const double t = sum + y;
+      compensation = (t - sum) - y;
+      sum = t;
+    }
+    sum -= compensation;
+    if(m_Statistics.sum)
+    {
+      m_XOutputs.sum[index] = sum;
+    }
+    const double mean = sum / static_cast<double>(nx);
+    if(m_Statistics.mean)
+    {
+      m_XOutputs.mean[index] = mean;
+    }
+    if(m_Statistics.standardDeviation)
+    {
+      double m2 = 0.0;
+      for(size_t x = 0; x < nx; x++)
+      {
+        const double delta = static_cast<double>(row[x]) - mean;
+        m2 += delta * delta;
+      }
+      m_XOutputs.standardDeviation[index] = nx > 1 ? std::sqrt(m2 / static_cast<double>(nx - 1)) : 0.0;
+    }
+  }
+};
+
+/**
+ * @brief ArrayPointer Returns the buffer of array @p name of @p attrMat, nullptr if there is none
+ */
+template <typename T> T* ArrayPointer(const AttributeMatrix::Pointer& attrMat, bool computed, const QString& name)
+{
+  if(!computed || nullptr == attrMat)
+  {
+    return nullptr;
+  }
+  typename DataArray<T>::Pointer array = std::dynamic_pointer_cast<DataArray<T>>(attrMat->getAttributeArray(name));
+  return (nullptr != array) ? array->getPointer(0) : nullptr;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKProjectionStatisticsImage::ITKProjectionStatisticsImage()
+: m_ProjectX(false)
+, m_ProjectY(false)
+, m_ProjectZ(true)
+, m_ComputeMaximum(true)
+, m_ComputeMinimum(true)
+, m_ComputeMean(true)
+, m_ComputeStandardDeviation(true)
+, m_ComputeSum(false)
+, m_DataContainerPrefix("Projection")
+, m_CellAttributeMatrixName(SIMPL::Defaults::CellAttributeMatrixName)
+{
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKProjectionStatisticsImage::~ITKProjectionStatisticsImage() = default;
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKProjectionStatisticsImage::setupFilterParameters()
+{
+  FilterParameterVector parameters;
+
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Project Along X", ProjectX, FilterParameter::Parameter, ITKProjectionStatisticsImage));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Project Along Y", ProjectY, FilterParameter::Parameter, ITKProjectionStatisticsImage));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Project Along Z", ProjectZ, FilterParameter::Parameter, ITKProjectionStatisticsImage));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Maximum", ComputeMaximum, FilterParameter::Parameter, ITKProjectionStatisticsImage));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Minimum", ComputeMinimum, FilterParameter::Parameter, ITKProjectionStatisticsImage));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Mean", ComputeMean, FilterParameter::Parameter, ITKProjectionStatisticsImage));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Standard Deviation", ComputeStandardDeviation, FilterParameter::Parameter, ITKProjectionStatisticsImage));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Sum", ComputeSum, FilterParameter::Parameter, ITKProjectionStatisticsImage));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKProjectionStatisticsImage));
+  parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
+  {
+    DataArraySelectionFilterParameter::RequirementType req =
+        DataArraySelectionFilterParameter::CreateRequirement(SIMPL::Defaults::AnyPrimitive, 1, AttributeMatrix::Type::Cell, IGeometry::Type::Image);
+    parameters.push_back(SIMPL_NEW_DA_SELECTION_FP("Attribute Array to project", SelectedCellArrayPath, FilterParameter::RequiredArray, ITKProjectionStatisticsImage, req));
+  }
+  parameters.push_back(SIMPL_NEW_STRING_FP("Data Container Prefix", DataContainerPrefix, FilterParameter::CreatedArray, ITKProjectionStatisticsImage));
+  parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::CreatedArray));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Cell Attribute Matrix", CellAttributeMatrixName, FilterParameter::CreatedArray, ITKProjectionStatisticsImage));
+
+  setFilterParameters(parameters);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKProjectionStatisticsImage::readFilterParameters(AbstractFilterParametersReader* reader, int index)
+{
+  reader->openFilterGroup(this, index);
+  setSelectedCellArrayPath(reader->readDataArrayPath("SelectedCellArrayPath", getSelectedCellArrayPath()));
+  setProjectX(reader->readValue("ProjectX", getProjectX()));
+  setProjectY(reader->readValue("ProjectY", getProjectY()));
+  setProjectZ(reader->readValue("ProjectZ", getProjectZ()));
+  setComputeMaximum(reader->readValue("ComputeMaximum", getComputeMaximum()));
+  setComputeMinimum(reader->readValue("ComputeMinimum", getComputeMinimum()));
+  setComputeMean(reader->readValue("ComputeMean", getComputeMean()));
+  setComputeStandardDeviation(reader->readValue("ComputeStandardDeviation", getComputeStandardDeviation()));
+  setComputeSum(reader->readValue("ComputeSum", getComputeSum()));
+  setDataContainerPrefix(reader->readString("DataContainerPrefix", getDataContainerPrefix()));
+  setCellAttributeMatrixName(reader->readString("CellAttributeMatrixName", getCellAttributeMatrixName()));
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
+  reader->closeFilterGroup();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+QString ITKProjectionStatisticsImage::getProjectionContainerName(int axis) const
+{
+  return getDataContainerPrefix() + QString(QChar('X' + axis));
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKProjectionStatisticsImage::dataCheck()
+{
+  using ValueType = typename itk::NumericTraits<InputPixelType>::ValueType;
+  setErrorCondition(0);
+  setWarningCondition(0);
+
+  // Check consistency of parameters
+  if(!m_ProjectX && !m_ProjectY && !m_ProjectZ)
+  {
+    setErrorCondition(-55590);
+    notifyErrorMessage(getHumanLabel(), "At least one projection axis must be selected", getErrorCondition());
+    return;
+  }
+  if(!m_ComputeMaximum && !m_ComputeMinimum && !m_ComputeMean && !m_ComputeStandardDeviation && !m_ComputeSum)
+  {
+    setErrorCondition(-55591);
+    notifyErrorMessage(getHumanLabel(), "At least one statistic must be selected", getErrorCondition());
+    return;
+  }
+
+  imageCheck<InputPixelType, Dimension>(getSelectedCellArrayPath());
+  if(getErrorCondition() < 0)
+  {
+    return;
+  }
+
+  ImageGeom::Pointer imageGeom = getDataContainerArray()->getDataContainer(getSelectedCellArrayPath().getDataContainerName())->getGeometryAs<ImageGeom>();
+  size_t dims[3] = {0, 0, 0};
+  std::tie(dims[0], dims[1], dims[2]) = imageGeom->getDimensions();
+  float resolution[3] = {1.0f, 1.0f, 1.0f};
+  std::tie(resolution[0], resolution[1], resolution[2]) = imageGeom->getResolution();
+  float origin[3] = {0.0f, 0.0f, 0.0f};
+  std::tie(origin[0], origin[1], origin[2]) = imageGeom->getOrigin();
+
+  const bool project[3] = {m_ProjectX, m_ProjectY, m_ProjectZ};
+  for(int axis = 0; axis < 3; axis++)
+  {
+    if(!project[axis])
+    {
+      continue;
+    }
+    const QString containerName = getProjectionContainerName(axis);
+    DataContainer::Pointer dc = getDataContainerArray()->createNonPrereqDataContainer<AbstractFilter>(this, containerName);
+    if(getErrorCondition() < 0)
+    {
+      return;
+    }
+    // The projection is one pixel thick along its axis, at the origin of the input image
+    QVector<size_t> tDims = {dims[0], dims[1], dims[2]};
+    tDims[axis] = 1;
+    ImageGeom::Pointer projectionGeom = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    projectionGeom->setDimensions(tDims[0], tDims[1], tDims[2]);
+    projectionGeom->setResolution(resolution[0], resolution[1], resolution[2]);
+    projectionGeom->setOrigin(origin[0], origin[1], origin[2]);
+    dc->setGeometry(projectionGeom);
+
+    DataArrayPath dap(containerName, getCellAttributeMatrixName(), QString(""));
+    AttributeMatrix::Pointer am = dc->createNonPrereqAttributeMatrix(this, dap, tDims, AttributeMatrix::Type::Cell);
+    if(getErrorCondition() < 0 || nullptr == am)
+    {
+      return;
+    }
+    QVector<size_t> cDims = {1};
+    if(m_ComputeMaximum)
+    {
+      am->createNonPrereqArray<DataArray<ValueType>>(this, k_MaximumName, 0, cDims);
+    }
+    if(m_ComputeMinimum)
+    {
+      am->createNonPrereqArray<DataArray<ValueType>>(this, k_MinimumName, 0, cDims);
+    }
+    if(m_ComputeMean)
+    {
+      am->createNonPrereqArray<DoubleArrayType>(this, k_MeanName, 0.0, cDims);
+    }
+    if(m_ComputeStandardDeviation)
+    {
+      am->createNonPrereqArray<DoubleArrayType>(this, k_StandardDeviationName, 0.0, cDims);
+    }
+    if(m_ComputeSum)
+    {
+      am->createNonPrereqArray<DoubleArrayType>(this, k_SumName, 0.0, cDims);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKProjectionStatisticsImage::dataCheckInternal()
+{
+  IDataArray::Pointer inputArray = getDataContainerArray()->getPrereqIDataArrayFromPath<IDataArray, AbstractFilter>(this, getSelectedCellArrayPath());
+  if(getErrorCondition() < 0)
+  {
+    return;
+  }
+  if(inputArray->getNumberOfComponents() != 1)
+  {
+    setErrorCondition(-55592);
+    notifyErrorMessage(getHumanLabel(), "The projected array must have a single component", getErrorCondition());
+    return;
+  }
+  Dream3DArraySwitchMacro(this->dataCheck, getSelectedCellArrayPath(), -4);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKProjectionStatisticsImage::filter()
+{
+  using ValueType = typename itk::NumericTraits<InputPixelType>::ValueType;
+  DataContainer::Pointer dc = getDataContainerArray()->getDataContainer(getSelectedCellArrayPath().getDataContainerName());
+  AttributeMatrix::Pointer attrMat = dc->getAttributeMatrix(getSelectedCellArrayPath().getAttributeMatrixName());
+  const ValueType* data = ArrayPointer<ValueType>(attrMat, true, getSelectedCellArrayPath().getDataArrayName());
+  ImageGeom::Pointer imageGeom = dc->getGeometryAs<ImageGeom>();
+  size_t dims[3] = {0, 0, 0};
+  std::tie(dims[0], dims[1], dims[2]) = imageGeom->getDimensions();
+  if(nullptr == data || dims[0] * dims[1] * dims[2] == 0)
+  {
+    return;
+  }
+
+  const Statistics statistics = {m_ComputeMaximum, m_ComputeMinimum, m_ComputeMean, m_ComputeStandardDeviation, m_ComputeSum};
+  ProjectionSweep<ValueType> sweep(data, dims[0], dims[1], dims[2], statistics);
+  const bool project[3] = {m_ProjectX, m_ProjectY, m_ProjectZ};
+  for(int axis = 0; axis < 3; axis++)
+  {
+    if(!project[axis])
+    {
+      continue;
+    }
+    AttributeMatrix::Pointer am = getDataContainerArray()->getDataContainer(getProjectionContainerName(axis))->getAttributeMatrix(getCellAttributeMatrixName());
+    typename ProjectionSweep<ValueType>::Outputs outputs;
+    outputs.maximum = ArrayPointer<ValueType>(am, m_ComputeMaximum, k_MaximumName);
+    outputs.minimum = ArrayPointer<ValueType>(am, m_ComputeMinimum, k_MinimumName);
+    outputs.mean = ArrayPointer<double>(am, m_ComputeMean, k_MeanName);
+    outputs.standardDeviation = ArrayPointer<double>(am, m_ComputeStandardDeviation, k_StandardDeviationName);
+    outputs.sum = ArrayPointer<double>(am, m_ComputeSum, k_SumName);
+    sweep.setOutputs(axis, outputs);
+  }
+
+  bool completed = false;
+  {
+    // The arrays are all allocated, other filters may use the data structure during the sweep
+    ITKThreadingPolicy::AffinityScope affinity;
+    ITKDataStructureLock::Release release;
+    const int threads = ITKThreadingPolicy::Instance().getNumberOfThreads(getNumberOfThreads());
+    completed = sweep.run(threads, [this, &dims](size_t slices) {
+      notifyStatusMessage(getHumanLabel(), QString("Projected %1 of %2 slices").arg(slices).arg(dims[2]));
+      return !getCancel();
+    });
+  }
+  if(completed)
+  {
+    notifyStatusMessage(getHumanLabel(), "Complete");
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKProjectionStatisticsImage::filterInternal()
+{
+  Dream3DArraySwitchMacro(this->filter, getSelectedCellArrayPath(), -4);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKProjectionStatisticsImage::canRunConcurrently() const
+{
+  // The Data Containers of the projections are not known to ITKFilterScheduler
+  return false;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString ITKProjectionStatisticsImage::getCompiledLibraryName() const
+{
+  return ITKImageProcessingConstants::ITKImageProcessingBaseName;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString ITKProjectionStatisticsImage::getBrandingString() const
+{
+  return "ITKImageProcessing";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString ITKProjectionStatisticsImage::getFilterVersion() const
+{
+  QString version;
+  QTextStream vStream(&version);
+  vStream << ITKImageProcessing::Version::Major() << "." << ITKImageProcessing::Version::Minor() << "." << ITKImageProcessing::Version::Patch();
+  return version;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString ITKProjectionStatisticsImage::getGroupName() const
+{
+  return "ITK Image Processing";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+AbstractFilter::Pointer ITKProjectionStatisticsImage::newFilterInstance(bool copyFilterParameters) const
+{
+  ITKProjectionStatisticsImage::Pointer filter = ITKProjectionStatisticsImage::New();
+  if(true == copyFilterParameters)
+  {
+    copyFilterParameterInstanceVariables(filter.get());
+  }
+  return filter;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString ITKProjectionStatisticsImage::getHumanLabel() const
+{
+  return "ITK::Projection Statistics Image Filter";
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QUuid ITKProjectionStatisticsImage::getUuid()
+{
+  return QUuid("{5c1e4b0d-8f3a-4c57-9e0b-2d6f7a1c3b94}");
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+const QString ITKProjectionStatisticsImage::getSubGroupName() const
+{
+  return "ITK ImageStatistics";
+}
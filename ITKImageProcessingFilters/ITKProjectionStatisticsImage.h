@@ -0,0 +1,173 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#ifdef __clang__
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Winconsistent-missing-override"
+#endif
+
+#include "ITKImageBase.h"
+
+#include "SIMPLib/Common/SIMPLibSetGetMacros.h"
+#include "SIMPLib/SIMPLib.h"
+
+#include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+
+/**
+ * @brief The ITKProjectionStatisticsImage class. See [Filter documentation](@ref ITKProjectionStatisticsImage) for details.
+ */
+class ITKImageProcessing_EXPORT ITKProjectionStatisticsImage : public ITKImageBase
+{
+  Q_OBJECT
+  PYB11_CREATE_BINDINGS(ITKProjectionStatisticsImage SUPERCLASS ITKImageBase)
+  PYB11_PROPERTY(DataArrayPath SelectedCellArrayPath READ getSelectedCellArrayPath WRITE setSelectedCellArrayPath)
+  PYB11_PROPERTY(bool ProjectX READ getProjectX WRITE setProjectX)
+  PYB11_PROPERTY(bool ProjectY READ getProjectY WRITE setProjectY)
+  PYB11_PROPERTY(bool ProjectZ READ getProjectZ WRITE setProjectZ)
+  PYB11_PROPERTY(bool ComputeMaximum READ getComputeMaximum WRITE setComputeMaximum)
+  PYB11_PROPERTY(bool ComputeMinimum READ getComputeMinimum WRITE setComputeMinimum)
+  PYB11_PROPERTY(bool ComputeMean READ getComputeMean WRITE setComputeMean)
+  PYB11_PROPERTY(bool ComputeStandardDeviation READ getComputeStandardDeviation WRITE setComputeStandardDeviation)
+  PYB11_PROPERTY(bool ComputeSum READ getComputeSum WRITE setComputeSum)
+  PYB11_PROPERTY(QString DataContainerPrefix READ getDataContainerPrefix WRITE setDataContainerPrefix)
+  PYB11_PROPERTY(QString CellAttributeMatrixName READ getCellAttributeMatrixName WRITE setCellAttributeMatrixName)
+
+public:
+  SIMPL_SHARED_POINTERS(ITKProjectionStatisticsImage)
+  SIMPL_FILTER_NEW_MACRO(ITKProjectionStatisticsImage)
+  SIMPL_TYPE_MACRO_SUPER_OVERRIDE(ITKProjectionStatisticsImage, AbstractFilter)
+
+  ~ITKProjectionStatisticsImage() override;
+
+  SIMPL_FILTER_PARAMETER(DataArrayPath, SelectedCellArrayPath)
+  Q_PROPERTY(DataArrayPath SelectedCellArrayPath READ getSelectedCellArrayPath WRITE setSelectedCellArrayPath)
+
+  SIMPL_FILTER_PARAMETER(bool, ProjectX)
+  Q_PROPERTY(bool ProjectX READ getProjectX WRITE setProjectX)
+
+  SIMPL_FILTER_PARAMETER(bool, ProjectY)
+  Q_PROPERTY(bool ProjectY READ getProjectY WRITE setProjectY)
+
+  SIMPL_FILTER_PARAMETER(bool, ProjectZ)
+  Q_PROPERTY(bool ProjectZ READ getProjectZ WRITE setProjectZ)
+
+  SIMPL_FILTER_PARAMETER(bool, ComputeMaximum)
+  Q_PROPERTY(bool ComputeMaximum READ getComputeMaximum WRITE setComputeMaximum)
+
+  SIMPL_FILTER_PARAMETER(bool, ComputeMinimum)
+  Q_PROPERTY(bool ComputeMinimum READ getComputeMinimum WRITE setComputeMinimum)
+
+  SIMPL_FILTER_PARAMETER(bool, ComputeMean)
+  Q_PROPERTY(bool ComputeMean READ getComputeMean WRITE setComputeMean)
+
+  SIMPL_FILTER_PARAMETER(bool, ComputeStandardDeviation)
+  Q_PROPERTY(bool ComputeStandardDeviation READ getComputeStandardDeviation WRITE setComputeStandardDeviation)
+
+  SIMPL_FILTER_PARAMETER(bool, ComputeSum)
+  Q_PROPERTY(bool ComputeSum READ getComputeSum WRITE setComputeSum)
+
+  SIMPL_FILTER_PARAMETER(QString, DataContainerPrefix)
+  Q_PROPERTY(QString DataContainerPrefix READ getDataContainerPrefix WRITE setDataContainerPrefix)
+
+  SIMPL_FILTER_PARAMETER(QString, CellAttributeMatrixName)
+  Q_PROPERTY(QString CellAttributeMatrixName READ getCellAttributeMatrixName WRITE setCellAttributeMatrixName)
+
+  /**
+   * @brief getProjectionContainerName Returns the name of the Data Container holding the projections along
+   * @p axis (0: X, 1: Y, 2: Z)
+   */
+  QString getProjectionContainerName(int axis) const;
+
+  /**
+   * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
+   */
+  const QString getCompiledLibraryName() const override;
+
+  /**
+   * @brief getBrandingString Reimplemented from @see AbstractFilter class
+   */
+  const QString getBrandingString() const override;
+
+  /**
+   * @brief getFilterVersion Reimplemented from @see AbstractFilter class
+   */
+  const QString getFilterVersion() const override;
+
+  /**
+   * @brief getGroupName Reimplemented from @see AbstractFilter class
+   */
+  const QString getGroupName() const override;
+
+  /**
+   * @brief newFilterInstance Reimplemented from @see AbstractFilter class
+   */
+  AbstractFilter::Pointer newFilterInstance(bool copyFilterParameters) const override;
+
+  /**
+   * @brief getHumanLabel Reimplemented from @see AbstractFilter class
+   */
+  const QString getHumanLabel() const override;
+
+  /**
+   * @brief getSubGroupName Reimplemented from @see AbstractFilter class
+   */
+  const QString getSubGroupName() const override;
+
+  /**
+   * @brief getUuid Return the unique identifier for this filter.
+   * @return A QUuid object.
+   */
+  const QUuid getUuid() override;
+
+  /**
+   * @brief setupFilterParameters Reimplemented from @see AbstractFilter class
+   */
+  void setupFilterParameters() override;
+
+  /**
+   * @brief readFilterParameters Reimplemented from @see AbstractFilter class
+   */
+  void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
+
+  /**
+   * @brief canRunConcurrently Reimplemented from @see ITKImageBase class. The filter creates its own
+   * Data Containers.
+   */
+  bool canRunConcurrently() const override;
+
+protected:
+  ITKProjectionStatisticsImage();
+
+  /**
+   * @brief dataCheckInternal overloads dataCheckInternal in ITKImageBase and calls templated dataCheck
+   */
+  void virtual dataCheckInternal() override;
+
+  /**
+   * @brief dataCheck Checks the parameters and creates a Data Container for each projection axis
+   */
+  template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void dataCheck();
+
+  /**
+   * @brief filterInternal overloads filterInternal in ITKImageBase and calls templated filter
+   */
+  void virtual filterInternal() override;
+
+  /**
+   * @brief Computes all the projections in a single sweep over the input array
+   */
+  template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void filter();
+
+public:
+  ITKProjectionStatisticsImage(const ITKProjectionStatisticsImage&) = delete;            // Copy Constructor Not Implemented
+  ITKProjectionStatisticsImage(ITKProjectionStatisticsImage&&) = delete;                 // Move Constructor Not Implemented
+  ITKProjectionStatisticsImage& operator=(const ITKProjectionStatisticsImage&) = delete; // Copy Assignment Not Implemented
+  ITKProjectionStatisticsImage& operator=(ITKProjectionStatisticsImage&&) = delete;      // Move Assignment Not Implemented
+};
+
+#ifdef __clang__
+#pragma clang diagnostic pop
+#endif
@@ -10,6 +10,7 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -17,6 +18,8 @@
 #include "SIMPLib/Geometry/ImageGeom.h"
 
 #include "SIMPLib/ITK/itkDream3DImage.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkCounterBasedNoiseImageFilter.h"
 #define DREAM3D_USE_RGB_RGBA 1
 #include "SIMPLib/ITK/Dream3DTemplateAliasMacro.h"
 
@@ -27,6 +30,7 @@ ITKSaltAndPepperNoiseImage::ITKSaltAndPepperNoiseImage()
 {
   m_Probability = StaticCastScalar<double, double, double>(0.01);
   m_Seed = StaticCastScalar<double, double, double>((uint32_t) itk::simple::sitkWallClock);
+  m_CounterBasedGenerator = false;
 
 }
 
@@ -44,11 +48,18 @@ void ITKSaltAndPepperNoiseImage::setupFilterParameters()
 
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("Probability", Probability, FilterParameter::Parameter, ITKSaltAndPepperNoiseImage));
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("Seed", Seed, FilterParameter::Parameter, ITKSaltAndPepperNoiseImage));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Counter-Based Generator", CounterBasedGenerator, FilterParameter::Parameter, ITKSaltAndPepperNoiseImage));
+
+  QStringList streamingProps;
+  streamingProps << "SlabSize";
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Streamed Execution", StreamedExecution, FilterParameter::Parameter, ITKSaltAndPepperNoiseImage, streamingProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Slab Size (Slices)", SlabSize, FilterParameter::Parameter, ITKSaltAndPepperNoiseImage));
 
 
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKSaltAndPepperNoiseImage, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKSaltAndPepperNoiseImage));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -72,7 +83,11 @@ void ITKSaltAndPepperNoiseImage::readFilterParameters(AbstractFilterParametersRe
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
   setProbability(reader->readValue("Probability", getProbability()));
   setSeed(reader->readValue("Seed", getSeed()));
+  setCounterBasedGenerator(reader->readValue("CounterBasedGenerator", getCounterBasedGenerator()));
+  setStreamedExecution(reader->readValue("StreamedExecution", getStreamedExecution()));
+  setSlabSize(reader->readValue("SlabSize", getSlabSize()));
 
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
   reader->closeFilterGroup();
 }
 
@@ -106,6 +121,18 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
 {
   typedef itk::Dream3DImage<InputPixelType, Dimension> InputImageType;
   typedef itk::Dream3DImage<OutputPixelType, Dimension> OutputImageType;
+  if(m_CounterBasedGenerator)
+  {
+    typedef itk::Functor::SaltAndPepperNoise<typename itk::NumericTraits<OutputPixelType>::ValueType> NoiseType;
+    typedef itk::CounterBasedNoiseImageFilter<InputImageType, OutputImageType, NoiseType> FilterType;
+    typename FilterType::Pointer filter = FilterType::New();
+    NoiseType noise;
+    noise.SetProbability(static_cast<double>(m_Probability));
+    filter->SetNoise(noise);
+    filter->SetSeed(static_cast<uint32_t>(m_Seed));
+    this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
+    return;
+  }
   // define filter
   typedef itk::SaltAndPepperNoiseImageFilter<InputImageType, OutputImageType> FilterType;
   typename FilterType::Pointer filter = FilterType::New();
@@ -124,6 +151,14 @@ void ITKSaltAndPepperNoiseImage::filterInternal()
   Dream3DArraySwitchMacro(this->filter, getSelectedCellArrayPath(), -4);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKSaltAndPepperNoiseImage::isStreamable() const
+{
+  return m_CounterBasedGenerator;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
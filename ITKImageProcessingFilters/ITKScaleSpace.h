@@ -0,0 +1,302 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+
+#include <QtCore/QString>
+#include <QtCore/QStringList>
+
+#include <itkImage.h>
+#include <itkNumericTraits.h>
+#include <itkRecursiveGaussianImageFilter.h>
+
+#include "SIMPLib/DataContainers/DataArrayPath.h"
+#include "SIMPLib/DataContainers/DataContainerArray.h"
+#include "SIMPLib/Filtering/AbstractFilter.h"
+#include "SIMPLib/ITK/itkDream3DFilterInterruption.h"
+#include "SIMPLib/ITK/itkDream3DImage.h"
+#include "SIMPLib/ITK/itkInPlaceDream3DDataToImageFilter.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKScaleSpaceCache.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKThreadingPolicy.h"
+
+/**
+ * @brief The ITKScaleSpace class computes the images of the Gaussian scale space of a scalar array through
+ * the ITKScaleSpaceCache. An image is described by a Scale: the order of the Gaussian derivative applied
+ * along each axis (0 for a smoothing) and its sigma, in physical units. It is computed one axis at a time
+ * with itk::RecursiveGaussianImageFilter, as the ITK recursive Gaussian filters do, so that the derivatives
+ * are in pixel units: the callers divide them by the spacing.
+ *
+ * Every image is computed from the cached image of the same scale without its last axis, the smoothings
+ * being applied before the derivatives, each in increasing axis order. The image smoothed along every axis
+ * but one is then the common start of the derivatives along that axis (gradient, Laplacian and diagonal
+ * of the Hessian) and of the smoothed image, which are a single pass away once it is cached.
+ *
+ * The images returned share the buffer of the cached ones and must not be modified. The methods throw
+ * itk::ExceptionObject when ITK fails or the filter is canceled.
+ */
+template <typename InputPixelType, unsigned int Dimension> class ITKScaleSpace
+{
+public:
+  using InputImageType = itk::Dream3DImage<InputPixelType, Dimension>;
+  // The images are computed in the real type of the input pixels, as the ITK recursive Gaussian filters
+  using RealPixelType = typename itk::NumericTraits<InputPixelType>::RealType;
+  using RealImageType = itk::Image<RealPixelType, Dimension>;
+
+  /**
+   * @brief The Scale struct describes an image of the scale space. An order of -1 leaves an axis untouched.
+   */
+  struct Scale
+  {
+    std::array<int, Dimension> orders;
+    std::array<double, Dimension> sigmas;
+    bool normalizeAcrossScale = false;
+  };
+
+  /**
+   * @brief ITKScaleSpace Wraps the array at @p path, read by @p filter, whose data structure must be locked.
+   * The ITK filters use @p numberOfThreads threads (see ITKThreadingPolicy) and are interrupted when
+   * @p filter is canceled.
+   */
+  ITKScaleSpace(AbstractFilter* filter, const DataArrayPath& path, int numberOfThreads)
+  : m_Filter(filter)
+  , m_NumberOfThreads(numberOfThreads)
+  {
+    using BridgeType = itk::InPlaceDream3DDataToImageFilter<InputPixelType, Dimension>;
+    DataContainer::Pointer dc = filter->getDataContainerArray()->getDataContainer(path.getDataContainerName());
+    typename BridgeType::Pointer toITK = BridgeType::New();
+    toITK->SetInput(dc);
+    toITK->SetInPlace(true);
+    toITK->SetAttributeMatrixArrayName(path.getAttributeMatrixName().toStdString());
+    toITK->SetDataArrayName(path.getDataArrayName().toStdString());
+    toITK->Update();
+    m_Input = toITK->GetOutput();
+    m_Input->DisconnectPipeline();
+
+    // The input is described by its path, type, size and spacing, and stamped with a hash of its values
+    IDataArray::Pointer array = filter->getDataContainerArray()->getAttributeMatrix(path)->getAttributeArray(path.getDataArrayName());
+    QStringList description;
+    description << path.serialize() << array->getTypeAsString();
+    for(unsigned int d = 0; d < Dimension; d++)
+    {
+      description << QString::number(m_Input->GetLargestPossibleRegion().GetSize()[d]) << QString::number(m_Input->GetSpacing()[d], 'g', 17);
+    }
+    const size_t bytes = m_Input->GetLargestPossibleRegion().GetNumberOfPixels() * sizeof(InputPixelType);
+    description << QString::number(ITKScaleSpaceCache::Stamp(m_Input->GetBufferPointer(), bytes), 16);
+    m_InputKey = description.join("|");
+  }
+
+  /**
+   * @brief Smoothed Returns the scale of the input smoothed along every axis
+   */
+  static Scale Smoothed(const std::array<double, Dimension>& sigmas)
+  {
+    Scale scale;
+    scale.orders.fill(0);
+    scale.sigmas = sigmas;
+    return scale;
+  }
+
+  /**
+   * @brief Derivative Returns the scale of the derivative of orders @p orders along the axes, the input being
+   * smoothed by a Gaussian of deviation @p sigma
+   */
+  static Scale Derivative(double sigma, const std::array<int, Dimension>& orders, bool normalizeAcrossScale)
+  {
+    Scale scale;
+    scale.orders = orders;
+    scale.sigmas.fill(sigma);
+    scale.normalizeAcrossScale = normalizeAcrossScale;
+    return scale;
+  }
+
+  /**
+   * @brief getInput Returns the input image
+   */
+  InputImageType* getInput() const
+  {
+    return m_Input.GetPointer();
+  }
+
+  /**
+   * @brief createImage Returns a new image with the size, spacing and origin of the input
+   */
+  template <typename PixelType> typename itk::Dream3DImage<PixelType, Dimension>::Pointer createImage() const
+  {
+    using ImageType = itk::Dream3DImage<PixelType, Dimension>;
+    typename ImageType::Pointer image = ImageType::New();
+    image->CopyInformation(m_Input);
+    image->SetRegions(m_Input->GetLargestPossibleRegion());
+    image->Allocate();
+    return image;
+  }
+
+  /**
+   * @brief createImage Returns a new image holding the pixels of @p image cast to PixelType
+   */
+  template <typename PixelType, typename ImageType> typename itk::Dream3DImage<PixelType, Dimension>::Pointer createImage(const ImageType* image) const
+  {
+    typename itk::Dream3DImage<PixelType, Dimension>::Pointer copy = createImage<PixelType>();
+    const typename ImageType::PixelType* source = image->GetBufferPointer();
+    const size_t numberOfPixels = image->GetLargestPossibleRegion().GetNumberOfPixels();
+    std::transform(source, source + numberOfPixels, copy->GetBufferPointer(), [](typename ImageType::PixelType value) { return static_cast<PixelType>(value); });
+    return copy;
+  }
+
+  /**
+   * @brief find Returns the image computed from the input by the operations described by @p description,
+   * nullptr if it is not cached
+   */
+  template <typename ImageType> typename ImageType::Pointer find(const QString& description) const
+  {
+    itk::DataObject::Pointer cached = ITKScaleSpaceCache::Instance().find(m_InputKey + "|" + description);
+    ImageType* image = dynamic_cast<ImageType*>(cached.GetPointer());
+    if(nullptr == image)
+    {
+      return nullptr;
+    }
+    return View(image);
+  }
+
+  /**
+   * @brief insert Caches @p image, computed from the input by the operations described by @p description.
+   * The image must not be modified afterwards.
+   */
+  template <typename ImageType> void insert(const QString& description, ImageType* image) const
+  {
+    const qint64 bytes = static_cast<qint64>(image->GetLargestPossibleRegion().GetNumberOfPixels() * sizeof(typename ImageType::PixelType));
+    ITKScaleSpaceCache::Instance().insert(m_InputKey + "|" + description, image, bytes);
+  }
+
+  /**
+   * @brief update Updates @p filter with the threads of the filter using this scale space, stopping when
+   * that filter is canceled
+   */
+  template <typename FilterType> void update(FilterType* filter) const
+  {
+    ITKThreadingPolicy::Instance().apply(filter, m_NumberOfThreads);
+    itk::Dream3DFilterInterruption::Pointer interruption = itk::Dream3DFilterInterruption::New();
+    interruption->SetFilter(m_Filter);
+    filter->AddObserver(itk::ProgressEvent(), interruption);
+    filter->Update();
+  }
+
+  /**
+   * @brief get Returns the image of @p scale, from the cache if it is there
+   */
+  typename RealImageType::Pointer get(const Scale& scale)
+  {
+    const QString description = Describe(scale);
+    typename RealImageType::Pointer cached = find<RealImageType>(description);
+    if(nullptr != cached)
+    {
+      return cached;
+    }
+
+    // Last axis: the last derivative, or the last smoothing if there is no derivative
+    unsigned int last = 0;
+    bool derivative = false;
+    for(unsigned int d = 0; d < Dimension; d++)
+    {
+      if(scale.orders[d] > 0 || (scale.orders[d] == 0 && !derivative))
+      {
+        last = d;
+        derivative = derivative || scale.orders[d] > 0;
+      }
+    }
+    Scale previous = scale;
+    previous.orders[last] = -1;
+    bool empty = true;
+    bool previousDerivative = false;
+    for(unsigned int d = 0; d < Dimension; d++)
+    {
+      empty = empty && previous.orders[d] < 0;
+      previousDerivative = previousDerivative || previous.orders[d] > 0;
+    }
+    // The normalization only applies to the derivatives
+    previous.normalizeAcrossScale = previous.normalizeAcrossScale && previousDerivative;
+
+    typename RealImageType::Pointer image;
+    if(empty)
+    {
+      image = apply(m_Input.GetPointer(), last, scale);
+    }
+    else
+    {
+      typename RealImageType::Pointer input = get(previous);
+      image = apply(input.GetPointer(), last, scale);
+    }
+    insert(description, image.GetPointer());
+    return View(image.GetPointer());
+  }
+
+  /**
+   * @brief View Returns an image sharing the pixels of @p image, so that the cached images are never
+   * connected to the pipelines of the filters using them
+   */
+  template <typename ImageType> static typename ImageType::Pointer View(ImageType* image)
+  {
+    typename ImageType::Pointer view = ImageType::New();
+    view->CopyInformation(image);
+    view->SetRegions(image->GetLargestPossibleRegion());
+    view->SetPixelContainer(image->GetPixelContainer());
+    return view;
+  }
+
+protected:
+  /**
+   * @brief Describe Returns the part of the cache key describing @p scale
+   */
+  static QString Describe(const Scale& scale)
+  {
+    QStringList axes;
+    bool derivative = false;
+    for(unsigned int d = 0; d < Dimension; d++)
+    {
+      axes << ((scale.orders[d] < 0) ? QString("-") : QString("%1:%2").arg(scale.orders[d]).arg(scale.sigmas[d], 0, 'g', 17));
+      derivative = derivative || scale.orders[d] > 0;
+    }
+    return QString("RecursiveGaussian(%1)%2").arg(axes.join(",")).arg((derivative && scale.normalizeAcrossScale) ? "N" : "");
+  }
+
+  /**
+   * @brief apply Applies the operation of @p scale along @p axis to @p input
+   */
+  template <typename ImageType> typename RealImageType::Pointer apply(ImageType* input, unsigned int axis, const Scale& scale)
+  {
+    using FilterType = itk::RecursiveGaussianImageFilter<ImageType, RealImageType>;
+    typename FilterType::Pointer filter = FilterType::New();
+    filter->SetInput(input);
+    filter->SetDirection(axis);
+    filter->SetSigma(scale.sigmas[axis]);
+    switch(scale.orders[axis])
+    {
+    case 1:
+      filter->SetOrder(FilterType::FirstOrder);
+      break;
+    case 2:
+      filter->SetOrder(FilterType::SecondOrder);
+      break;
+    default:
+      filter->SetOrder(FilterType::ZeroOrder);
+      break;
+    }
+    filter->SetNormalizeAcrossScale(scale.normalizeAcrossScale);
+    // The input may be a cached image
+    filter->InPlaceOff();
+    update(filter.GetPointer());
+    typename RealImageType::Pointer output = filter->GetOutput();
+    output->DisconnectPipeline();
+    return output;
+  }
+
+private:
+  AbstractFilter* m_Filter;
+  int m_NumberOfThreads;
+  typename InputImageType::Pointer m_Input;
+  QString m_InputKey;
+};
@@ -0,0 +1,216 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#include "ITKScaleSpaceCache.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <QtCore/QMutexLocker>
+
+namespace
+{
+// Opt-in: hashing the whole input on every run only pays off when the same arrays are filtered again
+const qint64 k_DefaultBudget = 0;
+
+const quint64 k_Prime1 = 0x9E3779B185EBCA87ULL;
+const quint64 k_Prime2 = 0xC2B2AE3D27D4EB4FULL;
+
+inline quint64 Rotate(quint64 value, int bits)
+{
+  return (value << bits) | (value >> (64 - bits));
+}
+
+inline quint64 Round(quint64 lane, quint64 word)
+{
+  return Rotate(lane + word * k_Prime2, 31) * k_Prime1;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKScaleSpaceCache::ITKScaleSpaceCache()
+: m_Budget(k_DefaultBudget)
+, m_MemoryUsage(0)
+, m_Hits(0)
+, m_Misses(0)
+{
+  bool ok = false;
+  const qint64 budget = qgetenv("ITKIMAGEPROCESSING_SCALE_SPACE_CACHE").toLongLong(&ok);
+  if(ok && budget >= 0)
+  {
+    m_Budget = budget * 1024 * 1024;
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKScaleSpaceCache& ITKScaleSpaceCache::Instance()
+{
+  static ITKScaleSpaceCache cache;
+  return cache;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+quint64 ITKScaleSpaceCache::Stamp(const void* data, size_t size)
+{
+  // Four independent lanes of 64 bit words, so that the hash runs at memory speed
+  const char* bytes = static_cast<const char*>(data);
+  quint64 lanes[4] = {k_Prime1 + k_Prime2, k_Prime2, 0, 0 - k_Prime1};
+  size_t offset = 0;
+  for(; offset + 32 <= size; offset += 32)
+  {
+    quint64 words[4];
+    std::memcpy(words, bytes + offset, sizeof(words));
+    for(int i = 0; i < 4; i++)
+    {
+      lanes[i] = Round(lanes[i], words[i]);
+    }
+  }
+  quint64 hash = Rotate(lanes[0], 1) + Rotate(lanes[1], 7) + Rotate(lanes[2], 12) + Rotate(lanes[3], 18) + static_cast<quint64>(size);
+  for(; offset < size; offset++)
+  {
+    hash = Rotate(hash ^ (static_cast<quint64>(static_cast<unsigned char>(bytes[offset])) * k_Prime1), 11) * k_Prime2;
+  }
+  hash ^= hash >> 33;
+  hash *= k_Prime2;
+  hash ^= hash >> 29;
+  return hash;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+itk::DataObject::Pointer ITKScaleSpaceCache::find(const QString& key)
+{
+  QMutexLocker locker(&m_Mutex);
+  QHash<QString, std::list<Entry>::iterator>::iterator iter = m_Index.find(key);
+  if(iter == m_Index.end())
+  {
+    m_Misses++;
+    return nullptr;
+  }
+  m_Hits++;
+  m_Entries.splice(m_Entries.begin(), m_Entries, iter.value());
+  return m_Entries.front().image;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKScaleSpaceCache::insert(const QString& key, itk::DataObject* image, qint64 bytes)
+{
+  QMutexLocker locker(&m_Mutex);
+  if(nullptr == image || bytes > m_Budget)
+  {
+    return;
+  }
+  // Concurrent filters may compute the same image: the last one replaces the others
+  QHash<QString, std::list<Entry>::iterator>::iterator iter = m_Index.find(key);
+  if(iter != m_Index.end())
+  {
+    m_MemoryUsage -= iter.value()->bytes;
+    m_Entries.erase(iter.value());
+    m_Index.erase(iter);
+  }
+  evict(m_Budget - bytes);
+  Entry entry;
+  entry.key = key;
+  entry.image = image;
+  entry.bytes = bytes;
+  m_Entries.push_front(entry);
+  m_Index.insert(key, m_Entries.begin());
+  m_MemoryUsage += bytes;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKScaleSpaceCache::evict(qint64 bytes)
+{
+  while(!m_Entries.empty() && m_MemoryUsage > bytes)
+  {
+    m_MemoryUsage -= m_Entries.back().bytes;
+    m_Index.remove(m_Entries.back().key);
+    m_Entries.pop_back();
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKScaleSpaceCache::setBudget(qint64 bytes)
+{
+  QMutexLocker locker(&m_Mutex);
+  m_Budget = std::max(bytes, qint64(0));
+  evict(m_Budget);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 ITKScaleSpaceCache::getBudget() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Budget;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKScaleSpaceCache::isEnabled() const
+{
+  return getBudget() > 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+qint64 ITKScaleSpaceCache::getMemoryUsage() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_MemoryUsage;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+quint64 ITKScaleSpaceCache::getHits() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Hits;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+quint64 ITKScaleSpaceCache::getMisses() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_Misses;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKScaleSpaceCache::clear()
+{
+  QMutexLocker locker(&m_Mutex);
+  m_Entries.clear();
+  m_Index.clear();
+  m_MemoryUsage = 0;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ITKScaleSpaceCache::size() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return static_cast<int>(m_Entries.size());
+}
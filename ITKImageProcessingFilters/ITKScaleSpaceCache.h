@@ -0,0 +1,123 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <list>
+
+#include <QtCore/QHash>
+#include <QtCore/QMutex>
+#include <QtCore/QString>
+
+#include <itkDataObject.h>
+
+#include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+
+/**
+ * @brief The ITKScaleSpaceCache class keeps the images computed by the Gaussian filters of this plugin
+ * (smoothed images, Gaussian derivatives), so that a filter asking again for a scale of the same input
+ * reuses it instead of filtering the input again.
+ *
+ * An entry is keyed on a description of its input array (path, pixel type, dimensions, spacing), a stamp
+ * of the values of that array and a description of the operations applied to it. SIMPL arrays carry no
+ * modification time: the stamp is a hash of the values (see Stamp()), so that an array modified by any
+ * filter no longer matches the entries computed from its former values.
+ *
+ * The images are kept up to a memory budget, the least recently used ones being dropped first. The budget
+ * is read, in MiB, from the ITKIMAGEPROCESSING_SCALE_SPACE_CACHE environment variable. The cache is opt-in:
+ * the budget defaults to 0, which disables it, since every use hashes the whole input array. The cached images are shared by the filters using them and
+ * must never be modified. The cache can be used from several threads at once.
+ */
+class ITKImageProcessing_EXPORT ITKScaleSpaceCache
+{
+public:
+  /**
+   * @brief Instance Returns the cache shared by every filter of the process
+   */
+  static ITKScaleSpaceCache& Instance();
+
+  /**
+   * @brief Stamp Returns a 64 bit hash of the @p size bytes at @p data
+   */
+  static quint64 Stamp(const void* data, size_t size);
+
+  /**
+   * @brief find Returns the image cached for @p key, nullptr if there is none
+   */
+  itk::DataObject::Pointer find(const QString& key);
+
+  /**
+   * @brief insert Caches @p image, of @p bytes bytes, for @p key. Least recently used images are dropped
+   * to keep the cache within its budget; an image larger than the budget is not cached.
+   */
+  void insert(const QString& key, itk::DataObject* image, qint64 bytes);
+
+  /**
+   * @brief setBudget Sets the largest number of bytes of the cached images, 0 disabling the cache
+   */
+  void setBudget(qint64 bytes);
+  qint64 getBudget() const;
+
+  /**
+   * @brief isEnabled Returns true if the budget is not 0
+   */
+  bool isEnabled() const;
+
+  /**
+   * @brief getMemoryUsage Returns the number of bytes of the cached images
+   */
+  qint64 getMemoryUsage() const;
+
+  /**
+   * @brief getHits Returns the number of calls to find() that returned an image
+   */
+  quint64 getHits() const;
+
+  /**
+   * @brief getMisses Returns the number of calls to find() that returned nullptr
+   */
+  quint64 getMisses() const;
+
+  /**
+   * @brief clear Removes every entry
+   */
+  void clear();
+
+  /**
+   * @brief size Returns the number of cached images
+   */
+  int size() const;
+
+protected:
+  ITKScaleSpaceCache();
+
+  /**
+   * @brief evict Drops the least recently used images until at most @p bytes bytes are cached. The mutex
+   * must be locked.
+   */
+  void evict(qint64 bytes);
+
+private:
+  struct Entry
+  {
+    QString key;
+    itk::DataObject::Pointer image;
+    qint64 bytes = 0;
+  };
+
+  mutable QMutex m_Mutex;
+  // Most recently used first
+  std::list<Entry> m_Entries;
+  QHash<QString, std::list<Entry>::iterator> m_Index;
+  qint64 m_Budget;
+  qint64 m_MemoryUsage;
+  quint64 m_Hits;
+  quint64 m_Misses;
+
+public:
+  ITKScaleSpaceCache(const ITKScaleSpaceCache&) = delete;            // Copy Constructor Not Implemented
+  ITKScaleSpaceCache(ITKScaleSpaceCache&&) = delete;                 // Move Constructor Not Implemented
+  ITKScaleSpaceCache& operator=(const ITKScaleSpaceCache&) = delete; // Copy Assignment Not Implemented
+  ITKScaleSpaceCache& operator=(ITKScaleSpaceCache&&) = delete;      // Move Assignment Not Implemented
+};
@@ -10,6 +10,7 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -19,6 +20,8 @@
 #include "SIMPLib/ITK/Dream3DTemplateAliasMacro.h"
 #include "SIMPLib/ITK/itkDream3DImage.h"
 
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkCounterBasedNoiseImageFilter.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -26,6 +29,7 @@ ITKShotNoiseImage::ITKShotNoiseImage()
 {
   m_Scale = StaticCastScalar<double, double, double>(1.0);
   m_Seed = StaticCastScalar<double, double, double>((uint32_t) itk::simple::sitkWallClock);
+  m_CounterBasedGenerator = false;
 
 }
 
@@ -43,11 +47,18 @@ void ITKShotNoiseImage::setupFilterParameters()
 
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("Scale", Scale, FilterParameter::Parameter, ITKShotNoiseImage));
   parameters.push_back(SIMPL_NEW_DOUBLE_FP("Seed", Seed, FilterParameter::Parameter, ITKShotNoiseImage));
+  parameters.push_back(SIMPL_NEW_BOOL_FP("Counter-Based Generator", CounterBasedGenerator, FilterParameter::Parameter, ITKShotNoiseImage));
+
+  QStringList streamingProps;
+  streamingProps << "SlabSize";
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Streamed Execution", StreamedExecution, FilterParameter::Parameter, ITKShotNoiseImage, streamingProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Slab Size (Slices)", SlabSize, FilterParameter::Parameter, ITKShotNoiseImage));
 
 
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKShotNoiseImage, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKShotNoiseImage));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -71,7 +82,11 @@ void ITKShotNoiseImage::readFilterParameters(AbstractFilterParametersReader* rea
   setSaveAsNewArray(reader->readValue("SaveAsNewArray", getSaveAsNewArray()));
   setScale(reader->readValue("Scale", getScale()));
   setSeed(reader->readValue("Seed", getSeed()));
+  setCounterBasedGenerator(reader->readValue("CounterBasedGenerator", getCounterBasedGenerator()));
+  setStreamedExecution(reader->readValue("StreamedExecution", getStreamedExecution()));
+  setSlabSize(reader->readValue("SlabSize", getSlabSize()));
 
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
   reader->closeFilterGroup();
 }
 
@@ -105,6 +120,18 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
 {
   typedef itk::Dream3DImage<InputPixelType, Dimension> InputImageType;
   typedef itk::Dream3DImage<OutputPixelType, Dimension> OutputImageType;
+  if(m_CounterBasedGenerator)
+  {
+    typedef itk::Functor::ShotNoise<typename itk::NumericTraits<OutputPixelType>::ValueType> NoiseType;
+    typedef itk::CounterBasedNoiseImageFilter<InputImageType, OutputImageType, NoiseType> FilterType;
+    typename FilterType::Pointer filter = FilterType::New();
+    NoiseType noise;
+    noise.SetScale(static_cast<double>(m_Scale));
+    filter->SetNoise(noise);
+    filter->SetSeed(static_cast<uint32_t>(m_Seed));
+    this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
+    return;
+  }
   // define filter
   typedef itk::ShotNoiseImageFilter<InputImageType, OutputImageType> FilterType;
   typename FilterType::Pointer filter = FilterType::New();
@@ -123,6 +150,14 @@ void ITKShotNoiseImage::filterInternal()
   Dream3DArraySwitchMacro(this->filter, getSelectedCellArrayPath(), -4);
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKShotNoiseImage::isStreamable() const
+{
+  return m_CounterBasedGenerator;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
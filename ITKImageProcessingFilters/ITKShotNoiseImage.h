@@ -17,6 +17,7 @@
 #include "SIMPLib/SIMPLib.h"
 
 // Auto includes
+#include <SIMPLib/FilterParameters/BooleanFilterParameter.h>
 #include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
 #include <itkShotNoiseImageFilter.h>
 
@@ -31,6 +32,7 @@ class ITKImageProcessing_EXPORT ITKShotNoiseImage : public ITKImageProcessingBas
   PYB11_CREATE_BINDINGS(ITKShotNoiseImage SUPERCLASS ITKImageProcessingBase)
   PYB11_PROPERTY(double Scale READ getScale WRITE setScale)
   PYB11_PROPERTY(double Seed READ getSeed WRITE setSeed)
+  PYB11_PROPERTY(bool CounterBasedGenerator READ getCounterBasedGenerator WRITE setCounterBasedGenerator)
 
 public:
   SIMPL_SHARED_POINTERS(ITKShotNoiseImage)
@@ -45,6 +47,13 @@ public:
   SIMPL_FILTER_PARAMETER(double, Seed)
   Q_PROPERTY(double Seed READ getSeed WRITE setSeed)
 
+  /**
+   * @brief CounterBasedGenerator Draws the noise of each value from a Philox generator keyed on the seed and
+   * on the position of the value, so that the output does not depend on the threads
+   */
+  SIMPL_FILTER_PARAMETER(bool, CounterBasedGenerator)
+  Q_PROPERTY(bool CounterBasedGenerator READ getCounterBasedGenerator WRITE setCounterBasedGenerator)
+
 
   /**
    * @brief newFilterInstance Reimplemented from @see AbstractFilter class
@@ -77,6 +86,12 @@ public:
    */
   void readFilterParameters(AbstractFilterParametersReader* reader, int index) override;
 
+  /**
+   * @brief isStreamable Reimplemented from @see ITKImageBase class. The noise of the counter-based generator
+   * does not depend on the regions processed.
+   */
+  bool isStreamable() const override;
+
 protected:
   ITKShotNoiseImage();
 
@@ -18,7 +18,6 @@
 
 // Auto includes
 #include <SIMPLib/FilterParameters/BooleanFilterParameter.h>
-#include <itkSignedDanielssonDistanceMapImageFilter.h>
 
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
 
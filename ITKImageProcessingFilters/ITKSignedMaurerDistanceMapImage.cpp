@@ -10,6 +10,7 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -19,6 +20,8 @@
 #include "SIMPLib/ITK/Dream3DTemplateAliasMacro.h"
 #include "SIMPLib/ITK/itkDream3DImage.h"
 
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkSeparableDistanceMapImageFilter.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -52,6 +55,7 @@ void ITKSignedMaurerDistanceMapImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKSignedMaurerDistanceMapImage, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKSignedMaurerDistanceMapImage));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -78,6 +82,7 @@ void ITKSignedMaurerDistanceMapImage::readFilterParameters(AbstractFilterParamet
   setUseImageSpacing(reader->readValue("UseImageSpacing", getUseImageSpacing()));
   setBackgroundValue(reader->readValue("BackgroundValue", getBackgroundValue()));
 
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
   reader->closeFilterGroup();
 }
 
@@ -111,12 +116,14 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
   typedef itk::Dream3DImage<InputPixelType, Dimension> InputImageType;
   typedef itk::Dream3DImage<OutputPixelType, Dimension> OutputImageType;
   // define filter
-  typedef itk::SignedMaurerDistanceMapImageFilter<InputImageType, OutputImageType> FilterType;
+  // Exact distance to the contour of the non-background pixels, signed in the same pass
+  typedef itk::SeparableDistanceMapImageFilter<InputImageType, OutputImageType> FilterType;
   typename FilterType::Pointer filter = FilterType::New();
+  filter->SetMode(FilterType::Mode::SignedContour);
   filter->SetInsideIsPositive(static_cast<bool>(m_InsideIsPositive));
   filter->SetSquaredDistance(static_cast<bool>(m_SquaredDistance));
   filter->SetUseImageSpacing(static_cast<bool>(m_UseImageSpacing));
-  filter->SetBackgroundValue(static_cast<double>(m_BackgroundValue));
+  filter->SetBackgroundValue(static_cast<typename FilterType::InputValueType>(m_BackgroundValue));
   this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
 
 }
@@ -19,7 +19,6 @@
 // Auto includes
 #include <SIMPLib/FilterParameters/BooleanFilterParameter.h>
 #include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
-#include <itkSignedMaurerDistanceMapImageFilter.h>
 
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
 
@@ -0,0 +1,166 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <itkImage.h>
+#include <itkImageFileReader.h>
+#include <itkImageIOBase.h>
+#include <itkImageIOFactory.h>
+#include <itkImageIORegion.h>
+#include <itkVectorImage.h>
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageIOFactoryMutex.h"
+
+/**
+ * @brief The ITKSliceDecoder class decodes one image file straight into a caller-owned buffer.
+ * It is meant to be used concurrently from several threads to fill the slices (or tiles) of an
+ * array allocated beforehand: decode() only touches the destination buffer it is given.
+ *
+ * A new ImageIO is cloned from @p prototype for every file, so the ImageIO factory is not queried
+ * for every slice of a stack. Files that the prototype cannot read as is (other format, pixel type or
+ * number of components) go through an itk::ImageFileReader, which converts them like
+ * itk::ImageSeriesReader would.
+ *
+ * By default pixels are decoded as scalars. When the decoder is created for several components per
+ * pixel, the components are kept interleaved in the destination buffer, as they are stored in the file.
+ */
+template <typename TPixel> class ITKSliceDecoder
+{
+public:
+  /**
+   * @param prototype ImageIO that read the information of the first file of the series. Every
+   * other file must have the same size.
+   * @param numberOfComponents Number of components of the decoded pixels
+   */
+  explicit ITKSliceDecoder(itk::ImageIOBase* prototype, unsigned int numberOfComponents = 1)
+  : m_Prototype(prototype)
+  , m_NumberOfComponents(numberOfComponents)
+  , m_NumberOfPixels(1)
+  {
+    for(unsigned int i = 0; i < prototype->GetNumberOfDimensions(); i++)
+    {
+      m_Dimensions.push_back(prototype->GetDimensions(i));
+      m_NumberOfPixels *= prototype->GetDimensions(i);
+    }
+  }
+
+  /**
+   * @brief decode Reads @p fileName into @p buffer, which must hold getNumberOfPixels() * getNumberOfComponents() values.
+   * If @p allowConversion is false, files that cannot be read as is are not converted and an error is returned.
+   * @return An empty string on success, the error message otherwise
+   */
+  std::string decode(const std::string& fileName, TPixel* buffer, bool allowConversion = true) const
+  {
+    try
+    {
+      itk::ImageIOBase::Pointer io = createImageIO();
+      if(nullptr != io && io->CanReadFile(fileName.c_str()))
+      {
+        io->SetFileName(fileName);
+        io->ReadImageInformation();
+        if(io->GetComponentType() == itk::ImageIOBase::MapPixelType<TPixel>::CType && io->GetNumberOfComponents() == m_NumberOfComponents && hasSameSize(io))
+        {
+          itk::ImageIORegion region(io->GetNumberOfDimensions());
+          for(unsigned int i = 0; i < io->GetNumberOfDimensions(); i++)
+          {
+            region.SetIndex(i, 0);
+            region.SetSize(i, io->GetDimensions(i));
+          }
+          io->SetIORegion(region);
+          io->Read(buffer);
+          return std::string();
+        }
+      }
+      if(!allowConversion)
+      {
+        return fileName + ": format, pixel type or size does not match the first image";
+      }
+      if(m_NumberOfComponents == 1)
+      {
+        return decodeWithReader<itk::Image<TPixel, 3>>(fileName, buffer);
+      }
+      return decodeWithReader<itk::VectorImage<TPixel, 3>>(fileName, buffer);
+    } catch(itk::ExceptionObject& err)
+    {
+      return fileName + ": " + err.GetDescription();
+    }
+  }
+
+  size_t getNumberOfPixels() const
+  {
+    return m_NumberOfPixels;
+  }
+
+  unsigned int getNumberOfComponents() const
+  {
+    return m_NumberOfComponents;
+  }
+
+protected:
+  itk::ImageIOBase::Pointer createImageIO() const
+  {
+    std::lock_guard<std::mutex> lock(ITKImageIOFactoryMutex());
+    return dynamic_cast<itk::ImageIOBase*>(m_Prototype->CreateAnother().GetPointer());
+  }
+
+  template <typename ImageType> std::string decodeWithReader(const std::string& fileName, TPixel* buffer) const
+  {
+    using ReaderType = itk::ImageFileReader<ImageType>;
+    typename ReaderType::Pointer reader = ReaderType::New();
+    {
+      std::lock_guard<std::mutex> lock(ITKImageIOFactoryMutex());
+      itk::ImageIOBase::Pointer io = itk::ImageIOFactory::CreateImageIO(fileName.c_str(), itk::ImageIOFactory::ReadMode);
+      if(nullptr == io)
+      {
+        return fileName + ": format is not supported";
+      }
+      reader->SetImageIO(io);
+    }
+    reader->SetFileName(fileName);
+    reader->Update();
+    ImageType* image = reader->GetOutput();
+    if(!hasSameSize(reader->GetImageIO()))
+    {
+      return fileName + ": size does not match the size of the first image";
+    }
+    if(image->GetNumberOfComponentsPerPixel() != m_NumberOfComponents)
+    {
+      return fileName + ": number of components does not match the number of components of the first image";
+    }
+    const TPixel* values = reinterpret_cast<const TPixel*>(image->GetBufferPointer());
+    std::copy(values, values + m_NumberOfPixels * m_NumberOfComponents, buffer);
+    return std::string();
+  }
+
+  /**
+   * @brief hasSameSize Compares the dimensions read by @p io with those of the prototype. Trailing
+   * dimensions of size 1 are ignored, so that a 2D file matches a 3D file with a single slice.
+   */
+  bool hasSameSize(itk::ImageIOBase* io) const
+  {
+    const unsigned int dimensions = std::max<unsigned int>(io->GetNumberOfDimensions(), static_cast<unsigned int>(m_Dimensions.size()));
+    for(unsigned int i = 0; i < dimensions; i++)
+    {
+      const size_t expected = i < m_Dimensions.size() ? m_Dimensions[i] : 1;
+      const size_t actual = i < io->GetNumberOfDimensions() ? io->GetDimensions(i) : 1;
+      if(expected != actual)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+private:
+  itk::ImageIOBase::Pointer m_Prototype;
+  unsigned int m_NumberOfComponents;
+  std::vector<size_t> m_Dimensions;
+  size_t m_NumberOfPixels;
+};
@@ -10,6 +10,7 @@
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/DataArraySelectionFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
@@ -20,6 +21,8 @@
 #include "SIMPLib/ITK/Dream3DTemplateAliasMacro.h"
 #include "SIMPLib/ITK/itkDream3DImage.h"
 
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKScaleSpace.h"
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -49,6 +52,7 @@ void ITKSmoothingRecursiveGaussianImage::setupFilterParameters()
   QStringList linkedProps;
   linkedProps << "NewCellArrayName";
   parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Save as New Array", SaveAsNewArray, FilterParameter::Parameter, ITKSmoothingRecursiveGaussianImage, linkedProps));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Number of Threads (0: Thread Budget)", NumberOfThreads, FilterParameter::Parameter, ITKSmoothingRecursiveGaussianImage));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::RequiredArray));
   {
     DataArraySelectionFilterParameter::RequirementType req =
@@ -73,6 +77,7 @@ void ITKSmoothingRecursiveGaussianImage::readFilterParameters(AbstractFilterPara
   setSigma(reader->readFloatVec3("Sigma", getSigma()));
   setNormalizeAcrossScale(reader->readValue("NormalizeAcrossScale", getNormalizeAcrossScale()));
 
+  setNumberOfThreads(reader->readValue("NumberOfThreads", getNumberOfThreads()));
   reader->closeFilterGroup();
 }
 
@@ -103,6 +108,39 @@ void ITKSmoothingRecursiveGaussianImage::dataCheckInternal()
 // -----------------------------------------------------------------------------
 
 template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKSmoothingRecursiveGaussianImage::filter()
+{
+  // The scale space cache holds images of scalar pixels
+  this->filter<InputPixelType, OutputPixelType, Dimension>(std::is_arithmetic<InputPixelType>());
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKSmoothingRecursiveGaussianImage::filter(std::true_type)
+{
+  typedef ITKScaleSpace<InputPixelType, Dimension> ScaleSpaceType;
+  // The normalization across scale only applies to derivatives, a smoothed image does not depend on it
+  const FloatVec3_t sigma = getSigma();
+  const float sigmas3[3] = {sigma.x, sigma.y, sigma.z};
+  std::array<double, Dimension> sigmas;
+  for(unsigned int d = 0; d < Dimension; d++)
+  {
+    sigmas[d] = static_cast<double>(sigmas3[d]);
+  }
+  auto compute = [sigmas](ScaleSpaceType& scaleSpace) {
+    typename ScaleSpaceType::RealImageType::Pointer smoothed = scaleSpace.get(ScaleSpaceType::Smoothed(sigmas));
+    return scaleSpace.template createImage<OutputPixelType>(smoothed.GetPointer());
+  };
+  if(!this->filterScaleSpace<InputPixelType, OutputPixelType, Dimension>(compute))
+  {
+    this->filter<InputPixelType, OutputPixelType, Dimension>(std::false_type());
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename InputPixelType, typename OutputPixelType, unsigned int Dimension> void ITKSmoothingRecursiveGaussianImage::filter(std::false_type)
 {
   typedef itk::Dream3DImage<InputPixelType, Dimension> InputImageType;
   typedef itk::Dream3DImage<OutputPixelType, Dimension> OutputImageType;
@@ -113,7 +151,6 @@ template <typename InputPixelType, typename OutputPixelType, unsigned int Dimens
   filter->SetSigmaArray( itkVecSigma );
   filter->SetNormalizeAcrossScale(static_cast<bool>(m_NormalizeAcrossScale));
   this->ITKImageProcessingBase::filter<InputPixelType, OutputPixelType, Dimension, FilterType>(filter);
-
 }
 
 // -----------------------------------------------------------------------------
@@ -21,6 +21,8 @@
 #include <SIMPLib/FilterParameters/FloatVec3FilterParameter.h>
 #include <itkSmoothingRecursiveGaussianImageFilter.h>
 
+#include <type_traits>
+
 #include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
 
 /**
@@ -101,6 +103,16 @@ protected:
   */
   template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter();
 
+  /**
+  * @brief Reads the smoothed image from the scale space cache, to scalar pixels
+  */
+  template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter(std::true_type scaleSpace);
+
+  /**
+  * @brief Applies itk::SmoothingRecursiveGaussianImageFilter, when the scale space cache cannot be used or to the other pixel types
+  */
+  template <typename InputImageType, typename OutputImageType, unsigned int Dimension> void filter(std::false_type scaleSpace);
+
 private:
   ITKSmoothingRecursiveGaussianImage(const ITKSmoothingRecursiveGaussianImage&) = delete;    // Copy Constructor Not Implemented
   ITKSmoothingRecursiveGaussianImage(ITKSmoothingRecursiveGaussianImage&&) = delete;         // Move Constructor Not Implemented
@@ -0,0 +1,247 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#include "ITKThreadingPolicy.h"
+
+#include <algorithm>
+#include <thread>
+
+#include <QtCore/QFile>
+#include <QtCore/QMutexLocker>
+#include <QtCore/QStringList>
+
+#include <itkMultiThreader.h>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace
+{
+#if defined(__linux__)
+/**
+ * @brief CPUsOfThread Returns the CPUs the calling thread may run on
+ */
+std::vector<int> CPUsOfThread()
+{
+  std::vector<int> cpus;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if(pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0)
+  {
+    for(int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+    {
+      if(CPU_ISSET(cpu, &set))
+      {
+        cpus.push_back(cpu);
+      }
+    }
+  }
+  return cpus;
+}
+
+/**
+ * @brief PinThread Restricts the calling thread to @p cpus
+ */
+void PinThread(const std::vector<int>& cpus)
+{
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for(int cpu : cpus)
+  {
+    if(cpu < CPU_SETSIZE)
+    {
+      CPU_SET(cpu, &set);
+    }
+  }
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+#endif
+} // namespace
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKThreadingPolicy::AffinityScope::AffinityScope()
+{
+#if defined(__linux__)
+  const std::vector<int> cpus = ITKThreadingPolicy::Instance().getCPUAffinity();
+  if(cpus.empty())
+  {
+    return;
+  }
+  m_PreviousCPUs = CPUsOfThread();
+  PinThread(cpus);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKThreadingPolicy::AffinityScope::~AffinityScope()
+{
+#if defined(__linux__)
+  if(!m_PreviousCPUs.empty())
+  {
+    PinThread(m_PreviousCPUs);
+  }
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKThreadingPolicy::ITKThreadingPolicy()
+: m_ThreadBudget(0)
+, m_ITKDefaultNumberOfThreads(itk::MultiThreader::GetGlobalDefaultNumberOfThreads())
+{
+  bool ok = false;
+  const int budget = qgetenv("ITKIMAGEPROCESSING_THREAD_BUDGET").toInt(&ok);
+  if(ok && budget > 0)
+  {
+    setThreadBudget(budget);
+  }
+  const QString cpuList = QString::fromLocal8Bit(qgetenv("ITKIMAGEPROCESSING_CPU_AFFINITY"));
+  const int numaNode = qgetenv("ITKIMAGEPROCESSING_NUMA_NODE").toInt(&ok);
+  if(!cpuList.isEmpty())
+  {
+    setCPUAffinity(cpuList);
+  }
+  else if(ok)
+  {
+    setNUMANode(numaNode);
+  }
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+ITKThreadingPolicy& ITKThreadingPolicy::Instance()
+{
+  static ITKThreadingPolicy policy;
+  return policy;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+void ITKThreadingPolicy::setThreadBudget(int threads)
+{
+  m_ThreadBudget.store(std::max(threads, 0));
+  itk::MultiThreader::SetGlobalDefaultNumberOfThreads(threads > 0 ? threads : m_ITKDefaultNumberOfThreads);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ITKThreadingPolicy::getThreadBudget() const
+{
+  return m_ThreadBudget.load();
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKThreadingPolicy::setCPUAffinity(const QString& cpuList)
+{
+  std::vector<int> cpus;
+  if(!ParseCPUList(cpuList, cpus))
+  {
+    return false;
+  }
+  QMutexLocker locker(&m_Mutex);
+  m_CPUAffinity = cpus;
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+std::vector<int> ITKThreadingPolicy::getCPUAffinity() const
+{
+  QMutexLocker locker(&m_Mutex);
+  return m_CPUAffinity;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKThreadingPolicy::setNUMANode(int node)
+{
+  QFile file(QString("/sys/devices/system/node/node%1/cpulist").arg(node));
+  if(node < 0 || !file.open(QIODevice::ReadOnly | QIODevice::Text))
+  {
+    return false;
+  }
+  const QString cpuList = QString::fromLatin1(file.readAll()).trimmed();
+  return !cpuList.isEmpty() && setCPUAffinity(cpuList);
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ITKThreadingPolicy::getNumberOfThreads(int requested) const
+{
+  int budget = m_ThreadBudget.load();
+  if(budget <= 0)
+  {
+    budget = AvailableCPUs();
+  }
+  {
+    // Pinned workers would only share the CPUs they are pinned to
+    QMutexLocker locker(&m_Mutex);
+    if(!m_CPUAffinity.empty())
+    {
+      budget = std::min(budget, static_cast<int>(m_CPUAffinity.size()));
+    }
+  }
+  budget = std::max(budget, 1);
+  return requested > 0 ? std::min(requested, budget) : budget;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+bool ITKThreadingPolicy::ParseCPUList(const QString& cpuList, std::vector<int>& cpus)
+{
+  cpus.clear();
+  const QStringList items = cpuList.split(',', QString::SkipEmptyParts);
+  for(const QString& item : items)
+  {
+    const QStringList bounds = item.trimmed().split('-');
+    bool firstOk = false;
+    bool lastOk = false;
+    const int first = bounds[0].toInt(&firstOk);
+    const int last = bounds.size() == 2 ? bounds[1].toInt(&lastOk) : first;
+    if(!firstOk || (bounds.size() == 2 && !lastOk) || bounds.size() > 2 || first < 0 || last < first)
+    {
+      cpus.clear();
+      return false;
+    }
+    for(int cpu = first; cpu <= last; cpu++)
+    {
+      cpus.push_back(cpu);
+    }
+  }
+  std::sort(cpus.begin(), cpus.end());
+  cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+  return true;
+}
+
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+int ITKThreadingPolicy::AvailableCPUs()
+{
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if(sched_getaffinity(0, sizeof(set), &set) == 0)
+  {
+    return std::max(CPU_COUNT(&set), 1);
+  }
+#endif
+  return std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+}
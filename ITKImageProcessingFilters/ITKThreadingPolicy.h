@@ -0,0 +1,119 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <atomic>
+#include <vector>
+
+#include <QtCore/QMutex>
+#include <QtCore/QString>
+
+#include "ITKImageProcessing/ITKImageProcessingDLLExport.h"
+
+/**
+ * @brief The ITKThreadingPolicy class decides how many threads the ITK filters of this plugin use and
+ * on which CPUs they run.
+ *
+ * The thread budget is the largest number of threads a filter of the plugin may use. It defaults to the
+ * number of CPUs the process may run on and is read from the ITKIMAGEPROCESSING_THREAD_BUDGET environment
+ * variable. Several pipelines sharing a machine should each be given a share of its cores, e.g. 32 each
+ * for four pipelines on 128 cores, instead of every filter starting one thread per core. A filter asks
+ * for its own number of threads (its NumberOfThreads parameter), 0 meaning the whole budget.
+ *
+ * Workers can also be pinned to a set of CPUs, given as a list such as "0-31,64-95" by setCPUAffinity(),
+ * setNUMANode() or the ITKIMAGEPROCESSING_CPU_AFFINITY and ITKIMAGEPROCESSING_NUMA_NODE environment variables. Pinning relies on threads
+ * inheriting the CPU set of the thread that creates them: AffinityScope pins the thread running a filter
+ * while ITK spawns its workers. It is only supported on Linux, and has no effect on the workers of an ITK
+ * thread pool that was started before.
+ */
+class ITKImageProcessing_EXPORT ITKThreadingPolicy
+{
+public:
+  /**
+   * @brief The AffinityScope class pins the calling thread, and the threads it creates, to the CPUs of
+   * the policy while it lives. The previous CPU set of the thread is restored when it is destroyed.
+   */
+  class ITKImageProcessing_EXPORT AffinityScope
+  {
+  public:
+    AffinityScope();
+    ~AffinityScope();
+
+    AffinityScope(const AffinityScope&) = delete;            // Copy Constructor Not Implemented
+    AffinityScope(AffinityScope&&) = delete;                 // Move Constructor Not Implemented
+    AffinityScope& operator=(const AffinityScope&) = delete; // Copy Assignment Not Implemented
+    AffinityScope& operator=(AffinityScope&&) = delete;      // Move Assignment Not Implemented
+
+  private:
+    std::vector<int> m_PreviousCPUs;
+  };
+
+  /**
+   * @brief Instance Returns the policy shared by every filter of the process
+   */
+  static ITKThreadingPolicy& Instance();
+
+  /**
+   * @brief setThreadBudget Sets the largest number of threads a filter may use. 0 restores the default,
+   * the number of CPUs available to the process. A positive budget also becomes the default of ITK, so that
+   * the filters ITK creates internally stay within it; 0 gives ITK its own default back.
+   */
+  void setThreadBudget(int threads);
+  int getThreadBudget() const;
+
+  /**
+   * @brief setCPUAffinity Pins the workers of the filters to the CPUs of @p cpuList, a comma separated list
+   * of CPU numbers and ranges ("0-31,64-95"). An empty list removes the pinning.
+   * @return false if the list cannot be parsed
+   */
+  bool setCPUAffinity(const QString& cpuList);
+  std::vector<int> getCPUAffinity() const;
+
+  /**
+   * @brief setNUMANode Pins the workers of the filters to the CPUs of NUMA node @p node
+   * @return false if the CPUs of the node are unknown
+   */
+  bool setNUMANode(int node);
+
+  /**
+   * @brief getNumberOfThreads Returns the number of threads of a filter that asks for @p requested threads,
+   * 0 meaning as many as the budget allows
+   */
+  int getNumberOfThreads(int requested) const;
+
+  /**
+   * @brief apply Sets the number of threads of the ITK filter @p filter
+   */
+  template <typename FilterType> void apply(FilterType* filter, int requested) const
+  {
+    filter->SetNumberOfThreads(getNumberOfThreads(requested));
+  }
+
+  /**
+   * @brief ParseCPUList Parses a list of CPUs such as "0-3,8,10-11", the format of the Linux cpulist files
+   * @return false if the list is not valid
+   */
+  static bool ParseCPUList(const QString& cpuList, std::vector<int>& cpus);
+
+protected:
+  ITKThreadingPolicy();
+
+private:
+  std::atomic<int> m_ThreadBudget;
+  const int m_ITKDefaultNumberOfThreads;
+  mutable QMutex m_Mutex;
+  std::vector<int> m_CPUAffinity;
+
+  /**
+   * @brief AvailableCPUs Returns the number of CPUs the process may run on
+   */
+  static int AvailableCPUs();
+
+public:
+  ITKThreadingPolicy(const ITKThreadingPolicy&) = delete;            // Copy Constructor Not Implemented
+  ITKThreadingPolicy(ITKThreadingPolicy&&) = delete;                 // Move Constructor Not Implemented
+  ITKThreadingPolicy& operator=(const ITKThreadingPolicy&) = delete; // Copy Assignment Not Implemented
+  ITKThreadingPolicy& operator=(ITKThreadingPolicy&&) = delete;      // Move Assignment Not Implemented
+};
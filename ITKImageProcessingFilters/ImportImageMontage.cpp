@@ -9,11 +9,14 @@
 
 // Include the factory
 #include "SIMPLib/Common/Constants.h"
+#include "SIMPLib/DataArrays/DataArray.hpp"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersWriter.h"
 #include "SIMPLib/FilterParameters/FileListInfoFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatVec3FilterParameter.h"
 #include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Filtering/FilterManager.h"
@@ -22,6 +25,19 @@
 
 #include "ITKImageProcessing/ITKImageProcessingConstants.h"
 #include "ITKImageProcessing/ITKImageProcessingVersion.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageIOMetaDataCache.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKMontageTileDecoder.h"
+
+namespace
+{
+/**
+ * @brief TileArrayName Returns the name of the array a tile is imported into: its file name up to the first '.'
+ */
+QString TileArrayName(const QString& filePath)
+{
+  return QFileInfo(filePath).baseName();
+}
+} // namespace
 
 // -----------------------------------------------------------------------------
 //
@@ -45,6 +61,11 @@ ImportImageMontage::ImportImageMontage()
   m_InputFileListInfo.EndIndex = 0;
   m_InputFileListInfo.PaddingDigits = 0;
 
+  m_NumberOfReaderThreads = 0;
+  m_PackTiles = false;
+  m_PackedTilesArrayName = SIMPL::CellData::ImageData;
+  m_TileNamesArrayName = "TileNames";
+
   m_NumImages = 0;
 }
 
@@ -65,12 +86,21 @@ void ImportImageMontage::setupFilterParameters()
 
   parameters.push_back(SIMPL_NEW_FLOAT_VEC3_FP("Resolution", Resolution, FilterParameter::Parameter, ImportImageMontage));
 
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Reader Threads (0: all cores)", NumberOfReaderThreads, FilterParameter::Parameter, ImportImageMontage));
+
+  QStringList linkedProps;
+  linkedProps << "PackedTilesArrayName"
+              << "TileNamesArrayName";
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Pack Tiles in a Single Array", PackTiles, FilterParameter::Parameter, ImportImageMontage, linkedProps));
+
   parameters.push_back(SIMPL_NEW_STRING_FP("Data Container", DataContainerName, FilterParameter::CreatedArray, ImportImageMontage));
 
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::CreatedArray));
 
   parameters.push_back(SIMPL_NEW_STRING_FP("Cell Attribute Matrix", CellAttributeMatrixName, FilterParameter::CreatedArray, ImportImageMontage));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Packed Tiles", PackedTilesArrayName, FilterParameter::CreatedArray, ImportImageMontage));
   parameters.push_back(SIMPL_NEW_STRING_FP("Meta Data Attribute Matrix", MetaDataAttributeMatrixName, FilterParameter::CreatedArray, ImportImageMontage));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Tile Names", TileNamesArrayName, FilterParameter::CreatedArray, ImportImageMontage));
 
   setFilterParameters(parameters);
 }
@@ -87,6 +117,10 @@ void ImportImageMontage::readFilterParameters(AbstractFilterParametersReader* re
   setInputFileListInfo(reader->readFileListInfo("InputFileListInfo", getInputFileListInfo()));
   setOrigin(reader->readFloatVec3("Origin", getOrigin()));
   setResolution(reader->readFloatVec3("Resolution", getResolution()));
+  setNumberOfReaderThreads(reader->readValue("NumberOfReaderThreads", getNumberOfReaderThreads()));
+  setPackTiles(reader->readValue("PackTiles", getPackTiles()));
+  setPackedTilesArrayName(reader->readString("PackedTilesArrayName", getPackedTilesArrayName()));
+  setTileNamesArrayName(reader->readString("TileNamesArrayName", getTileNamesArrayName()));
   reader->closeFilterGroup();
 }
 
@@ -101,6 +135,7 @@ void ImportImageMontage::initialize()
   m_NumImages = 0;
   m_ArrayNames.clear();
   m_Coords.clear();
+  m_TileFiles.clear();
 }
 
 // -----------------------------------------------------------------------------
@@ -171,44 +206,59 @@ void ImportImageMontage::dataCheck()
     setFileName(fileList[0]);
     QFileInfo fi(fileList[0]);
     DataArrayPath dap(getDataContainerName(), getCellAttributeMatrixName(), fi.baseName());
-    readImage(dap, true);
-    // The previous call will add an attribute array that we don't need at this point
-    // so just remove it.
+    if(!ITKImageIOMetaDataCache::PreflightImage(this, fileList[0], dap))
+    {
+      readImage(dap, true);
+    }
     AttributeMatrix::Pointer am = m->getAttributeMatrix(getCellAttributeMatrixName());
-    am->removeAttributeArray(fi.baseName());
+    if(getErrorCondition() < 0 || nullptr == am.get())
+    {
+      return;
+    }
+    // The previous call added the array of the first file. It is only kept as the prototype of the
+    // arrays of the tiles, which all have the type and the number of components of the first file.
+    IDataArray::Pointer prototypeArray = am->removeAttributeArray(fi.baseName());
+    if(nullptr == prototypeArray.get())
+    {
+      return;
+    }
 
+    m_TileFiles = ITKExistingTileFiles(fileList);
     AttributeMatrix::Pointer mdAttrMat = getDataContainerArray()->getDataContainer(getDataContainerName())->getAttributeMatrix(getMetaDataAttributeMatrixName());
-    size_t availableFileCount = 0;
-    for(QVector<QString>::iterator filepath = fileList.begin(); filepath != fileList.end(); ++filepath)
+    mdAttrMat->setTupleDimensions(QVector<size_t>(1, static_cast<size_t>(m_TileFiles.size())));
+
+    if(m_PackTiles)
     {
-      QString imageFName = *filepath;
-      QFileInfo fi(imageFName);
-      if(fi.exists())
+      // One array holds every tile, the meta data maps the tile numbers to the file names
+      IDataArray::Pointer stack = ITKCreateTileStack(m, am, prototypeArray, getPackedTilesArrayName(), static_cast<size_t>(m_TileFiles.size()), !getInPreflight());
+      if(nullptr == stack.get())
+      {
+        QString ss = QObject::tr("Only 2D images can be packed in a tile stack");
+        setErrorCondition(-14002);
+        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+        return;
+      }
+      StringDataArray::Pointer tileNames = StringDataArray::CreateArray(mdAttrMat->getNumberOfTuples(), getTileNamesArrayName());
+      for(int i = 0; i < m_TileFiles.size(); i++)
       {
-        availableFileCount++;
+        tileNames->setValue(i, TileArrayName(m_TileFiles[i]));
       }
+      mdAttrMat->addAttributeArray(getTileNamesArrayName(), tileNames);
+      return;
     }
-    mdAttrMat->setTupleDimensions(QVector<size_t>(1, availableFileCount));
-
-    QVector<size_t> cDims(1, 1);
 
-    for(QVector<QString>::iterator filepath = fileList.begin(); filepath != fileList.end(); ++filepath)
+    for(const QString& imageFName : m_TileFiles)
     {
-      QString imageFName = *filepath;
-      QFileInfo fi(imageFName);
-      if(!fi.exists())
-      {
-        continue;
-      }
-      QStringList splitFilePaths = imageFName.split('/');
-      QString fileName = splitFilePaths[splitFilePaths.size() - 1];
-      splitFilePaths = fileName.split('.');
-      DataArrayPath path(getDataContainerName(), getCellAttributeMatrixName(), splitFilePaths[0]);
-      getDataContainerArray()->createNonPrereqArrayFromPath<UInt8ArrayType, AbstractFilter, uint8_t>(this, path, 0, cDims);
-      if(getErrorCondition() < 0)
+      DataArrayPath path(getDataContainerName(), getCellAttributeMatrixName(), TileArrayName(imageFName));
+      if(am->doesAttributeArrayExist(path.getDataArrayName()))
       {
+        QString ss = QObject::tr("The array name '%1' of the file '%2' is already used by another file").arg(path.getDataArrayName()).arg(imageFName);
+        setErrorCondition(-14001);
+        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
         return;
       }
+      IDataArray::Pointer tileArray = prototypeArray->createNewArray(am->getNumberOfTuples(), prototypeArray->getComponentDimensions(), path.getDataArrayName(), !getInPreflight());
+      am->addAttributeArray(path.getDataArrayName(), tileArray);
     }
   }
 }
@@ -242,46 +292,77 @@ void ImportImageMontage::execute()
 
   DataContainer::Pointer m = getDataContainerArray()->getDataContainer(getDataContainerName());
   AttributeMatrix::Pointer attrMat = m->getAttributeMatrix(getCellAttributeMatrixName());
-
-  bool hasMissingFiles = false;
-  bool orderAscending = false;
-
-  if(m_InputFileListInfo.Ordering == 0)
-  {
-    orderAscending = true;
-  }
-  else if(m_InputFileListInfo.Ordering == 1)
+  if(m_TileFiles.isEmpty())
   {
-    orderAscending = false;
+    notifyStatusMessage(getHumanLabel(), "Complete");
+    return;
   }
 
-  // Now generate all the file names the user is asking for and populate the table
-  QVector<QString> fileList = FilePathGenerator::GenerateFileList(m_InputFileListInfo.StartIndex, m_InputFileListInfo.EndIndex, m_InputFileListInfo.IncrementIndex, hasMissingFiles, orderAscending,
-                                                                  m_InputFileListInfo.InputPath, m_InputFileListInfo.FilePrefix, m_InputFileListInfo.FileSuffix, m_InputFileListInfo.FileExtension,
-                                                                  m_InputFileListInfo.PaddingDigits);
-  if(fileList.size() == 0)
+  if(m_PackTiles)
   {
-    QString ss = QObject::tr("No files have been selected for import. Have you set the input directory?");
-    setErrorCondition(-11);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    IDataArray::Pointer stack = attrMat->getAttributeArray(getPackedTilesArrayName());
+    const std::string error = ITKDecodeTileStack(this, m_TileFiles, stack, m_NumberOfReaderThreads);
+    if(!error.empty())
+    {
+      setErrorCondition(-14000);
+      notifyErrorMessage(getHumanLabel(), QString("Failed to load image file: %1").arg(QString::fromStdString(error)), getErrorCondition());
+      return;
+    }
+    notifyStatusMessage(getHumanLabel(), "Complete");
+    return;
   }
 
-  for(QVector<QString>::iterator filepath = fileList.begin(); filepath != fileList.end(); ++filepath)
+  // The ImageIO that reads the header of the first tile is the prototype of those that read every tile
+  itk::ImageIOBase::Pointer prototype = ITKCreateTileImageIO(m_TileFiles[0]);
+
+  // Tiles of the format, pixel type and size of the first one are decoded concurrently. The others are
+  // read one at a time by the reader helper.
+  QVector<QString> remainingFiles = m_TileFiles;
+  if(nullptr != prototype)
   {
-    QString imageFName = *filepath;
-    QFileInfo fi(imageFName);
-    if(!fi.exists())
+    const unsigned int numberOfComponents = prototype->GetNumberOfComponents();
+    switch(prototype->GetComponentType())
     {
-      continue;
+    case itk::ImageIOBase::UCHAR:
+      remainingFiles = decodeTiles<uint8_t>(attrMat, prototype, numberOfComponents);
+      break;
+    case itk::ImageIOBase::CHAR:
+      remainingFiles = decodeTiles<int8_t>(attrMat, prototype, numberOfComponents);
+      break;
+    case itk::ImageIOBase::USHORT:
+      remainingFiles = decodeTiles<uint16_t>(attrMat, prototype, numberOfComponents);
+      break;
+    case itk::ImageIOBase::SHORT:
+      remainingFiles = decodeTiles<int16_t>(attrMat, prototype, numberOfComponents);
+      break;
+    case itk::ImageIOBase::UINT:
+      remainingFiles = decodeTiles<uint32_t>(attrMat, prototype, numberOfComponents);
+      break;
+    case itk::ImageIOBase::INT:
+      remainingFiles = decodeTiles<int32_t>(attrMat, prototype, numberOfComponents);
+      break;
+    case itk::ImageIOBase::FLOAT:
+      remainingFiles = decodeTiles<float>(attrMat, prototype, numberOfComponents);
+      break;
+    case itk::ImageIOBase::DOUBLE:
+      remainingFiles = decodeTiles<double>(attrMat, prototype, numberOfComponents);
+      break;
+    default:
+      break;
     }
-    QStringList splitFilePaths = imageFName.split('/');
-    QString fileName = splitFilePaths[splitFilePaths.size() - 1];
-    splitFilePaths = fileName.split('.');
+  }
+  if(getCancel())
+  {
+    return;
+  }
+
+  for(const QString& imageFName : remainingFiles)
+  {
     QString ss = QObject::tr("Importing file %1").arg(imageFName);
     notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
 
     setFileName(imageFName);
-    DataArrayPath dap(getDataContainerName(), getCellAttributeMatrixName(), splitFilePaths[0]);
+    DataArrayPath dap(getDataContainerName(), getCellAttributeMatrixName(), TileArrayName(imageFName));
     readImage(dap, false);
     if(getErrorCondition() < 0)
     {
@@ -300,6 +381,36 @@ void ImportImageMontage::execute()
   notifyStatusMessage(getHumanLabel(), "Complete");
 }
 
+// -----------------------------------------------------------------------------
+//
+// -----------------------------------------------------------------------------
+template <typename TPixel> QVector<QString> ImportImageMontage::decodeTiles(const AttributeMatrix::Pointer& attrMat, itk::ImageIOBase* prototype, unsigned int numberOfComponents)
+{
+  const ITKMontageTileDecoder<TPixel> decoder(prototype, numberOfComponents);
+  const size_t numberOfTiles = static_cast<size_t>(m_TileFiles.size());
+  std::vector<TPixel*> buffers(numberOfTiles, nullptr);
+  for(size_t i = 0; i < numberOfTiles; i++)
+  {
+    typename DataArray<TPixel>::Pointer tileArray = std::dynamic_pointer_cast<DataArray<TPixel>>(attrMat->getAttributeArray(TileArrayName(m_TileFiles[static_cast<int>(i)])));
+    if(nullptr != tileArray.get() && tileArray->getNumberOfTuples() == decoder.getNumberOfPixels() && tileArray->getNumberOfComponents() == static_cast<int>(numberOfComponents))
+    {
+      buffers[i] = tileArray->getPointer(0);
+    }
+  }
+  // Tiles are not converted here: those the prototype cannot read as is go through the reader helper
+  const std::vector<std::string> errors = decoder.decode(this, m_TileFiles, buffers, false, m_NumberOfReaderThreads);
+
+  QVector<QString> remainingFiles;
+  for(size_t i = 0; i < numberOfTiles; i++)
+  {
+    if(nullptr == buffers[i] || !errors[i].empty())
+    {
+      remainingFiles.push_back(m_TileFiles[static_cast<int>(i)]);
+    }
+  }
+  return remainingFiles;
+}
+
 // -----------------------------------------------------------------------------
 //
 // -----------------------------------------------------------------------------
@@ -316,6 +427,10 @@ AbstractFilter::Pointer ImportImageMontage::newFilterInstance(bool copyFilterPar
     SIMPL_COPY_INSTANCEVAR(Resolution)
     SIMPL_COPY_INSTANCEVAR(Origin)
     SIMPL_COPY_INSTANCEVAR(InputFileListInfo)
+    SIMPL_COPY_INSTANCEVAR(NumberOfReaderThreads)
+    SIMPL_COPY_INSTANCEVAR(PackTiles)
+    SIMPL_COPY_INSTANCEVAR(PackedTilesArrayName)
+    SIMPL_COPY_INSTANCEVAR(TileNamesArrayName)
   }
   return filter;
 }
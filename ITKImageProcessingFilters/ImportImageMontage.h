@@ -8,6 +8,7 @@
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/DataArrays/StringDataArray.h"
+#include "SIMPLib/DataContainers/AttributeMatrix.h"
 #include "SIMPLib/FilterParameters/FileListInfoFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatVec3FilterParameter.h"
 #include "SIMPLib/Filtering/AbstractFilter.h"
@@ -32,6 +33,10 @@ class ITKImageProcessing_EXPORT ImportImageMontage : public AbstractFilter
   PYB11_PROPERTY(FloatVec3_t Origin READ getOrigin WRITE setOrigin)
   PYB11_PROPERTY(FloatVec3_t Resolution READ getResolution WRITE setResolution)
   PYB11_PROPERTY(FileListInfo_t InputFileListInfo READ getInputFileListInfo WRITE setInputFileListInfo)
+  PYB11_PROPERTY(int NumberOfReaderThreads READ getNumberOfReaderThreads WRITE setNumberOfReaderThreads)
+  PYB11_PROPERTY(bool PackTiles READ getPackTiles WRITE setPackTiles)
+  PYB11_PROPERTY(QString PackedTilesArrayName READ getPackedTilesArrayName WRITE setPackedTilesArrayName)
+  PYB11_PROPERTY(QString TileNamesArrayName READ getTileNamesArrayName WRITE setTileNamesArrayName)
 public:
   SIMPL_SHARED_POINTERS(ImportImageMontage)
   SIMPL_FILTER_NEW_MACRO(ImportImageMontage)
@@ -57,6 +62,18 @@ public:
   SIMPL_FILTER_PARAMETER(FileListInfo_t, InputFileListInfo)
   Q_PROPERTY(FileListInfo_t InputFileListInfo READ getInputFileListInfo WRITE setInputFileListInfo)
 
+  SIMPL_FILTER_PARAMETER(int, NumberOfReaderThreads)
+  Q_PROPERTY(int NumberOfReaderThreads READ getNumberOfReaderThreads WRITE setNumberOfReaderThreads)
+
+  SIMPL_FILTER_PARAMETER(bool, PackTiles)
+  Q_PROPERTY(bool PackTiles READ getPackTiles WRITE setPackTiles)
+
+  SIMPL_FILTER_PARAMETER(QString, PackedTilesArrayName)
+  Q_PROPERTY(QString PackedTilesArrayName READ getPackedTilesArrayName WRITE setPackedTilesArrayName)
+
+  SIMPL_FILTER_PARAMETER(QString, TileNamesArrayName)
+  Q_PROPERTY(QString TileNamesArrayName READ getTileNamesArrayName WRITE setTileNamesArrayName)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -165,6 +182,14 @@ protected:
    */
   void initialize();
 
+  /**
+   * @brief decodeTiles Decodes the tiles concurrently, each one straight into the array allocated for it by
+   * dataCheck(). Every tile is read by an ImageIO cloned from @p prototype. At most NumberOfReaderThreads
+   * tiles are decoded at once.
+   * @return The tiles that could not be decoded that way and must be read by the reader helper
+   */
+  template <typename TPixel> QVector<QString> decodeTiles(const AttributeMatrix::Pointer& attrMat, itk::ImageIOBase* prototype, unsigned int numberOfComponents);
+
 private:
   DEFINE_DATAARRAY_VARIABLE(float, RegistrationCoordinates)
 
@@ -173,6 +198,7 @@ private:
   int32_t m_NumImages;
   QVector<QString> m_ArrayNames;
   std::vector<float> m_Coords;
+  QVector<QString> m_TileFiles;
 
   /**
    * @brief Include the declarations of the ITKImageReader helper functions that are common
@@ -5,12 +5,14 @@
 #include "ImportRegisteredImageMontage.h"
 
 #include <QtCore/QDir>
+#include <QtCore/QHash>
 
 #include "SIMPLib/Common/Constants.h"
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/FileListInfoFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatVec3FilterParameter.h"
 #include "SIMPLib/FilterParameters/InputFileFilterParameter.h"
+#include "SIMPLib/FilterParameters/LinkedBooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
@@ -19,6 +21,8 @@
 
 #include "ITKImageProcessing/ITKImageProcessingConstants.h"
 #include "ITKImageProcessing/ITKImageProcessingVersion.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageIOMetaDataCache.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKMontageTileDecoder.h"
 
 // -----------------------------------------------------------------------------
 //
@@ -30,6 +34,8 @@ ImportRegisteredImageMontage::ImportRegisteredImageMontage()
 , m_RegistrationFile("")
 , m_RegistrationCoordinatesArrayName("RegistrationCoordinates")
 , m_AttributeArrayNamesArrayName("AttributeArrayNames")
+, m_PackTiles(false)
+, m_PackedTilesArrayName(SIMPL::CellData::ImageData)
 , m_RegistrationCoordinates(nullptr)
 {
   m_Origin.x = 0.0;
@@ -65,9 +71,12 @@ void ImportRegisteredImageMontage::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_FLOAT_VEC3_FP("Resolution", Resolution, FilterParameter::Parameter, ImportRegisteredImageMontage));
 
   parameters.push_back(SIMPL_NEW_INPUT_FILE_FP("Registration File", RegistrationFile, FilterParameter::Parameter, ImportRegisteredImageMontage, "", "*.txt"));
+  QStringList linkedProps("PackedTilesArrayName");
+  parameters.push_back(SIMPL_NEW_LINKED_BOOL_FP("Pack Tiles in a Single Array", PackTiles, FilterParameter::Parameter, ImportRegisteredImageMontage, linkedProps));
   parameters.push_back(SIMPL_NEW_STRING_FP("Data Container", DataContainerName, FilterParameter::CreatedArray, ImportRegisteredImageMontage));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Cell Attribute Matrix", CellAttributeMatrixName, FilterParameter::CreatedArray, ImportRegisteredImageMontage));
+  parameters.push_back(SIMPL_NEW_STRING_FP("Packed Tiles", PackedTilesArrayName, FilterParameter::CreatedArray, ImportRegisteredImageMontage));
   parameters.push_back(SeparatorFilterParameter::New("Meta Data", FilterParameter::CreatedArray));
   parameters.push_back(SIMPL_NEW_STRING_FP("Meta Data Attribute Matrix", MetaDataAttributeMatrixName, FilterParameter::CreatedArray, ImportRegisteredImageMontage));
   parameters.push_back(SIMPL_NEW_STRING_FP("Registration Coordinates", RegistrationCoordinatesArrayName, FilterParameter::CreatedArray, ImportRegisteredImageMontage));
@@ -90,6 +99,8 @@ void ImportRegisteredImageMontage::readFilterParameters(AbstractFilterParameters
   setOrigin(reader->readFloatVec3("Origin", getOrigin()));
   setResolution(reader->readFloatVec3("Resolution", getResolution()));
   setRegistrationFile(reader->readString("RegistrationFile", getRegistrationFile()));
+  setPackTiles(reader->readValue("PackTiles", getPackTiles()));
+  setPackedTilesArrayName(reader->readString("PackedTilesArrayName", getPackedTilesArrayName()));
   reader->closeFilterGroup();
 }
 
@@ -156,6 +167,7 @@ void ImportRegisteredImageMontage::initialize()
   m_NumImages = 0;
   m_ArrayNames.clear();
   m_Coords.clear();
+  m_TileFiles.clear();
 }
 
 // -----------------------------------------------------------------------------
@@ -278,24 +290,22 @@ void ImportRegisteredImageMontage::dataCheck()
     setFileName(fileList[0]);
     QFileInfo fi(fileList[0]);
     DataArrayPath dap(getDataContainerName(), getCellAttributeMatrixName(), fi.baseName());
-    readImage(dap, true);
-    // The previous call will add an attribute array that we don't need at this point
-    // so just remove it.
+    if(!ITKImageIOMetaDataCache::PreflightImage(this, fileList[0], dap))
+    {
+      readImage(dap, true);
+    }
     AttributeMatrix::Pointer am = m->getAttributeMatrix(getCellAttributeMatrixName());
-    am->removeAttributeArray(fi.baseName());
-
-    AttributeMatrix::Pointer mdAttrMat = getDataContainerArray()->getDataContainer(getDataContainerName())->getAttributeMatrix(getMetaDataAttributeMatrixName());
-    size_t availableFileCount = 0;
-    for(QVector<QString>::iterator filepath = fileList.begin(); filepath != fileList.end(); ++filepath)
+    if(getErrorCondition() < 0 || nullptr == am.get())
     {
-      QString imageFName = *filepath;
-      QFileInfo fi(imageFName);
-      if(fi.exists())
-      {
-        availableFileCount++;
-      }
+      return;
     }
-    if(availableFileCount != mdAttrMat->getNumberOfTuples())
+    // The previous call will add an attribute array that we don't need at this point
+    // so just remove it. It is kept as the prototype of the packed tile stack.
+    IDataArray::Pointer prototypeArray = am->removeAttributeArray(fi.baseName());
+
+    AttributeMatrix::Pointer mdAttrMat = getDataContainerArray()->getDataContainer(getDataContainerName())->getAttributeMatrix(getMetaDataAttributeMatrixName());
+    const QVector<QString> existingFiles = ITKExistingTileFiles(fileList);
+    if(static_cast<size_t>(existingFiles.size()) != mdAttrMat->getNumberOfTuples())
     {
       QString ss = QObject::tr("The number of files in selected folder (%1) does not match the number in the registration file (%2)").arg(fileList.size()).arg(mdAttrMat->getNumberOfTuples());
       setErrorCondition(-101);
@@ -303,20 +313,47 @@ void ImportRegisteredImageMontage::dataCheck()
       return;
     }
 
-    QVector<size_t> cDims(1, 1);
-
-    for(QVector<QString>::iterator filepath = fileList.begin(); filepath != fileList.end(); ++filepath)
+    if(m_PackTiles)
     {
-      QString imageFName = *filepath;
-      QFileInfo fi(imageFName);
-      if(!fi.exists())
+      // Tile i of the stack is the image i of the registration file, so that the names and the coordinates
+      // of the meta data index the stack
+      QHash<QString, QString> filesByName;
+      for(const QString& filePath : existingFiles)
       {
-        continue;
+        filesByName.insert(QFileInfo(filePath).baseName(), filePath);
       }
-      QStringList splitFilePaths = imageFName.split('/');
-      QString fileName = splitFilePaths[splitFilePaths.size() - 1];
-      splitFilePaths = fileName.split('.');
-      DataArrayPath path(getDataContainerName(), getCellAttributeMatrixName(), splitFilePaths[0]);
+      for(int i = 0; i < m_NumImages && i < m_ArrayNames.size(); i++)
+      {
+        QHash<QString, QString>::const_iterator file = filesByName.constFind(m_ArrayNames[i]);
+        if(file == filesByName.constEnd())
+        {
+          QString ss = QObject::tr("The image '%1' of the registration file was not found in the selected folder").arg(m_ArrayNames[i]);
+          setErrorCondition(-102);
+          notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+          return;
+        }
+        m_TileFiles.push_back(*file);
+      }
+      IDataArray::Pointer stack;
+      if(nullptr != prototypeArray.get())
+      {
+        stack = ITKCreateTileStack(m, am, prototypeArray, getPackedTilesArrayName(), static_cast<size_t>(m_TileFiles.size()), !getInPreflight());
+      }
+      if(nullptr == stack.get())
+      {
+        QString ss = QObject::tr("Only 2D images can be packed in a tile stack");
+        setErrorCondition(-103);
+        notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+      }
+      return;
+    }
+
+    m_TileFiles = existingFiles;
+    QVector<size_t> cDims(1, 1);
+
+    for(const QString& imageFName : m_TileFiles)
+    {
+      DataArrayPath path(getDataContainerName(), getCellAttributeMatrixName(), QFileInfo(imageFName).baseName());
       getDataContainerArray()->createNonPrereqArrayFromPath<UInt8ArrayType, AbstractFilter, uint8_t>(this, path, 0, cDims);
       if(getErrorCondition() < 0)
       {
@@ -362,47 +399,26 @@ void ImportRegisteredImageMontage::execute()
     m_RegistrationCoordinates[2 * i + 1] = m_Coords[2 * i + 1];
   }
 
-  qint64 z = m_InputFileListInfo.StartIndex;
-
-  bool hasMissingFiles = false;
-  bool orderAscending = false;
-
-  if(m_InputFileListInfo.Ordering == 0)
-  {
-    orderAscending = true;
-  }
-  else if(m_InputFileListInfo.Ordering == 1)
-  {
-    orderAscending = false;
-  }
-
-  // Now generate all the file names the user is asking for and populate the table
-  QVector<QString> fileList = FilePathGenerator::GenerateFileList(m_InputFileListInfo.StartIndex, m_InputFileListInfo.EndIndex, m_InputFileListInfo.IncrementIndex, hasMissingFiles, orderAscending,
-                                                                  m_InputFileListInfo.InputPath, m_InputFileListInfo.FilePrefix, m_InputFileListInfo.FileSuffix, m_InputFileListInfo.FileExtension,
-                                                                  m_InputFileListInfo.PaddingDigits);
-  if(fileList.size() == 0)
+  if(m_PackTiles)
   {
-    QString ss = QObject::tr("No files have been selected for import. Have you set the input directory?");
-    setErrorCondition(-11);
-    notifyErrorMessage(getHumanLabel(), ss, getErrorCondition());
+    const std::string error = ITKDecodeTileStack(this, m_TileFiles, attrMat->getAttributeArray(getPackedTilesArrayName()), 0);
+    if(!error.empty())
+    {
+      setErrorCondition(-14000);
+      notifyErrorMessage(getHumanLabel(), QString("Failed to load image file: %1").arg(QString::fromStdString(error)), getErrorCondition());
+      return;
+    }
+    notifyStatusMessage(getHumanLabel(), "Complete");
+    return;
   }
 
-  for(QVector<QString>::iterator filepath = fileList.begin(); filepath != fileList.end(); ++filepath)
+  for(const QString& imageFName : m_TileFiles)
   {
-    QString imageFName = *filepath;
-    QFileInfo fi(imageFName);
-    if(!fi.exists())
-    {
-      continue;
-    }
-    QStringList splitFilePaths = imageFName.split('/');
-    QString fileName = splitFilePaths[splitFilePaths.size() - 1];
-    splitFilePaths = fileName.split('.');
     QString ss = QObject::tr("Importing file %1").arg(imageFName);
     notifyStatusMessage(getMessagePrefix(), getHumanLabel(), ss);
 
     setFileName(imageFName);
-    DataArrayPath dap(getDataContainerName(), getCellAttributeMatrixName(), splitFilePaths[0]);
+    DataArrayPath dap(getDataContainerName(), getCellAttributeMatrixName(), QFileInfo(imageFName).baseName());
     readImage(dap, false);
     if(getErrorCondition() < 0)
     {
@@ -417,7 +433,7 @@ void ImportRegisteredImageMontage::execute()
       ImageGeom::Pointer imageGeom = m->getGeometryAs<ImageGeom>();
       size_t dims[3] = {0, 0, 0};
       std::tie(dims[0], dims[1], dims[2]) = imageGeom->getDimensions();
-      dims[2] = fileList.size();
+      dims[2] = m_TileFiles.size();
       imageGeom->setDimensions(dims);
     }
     if(getCancel())
@@ -450,6 +466,8 @@ AbstractFilter::Pointer ImportRegisteredImageMontage::newFilterInstance(bool cop
     SIMPL_COPY_INSTANCEVAR(Origin)
     SIMPL_COPY_INSTANCEVAR(InputFileListInfo)
     SIMPL_COPY_INSTANCEVAR(RegistrationFile)
+    SIMPL_COPY_INSTANCEVAR(PackTiles)
+    SIMPL_COPY_INSTANCEVAR(PackedTilesArrayName)
   }
   return filter;
 }
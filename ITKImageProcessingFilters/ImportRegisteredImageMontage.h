@@ -35,6 +35,8 @@ class ITKImageProcessing_EXPORT ImportRegisteredImageMontage : public AbstractFi
   PYB11_PROPERTY(FileListInfo_t InputFileListInfo READ getInputFileListInfo WRITE setInputFileListInfo)
   PYB11_PROPERTY(QString RegistrationCoordinatesArrayName READ getRegistrationCoordinatesArrayName WRITE setRegistrationCoordinatesArrayName)
   PYB11_PROPERTY(QString AttributeArrayNamesArrayName READ getAttributeArrayNamesArrayName WRITE setAttributeArrayNamesArrayName)
+  PYB11_PROPERTY(bool PackTiles READ getPackTiles WRITE setPackTiles)
+  PYB11_PROPERTY(QString PackedTilesArrayName READ getPackedTilesArrayName WRITE setPackedTilesArrayName)
 public:
   SIMPL_SHARED_POINTERS(ImportRegisteredImageMontage)
   SIMPL_FILTER_NEW_MACRO(ImportRegisteredImageMontage)
@@ -69,6 +71,12 @@ public:
   SIMPL_FILTER_PARAMETER(QString, AttributeArrayNamesArrayName)
   Q_PROPERTY(QString AttributeArrayNamesArrayName READ getAttributeArrayNamesArrayName WRITE setAttributeArrayNamesArrayName)
 
+  SIMPL_FILTER_PARAMETER(bool, PackTiles)
+  Q_PROPERTY(bool PackTiles READ getPackTiles WRITE setPackTiles)
+
+  SIMPL_FILTER_PARAMETER(QString, PackedTilesArrayName)
+  Q_PROPERTY(QString PackedTilesArrayName READ getPackedTilesArrayName WRITE setPackedTilesArrayName)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -185,6 +193,7 @@ private:
   int32_t m_NumImages;
   QVector<QString> m_ArrayNames;
   std::vector<float> m_Coords;
+  QVector<QString> m_TileFiles;
 
   /**
    * @brief Include the declarations of the ITKImageReader helper functions that are common
@@ -37,7 +37,12 @@
 
 #include <string.h>
 
+#include <algorithm>
 #include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include <QtCore/QDir>
 #include <QtCore/QString>
@@ -45,6 +50,7 @@
 #include "SIMPLib/FilterParameters/AbstractFilterParametersReader.h"
 #include "SIMPLib/FilterParameters/BooleanFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatVec3FilterParameter.h"
+#include "SIMPLib/FilterParameters/IntegerFilterParameter.h"
 #include "SIMPLib/FilterParameters/SeparatorFilterParameter.h"
 #include "SIMPLib/FilterParameters/StringFilterParameter.h"
 #include "SIMPLib/Geometry/ImageGeom.h"
@@ -53,15 +59,171 @@
 #include "ITKImageProcessing/FilterParameters/ImportVectorImageStackFilterParameter.h"
 
 #include "ITKImageProcessing/ITKImageProcessingConstants.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageIOFactoryMutex.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageIOMetaDataCache.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageReader.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKSliceDecoder.h"
 #include "ITKImageProcessing/ITKImageProcessingVersion.h"
 
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#include <tbb/task_scheduler_init.h>
+#endif
+
 namespace
 {
 const QString TempDCName("DC");
 const QString TempAMName("AM");
 const QString TempDAName("Image");
 const DataArrayPath TempDAP(TempDCName, TempAMName, TempDAName);
+
+/**
+ * @brief VectorFilePath Returns the path of the file holding component @p component of slice @p index
+ */
+QString VectorFilePath(const VectorFileListInfo_t& info, int index, int component)
+{
+  QString filename = QString("%1%2%3%4%5.%6")
+                         .arg(info.FilePrefix)
+                         .arg(QString::number(index), info.PaddingDigits, '0')
+                         .arg(info.Separator)
+                         .arg(QString::number(component), info.PaddingDigits, '0')
+                         .arg(info.FileSuffix)
+                         .arg(info.FileExtension);
+  return QDir::toNativeSeparators(info.InputPath + QDir::separator() + filename);
+}
+
+/**
+ * @brief RGBToGray Converts @p numberOfPixels RGB pixels to their luminance. Each value is computed as
+ * it always was (float weights, truncated to 16 bits) in a plain loop over contiguous buffers, which
+ * the compiler vectorizes.
+ */
+template <typename T> void RGBToGray(const T* rgb, size_t numberOfPixels, T* gray)
+{
+  const float x = 0.2125f;
+  const float y = 0.7154f;
+  const float z = 0.0721f;
+  for(size_t t = 0; t < numberOfPixels; t++)
+  {
+    gray[t] = static_cast<T>(static_cast<uint16_t>((rgb[3 * t] * x) + (rgb[3 * t + 1] * y) + (rgb[3 * t + 2] * z)));
+  }
+}
+
+/**
+ * @brief FirstComponent Copies the first component of @p numberOfPixels pixels of @p numberOfComponents values
+ */
+template <typename T> void FirstComponent(const T* pixels, size_t numberOfPixels, size_t numberOfComponents, T* values)
+{
+  for(size_t t = 0; t < numberOfPixels; t++)
+  {
+    values[t] = pixels[t * numberOfComponents];
+  }
+}
+
+/**
+ * @brief InterleaveComponents Writes the @p numberOfComponents planes of @p planes as the components of the
+ * tuples of @p tuples. The copy is done by tiles of pixels so that the tuples written for a tile stay in cache
+ * while each plane is read sequentially.
+ */
+template <typename T> void InterleaveComponents(const T* planes, size_t numberOfPixels, size_t numberOfComponents, T* tuples)
+{
+  const size_t tileSize = 256;
+  for(size_t tile = 0; tile < numberOfPixels; tile += tileSize)
+  {
+    const size_t tileEnd = std::min(tile + tileSize, numberOfPixels);
+    for(size_t j = 0; j < numberOfComponents; j++)
+    {
+      const T* plane = planes + j * numberOfPixels;
+      for(size_t t = tile; t < tileEnd; t++)
+      {
+        tuples[t * numberOfComponents + j] = plane[t];
+      }
+    }
+  }
+}
+
+/**
+ * @brief The ImportVectorSlicesImpl class reads a range of slices of the stack. Every file of a slice is decoded
+ * once into a scratch buffer, reduced to one value per pixel into its component plane, and the planes are then
+ * interleaved into the slice of the vector array.
+ */
+template <typename T> class ImportVectorSlicesImpl
+{
+public:
+  ImportVectorSlicesImpl(const std::map<unsigned int, std::unique_ptr<ITKSliceDecoder<T>>>& decoders, const QVector<QString>& files, const std::vector<unsigned int>& fileComponents,
+                         size_t numberOfComponents, bool convertToGrayscale, T* data, std::vector<std::string>& errors, AbstractFilter* filter)
+  : m_Decoders(decoders)
+  , m_Files(files)
+  , m_FileComponents(fileComponents)
+  , m_NumberOfComponents(numberOfComponents)
+  , m_ConvertToGrayscale(convertToGrayscale)
+  , m_Data(data)
+  , m_Errors(errors)
+  , m_Filter(filter)
+  {
+  }
+
+  void convert(size_t start, size_t end) const
+  {
+    const size_t numberOfPixels = m_Decoders.begin()->second->getNumberOfPixels();
+    std::vector<T> planes(numberOfPixels * m_NumberOfComponents);
+    std::vector<T> scratch;
+    for(size_t slice = start; slice < end; slice++)
+    {
+      if(m_Filter->getCancel())
+      {
+        return;
+      }
+      for(size_t j = 0; j < m_NumberOfComponents; j++)
+      {
+        const size_t fileIndex = slice * m_NumberOfComponents + j;
+        const unsigned int fileComponents = m_FileComponents[fileIndex];
+        T* plane = planes.data() + j * numberOfPixels;
+        const ITKSliceDecoder<T>& decoder = *m_Decoders.at(fileComponents);
+        if(fileComponents == 1)
+        {
+          m_Errors[slice] = decoder.decode(m_Files[static_cast<int>(fileIndex)].toStdString(), plane);
+        }
+        else
+        {
+          scratch.resize(numberOfPixels * fileComponents);
+          m_Errors[slice] = decoder.decode(m_Files[static_cast<int>(fileIndex)].toStdString(), scratch.data());
+          if(fileComponents == 3 && m_ConvertToGrayscale)
+          {
+            RGBToGray(scratch.data(), numberOfPixels, plane);
+          }
+          else
+          {
+            FirstComponent(scratch.data(), numberOfPixels, fileComponents, plane);
+          }
+        }
+        if(!m_Errors[slice].empty())
+        {
+          return;
+        }
+      }
+      InterleaveComponents(planes.data(), numberOfPixels, m_NumberOfComponents, m_Data + slice * numberOfPixels * m_NumberOfComponents);
+    }
+  }
+
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  void operator()(const tbb::blocked_range<size_t>& r) const
+  {
+    convert(r.begin(), r.end());
+  }
+#endif
+
+private:
+  const std::map<unsigned int, std::unique_ptr<ITKSliceDecoder<T>>>& m_Decoders;
+  const QVector<QString>& m_Files;
+  const std::vector<unsigned int>& m_FileComponents;
+  size_t m_NumberOfComponents;
+  bool m_ConvertToGrayscale;
+  T* m_Data;
+  std::vector<std::string>& m_Errors;
+  AbstractFilter* m_Filter;
+};
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -72,6 +234,7 @@ ImportVectorImageStack::ImportVectorImageStack()
 , m_CellAttributeMatrixName(SIMPL::Defaults::CellAttributeMatrixName)
 , m_VectorDataArrayName(SIMPL::CellData::VectorData)
 , m_ConvertToGrayscale(true)
+, m_NumberOfReaderThreads(0)
 {
   initialize();
 }
@@ -92,6 +255,7 @@ void ImportVectorImageStack::setupFilterParameters()
   parameters.push_back(SIMPL_NEW_FLOAT_VEC3_FP("Origin", Origin, FilterParameter::Parameter, ImportVectorImageStack));
   parameters.push_back(SIMPL_NEW_FLOAT_VEC3_FP("Resolution", Resolution, FilterParameter::Parameter, ImportVectorImageStack));
   parameters.push_back(SIMPL_NEW_BOOL_FP("Convert Color To Grayscale", ConvertToGrayscale, FilterParameter::Parameter, ImportVectorImageStack));
+  parameters.push_back(SIMPL_NEW_INTEGER_FP("Reader Threads (0: all cores)", NumberOfReaderThreads, FilterParameter::Parameter, ImportVectorImageStack));
 
   parameters.push_back(SIMPL_NEW_STRING_FP("Data Container Name", DataContainerName, FilterParameter::CreatedArray, ImportVectorImageStack));
   parameters.push_back(SeparatorFilterParameter::New("Cell Data", FilterParameter::CreatedArray));
@@ -214,16 +378,7 @@ void ImportVectorImageStack::dataCheck()
 
       index2 = m_InputFileListInfo.StartComponent /* +j */;
 
-      QString filename = QString("%1%2%3%4%5.%6")
-                             .arg(m_InputFileListInfo.FilePrefix)
-                             .arg(QString::number(index), m_InputFileListInfo.PaddingDigits, '0')
-                             .arg(m_InputFileListInfo.Separator)
-                             .arg(QString::number(index2), m_InputFileListInfo.PaddingDigits, '0')
-                             .arg(m_InputFileListInfo.FileSuffix)
-                             .arg(m_InputFileListInfo.FileExtension);
-
-      QString filePath = m_InputFileListInfo.InputPath + QDir::separator() + filename;
-      filePath = QDir::toNativeSeparators(filePath);
+      QString filePath = VectorFilePath(m_InputFileListInfo, index, index2);
       QFileInfo fi(filePath);
       if(!fi.exists())
       {
@@ -294,104 +449,129 @@ void ImportVectorImageStack::preflight()
 // -----------------------------------------------------------------------------
 template <typename T> void importVectorData(ImportVectorImageStack* filter)
 {
-
   using DataArrayType = DataArray<T>;
   using DataArrayPointerType = typename DataArrayType::Pointer;
 
   DataContainer::Pointer m = filter->getDataContainerArray()->getDataContainer(filter->getDataContainerName());
   AttributeMatrix::Pointer cellAttrMat = m->getAttributeMatrix(filter->getCellAttributeMatrixName());
-  ImageGeom::Pointer geom = m->getGeometryAs<ImageGeom>();
 
   IDataArray::Pointer iVectorData = cellAttrMat->getAttributeArray(filter->getVectorDataArrayName());
   DataArrayPointerType vectorData = std::dynamic_pointer_cast<DataArrayType>(iVectorData);
 
   VectorFileListInfo_t m_InputFileListInfo = filter->getInputFileListInfo();
-  bool orderAscending = false;
-
-  if(m_InputFileListInfo.Ordering == SIMPL::RefFrameZDir::LowtoHigh)
-  {
-    orderAscending = true;
-  }
-  else if(m_InputFileListInfo.Ordering == SIMPL::RefFrameZDir::HightoLow)
-  {
-    orderAscending = false;
-  }
+  const bool orderAscending = (m_InputFileListInfo.Ordering == SIMPL::RefFrameZDir::LowtoHigh);
 
   auto numSlices = static_cast<size_t>(m_InputFileListInfo.EndIndex - m_InputFileListInfo.StartIndex + 1);
   int totalComp = m_InputFileListInfo.EndComponent - m_InputFileListInfo.StartComponent + 1;
 
+  // Every file must exist and its header is needed to know how many components it holds. The headers
+  // were cached by dataCheck() for the first file and are cached here for the others.
+  QVector<QString> files(static_cast<int>(numSlices) * totalComp);
+  std::vector<unsigned int> fileComponents(files.size());
   for(size_t slice = 0; slice < numSlices; ++slice)
   {
+    const int index = orderAscending ? m_InputFileListInfo.StartIndex + static_cast<int>(slice) : m_InputFileListInfo.EndIndex - static_cast<int>(slice);
     for(int j = 0; j < totalComp; j++)
     {
-      int index = 0;
-      int index2 = 0;
-      if(orderAscending)
-      {
-        index = static_cast<size_t>(m_InputFileListInfo.StartIndex) + slice;
-      }
-      else
-      {
-        index = static_cast<size_t>(m_InputFileListInfo.EndIndex) - slice;
-      }
-
-      index2 = m_InputFileListInfo.StartComponent + j;
-
-      QString filename = QString("%1%2%3%4%5.%6")
-                             .arg(m_InputFileListInfo.FilePrefix)
-                             .arg(QString::number(index), m_InputFileListInfo.PaddingDigits, '0')
-                             .arg(m_InputFileListInfo.Separator)
-                             .arg(QString::number(index2), m_InputFileListInfo.PaddingDigits, '0')
-                             .arg(m_InputFileListInfo.FileSuffix)
-                             .arg(m_InputFileListInfo.FileExtension);
-
-      QString filePath = m_InputFileListInfo.InputPath + QDir::separator() + filename;
-      filePath = QDir::toNativeSeparators(filePath);
-      QFileInfo fi(filePath);
+      const int fileIndex = static_cast<int>(slice) * totalComp + j;
+      files[fileIndex] = VectorFilePath(m_InputFileListInfo, index, m_InputFileListInfo.StartComponent + j);
+      QFileInfo fi(files[fileIndex]);
       if(!fi.exists())
       {
         filter->setErrorCondition(-40200);
-        QString errorMessage = QString("File Not Found: %1.").arg(filePath);
+        QString errorMessage = QString("File Not Found: %1.").arg(files[fileIndex]);
         filter->notifyErrorMessage(filter->getHumanLabel(), errorMessage, filter->getErrorCondition());
         return;
       }
+      ITKImageIOMetaDataCache::MetaData metaData;
+      const QString error = ITKImageIOMetaDataCache::Instance().getMetaData(files[fileIndex], metaData);
+      if(!error.isEmpty())
+      {
+        filter->setErrorCondition(-40202);
+        filter->notifyErrorMessage(filter->getHumanLabel(), error, filter->getErrorCondition());
+        return;
+      }
+      fileComponents[fileIndex] = metaData.numberOfComponents;
+    }
+  }
 
-      QString progress = QString("Reading Slice %1/%2 Component %3/%4").arg(slice).arg(numSlices).arg(j).arg(totalComp);
-      filter->notifyStatusMessage(filter->getHumanLabel(), progress);
-
-      ITKImageReader::Pointer imageReader = ITKImageReader::New();
-      imageReader->setDataContainerName(::TempDCName);
-      imageReader->setCellAttributeMatrixName(::TempAMName);
-      imageReader->setImageDataArrayName(::TempDAName);
-      imageReader->setFileName(filePath);
-      imageReader->execute();
-      filter->setErrorCondition(imageReader->getErrorCondition());
-
-      // Get the DataContainer from the ITKReadImage filter
-      DataContainer::Pointer imageReaderDC = imageReader->getDataContainerArray()->getDataContainer(::TempDCName);
-      AttributeMatrix::Pointer imageReaderAM = imageReaderDC->getAttributeMatrix(::TempAMName);
-      IDataArray::Pointer iDataArrayPtr = imageReaderAM->getAttributeArray(::TempDAName);
-      DataArrayPointerType data = std::dynamic_pointer_cast<DataArrayType>(iDataArrayPtr);
-      int32_t importNumComp = data->getNumberOfComponents();
-      size_t nTuples = data->getNumberOfTuples();
-      size_t indexOffset = slice * nTuples;
+  // The ImageIO of the first file is cloned for every other file. One decoder is needed per number of
+  // components found in the stack (typically grayscale and RGB).
+  itk::ImageIOBase::Pointer imageIO;
+  {
+    std::lock_guard<std::mutex> lock(ITKImageIOFactoryMutex());
+    imageIO = itk::ImageIOFactory::CreateImageIO(files[0].toLatin1(), itk::ImageIOFactory::ReadMode);
+  }
+  if(nullptr == imageIO)
+  {
+    filter->setErrorCondition(-40202);
+    QString errorMessage = QString("ITK could not read the given file \"%1\". Format is likely unsupported.").arg(files[0]);
+    filter->notifyErrorMessage(filter->getHumanLabel(), errorMessage, filter->getErrorCondition());
+    return;
+  }
+  std::map<unsigned int, std::unique_ptr<ITKSliceDecoder<T>>> decoders;
+  try
+  {
+    imageIO->SetFileName(files[0].toLatin1());
+    imageIO->ReadImageInformation();
+    for(unsigned int numberOfComponents : fileComponents)
+    {
+      if(decoders.find(numberOfComponents) == decoders.end())
+      {
+        decoders[numberOfComponents].reset(new ITKSliceDecoder<T>(imageIO, numberOfComponents));
+      }
+    }
+  } catch(itk::ExceptionObject& err)
+  {
+    filter->setErrorCondition(-40202);
+    QString errorMessage = "ITK exception was thrown while processing input file: %1";
+    filter->notifyErrorMessage(filter->getHumanLabel(), errorMessage.arg(err.what()), filter->getErrorCondition());
+    return;
+  }
+  const size_t numberOfPixels = decoders.begin()->second->getNumberOfPixels();
+  if(numberOfPixels * numSlices != vectorData->getNumberOfTuples())
+  {
+    filter->setErrorCondition(-40204);
+    QString errorMessage = QString("The size of the image in %1 does not match the size of the first image of the stack.").arg(files[0]);
+    filter->notifyErrorMessage(filter->getHumanLabel(), errorMessage, filter->getErrorCondition());
+    return;
+  }
 
-      for(size_t t = 0; t < nTuples; t++)
+  std::vector<std::string> errors(numSlices);
+  ImportVectorSlicesImpl<T> impl(decoders, files, fileComponents, static_cast<size_t>(totalComp), filter->getConvertToGrayscale(), vectorData->getPointer(0), errors, filter);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+  const int numberOfThreads = filter->getNumberOfReaderThreads() > 0 ? filter->getNumberOfReaderThreads() : tbb::task_scheduler_init::default_num_threads();
+  tbb::task_arena arena(numberOfThreads);
+#else
+  const int numberOfThreads = 1;
+#endif
+  // Slices are read in chunks so that progress is reported in order and cancellation is checked
+  // regularly, while every thread of the arena still has a few slices to read in each chunk.
+  const size_t chunkSize = static_cast<size_t>(numberOfThreads) * 4;
+  for(size_t start = 0; start < numSlices; start += chunkSize)
+  {
+    if(filter->getCancel())
+    {
+      return;
+    }
+    const size_t end = std::min(start + chunkSize, numSlices);
+#ifdef SIMPL_USE_PARALLEL_ALGORITHMS
+    arena.execute([&] { tbb::parallel_for(tbb::blocked_range<size_t>(start, end), impl); });
+#else
+    impl.convert(start, end);
+#endif
+    for(size_t i = start; i < end; i++)
+    {
+      if(!errors[i].empty())
       {
-        // Get the value from the read in image
-        T* value = data->getTuplePointer(t);
-        if(importNumComp == 3 && filter->getConvertToGrayscale()) // The input image was RGB, so covert it to GrayScale
-        {
-          float x = 0.2125f;
-          float y = 0.7154f;
-          float z = 0.0721f;
-          // Just store it in place since this is a throw away array
-          value[0] = static_cast<uint16_t>((value[0] * x) + (value[1] * y) + (value[2] * z));
-        }
-        // Place that value into the VectorData Array at the correct location
-        vectorData->setComponent(indexOffset + t, j, value[0]);
+        filter->setErrorCondition(-40203);
+        QString errorMessage = "ITK exception was thrown while processing input file: %1";
+        filter->notifyErrorMessage(filter->getHumanLabel(), errorMessage.arg(QString::fromStdString(errors[i])), filter->getErrorCondition());
+        return;
       }
     }
+    QString progress = QString("Imported %1 of %2 slices").arg(end).arg(numSlices);
+    filter->notifyStatusMessage(filter->getHumanLabel(), progress);
   }
 }
 
@@ -444,6 +624,7 @@ AbstractFilter::Pointer ImportVectorImageStack::newFilterInstance(bool copyFilte
     SIMPL_COPY_INSTANCEVAR(Origin)
     SIMPL_COPY_INSTANCEVAR(InputFileListInfo)
     SIMPL_COPY_INSTANCEVAR(VectorDataArrayName)
+    SIMPL_COPY_INSTANCEVAR(NumberOfReaderThreads)
   }
   return filter;
 }
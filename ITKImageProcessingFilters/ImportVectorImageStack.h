@@ -67,6 +67,7 @@ class ITKImageProcessing_EXPORT ImportVectorImageStack : public AbstractFilter
   PYB11_PROPERTY(VectorFileListInfo_t InputFileListInfo READ getInputFileListInfo WRITE setInputFileListInfo)
   PYB11_PROPERTY(QString VectorDataArrayName READ getVectorDataArrayName WRITE setVectorDataArrayName)
   PYB11_PROPERTY(bool ConvertToGrayscale READ getConvertToGrayscale WRITE setConvertToGrayscale)
+  PYB11_PROPERTY(int NumberOfReaderThreads READ getNumberOfReaderThreads WRITE setNumberOfReaderThreads)
 public:
   SIMPL_SHARED_POINTERS(ImportVectorImageStack)
   SIMPL_FILTER_NEW_MACRO(ImportVectorImageStack)
@@ -95,6 +96,9 @@ public:
   SIMPL_FILTER_PARAMETER(bool, ConvertToGrayscale)
   Q_PROPERTY(bool ConvertToGrayscale READ getConvertToGrayscale WRITE setConvertToGrayscale)
 
+  SIMPL_FILTER_PARAMETER(int, NumberOfReaderThreads)
+  Q_PROPERTY(int NumberOfReaderThreads READ getNumberOfReaderThreads WRITE setNumberOfReaderThreads)
+
   /**
    * @brief getCompiledLibraryName Reimplemented from @see AbstractFilter class
    */
@@ -0,0 +1,396 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include <itkImageScanlineIterator.h>
+#include <itkInPlaceImageFilter.h>
+#include <itkMath.h>
+#include <itkNumericTraits.h>
+#include <itkProgressReporter.h>
+
+namespace itk
+{
+/** \class Philox4x32
+ * \brief Philox4x32-10 counter-based random number generator (Salmon et al., "Parallel Random Numbers: As
+ * Easy as 1, 2, 3", SC 2011).
+ *
+ * Each block of 4 random 32 bit words is a bijection of a 128 bit counter, keyed by 64 bits: any block can
+ * be computed directly, in any order and on any thread. Generate() computes N blocks at once, the lanes
+ * being the innermost loop of each round so that the compiler can process several counters per
+ * instruction.
+ */
+class Philox4x32
+{
+public:
+  static const unsigned int Rounds = 10;
+
+  /** Replaces the N counters (words 0 to 3 of counters[word][lane]) by their random blocks */
+  template <unsigned int N> static void Generate(uint32_t (&counters)[4][N], uint32_t key0, uint32_t key1)
+  {
+    for(unsigned int round = 0; round < Rounds; round++)
+    {
+      for(unsigned int lane = 0; lane < N; lane++)
+      {
+        const uint64_t product0 = static_cast<uint64_t>(Multiplier0) * counters[0][lane];
+        const uint64_t product1 = static_cast<uint64_t>(Multiplier1) * counters[2][lane];
+        const uint32_t word0 = static_cast<uint32_t>(product1 >> 32) ^ counters[1][lane] ^ key0;
+        const uint32_t word2 = static_cast<uint32_t>(product0 >> 32) ^ counters[3][lane] ^ key1;
+        counters[0][lane] = word0;
+        counters[1][lane] = static_cast<uint32_t>(product1);
+        counters[2][lane] = word2;
+        counters[3][lane] = static_cast<uint32_t>(product0);
+      }
+      key0 += Weyl0;
+      key1 += Weyl1;
+    }
+  }
+
+  /** Returns a uniform variate in (0, 1) made of a random word */
+  static double ToUniform(uint32_t word)
+  {
+    return (static_cast<double>(word) + 0.5) * (1.0 / 4294967296.0);
+  }
+
+private:
+  static const uint32_t Multiplier0 = 0xD2511F53u;
+  static const uint32_t Multiplier1 = 0xCD9E8D57u;
+  static const uint32_t Weyl0 = 0x9E3779B9u;
+  static const uint32_t Weyl1 = 0xBB67AE85u;
+};
+
+/** \class CounterBasedRandomStream
+ * \brief Sequence of uniform variates of one value of an image: the blocks of the counters (value, block),
+ * under the key (seed, noise). The first block is usually computed beforehand with the blocks of
+ * neighboring values; the next ones, needed by rejection sampling, are computed on demand.
+ */
+class CounterBasedRandomStream
+{
+public:
+  CounterBasedRandomStream(uint64_t value, uint32_t key0, uint32_t key1, const uint32_t (&firstBlock)[4])
+  : m_Value(value)
+  , m_Key0(key0)
+  , m_Key1(key1)
+  , m_BlockIndex(0)
+  , m_Position(0)
+  {
+    std::copy(firstBlock, firstBlock + 4, m_Block);
+  }
+
+  /** Returns the next uniform variate, in (0, 1) */
+  double GetVariate()
+  {
+    if(m_Position == 4)
+    {
+      m_BlockIndex++;
+      uint32_t counter[4][1] = {{static_cast<uint32_t>(m_Value)}, {static_cast<uint32_t>(m_Value >> 32)}, {0}, {m_BlockIndex}};
+      Philox4x32::Generate(counter, m_Key0, m_Key1);
+      for(unsigned int word = 0; word < 4; word++)
+      {
+        m_Block[word] = counter[word][0];
+      }
+      m_Position = 0;
+    }
+    return Philox4x32::ToUniform(m_Block[m_Position++]);
+  }
+
+  /** Returns a standard normal variate (Box-Muller) */
+  double GetNormalVariate()
+  {
+    const double radius = std::sqrt(-2.0 * std::log(GetVariate()));
+    return radius * std::cos(2.0 * Math::pi * GetVariate());
+  }
+
+private:
+  uint64_t m_Value;
+  uint32_t m_Key0;
+  uint32_t m_Key1;
+  uint32_t m_BlockIndex;
+  unsigned int m_Position;
+  uint32_t m_Block[4];
+};
+
+namespace Functor
+{
+/** Converts a noisy value to the output type as the ITK noise filters do: clamped to its range, and
+ * rounded for integer types */
+template <typename TOutput> TOutput NoiseClampCast(double value)
+{
+  if(value >= static_cast<double>(NumericTraits<TOutput>::max()))
+  {
+    return NumericTraits<TOutput>::max();
+  }
+  if(value <= static_cast<double>(NumericTraits<TOutput>::NonpositiveMin()))
+  {
+    return NumericTraits<TOutput>::NonpositiveMin();
+  }
+  if(NumericTraits<TOutput>::is_integer)
+  {
+    return Math::Round<TOutput>(value);
+  }
+  return static_cast<TOutput>(value);
+}
+
+/** Noise of itk::SaltAndPepperNoiseImageFilter: a value becomes the largest (salt) or lowest (pepper) value of
+ * the output type with the given probability, salt and pepper being equally likely */
+template <typename TOutput> class SaltAndPepperNoise
+{
+public:
+  static const uint32_t Key = 0x53505052u;
+
+  SaltAndPepperNoise()
+  : m_Probability(0.01)
+  {
+  }
+
+  void SetProbability(double probability)
+  {
+    m_Probability = probability;
+  }
+
+  TOutput operator()(double value, CounterBasedRandomStream& stream) const
+  {
+    if(stream.GetVariate() < m_Probability)
+    {
+      return (stream.GetVariate() < 0.5) ? NumericTraits<TOutput>::max() : NumericTraits<TOutput>::NonpositiveMin();
+    }
+    return static_cast<TOutput>(value);
+  }
+
+private:
+  double m_Probability;
+};
+
+/** Noise of itk::ShotNoiseImageFilter: a value v becomes N(v * s) / s, N being a Poisson variate, drawn by
+ * Knuth's algorithm below a mean of 50 and approximated by a normal variate above */
+template <typename TOutput> class ShotNoise
+{
+public:
+  static const uint32_t Key = 0x53484F54u;
+
+  ShotNoise()
+  : m_Scale(1.0)
+  {
+  }
+
+  void SetScale(double scale)
+  {
+    m_Scale = scale;
+  }
+
+  TOutput operator()(double value, CounterBasedRandomStream& stream) const
+  {
+    const double mean = m_Scale * value;
+    if(mean < 50.0)
+    {
+      const double limit = std::exp(-mean);
+      long k = 0;
+      double p = 1.0;
+      do
+      {
+        k++;
+        p *= stream.GetVariate();
+      } while(p > limit);
+      return NoiseClampCast<TOutput>(static_cast<double>(k - 1) / m_Scale);
+    }
+    return NoiseClampCast<TOutput>((mean + std::sqrt(mean) * stream.GetNormalVariate()) / m_Scale);
+  }
+
+private:
+  double m_Scale;
+};
+
+/** Noise of itk::SpeckleNoiseImageFilter: a value is multiplied by a gamma variate of mean 1 and of the
+ * given standard deviation, drawn as the sum of the variate of the fractional part of its shape (Ahrens and
+ * Dieter) and of exponential variates for its integer part */
+template <typename TOutput> class SpeckleNoise
+{
+public:
+  static const uint32_t Key = 0x53504B4Cu;
+
+  SpeckleNoise()
+  {
+    SetStandardDeviation(1.0);
+  }
+
+  void SetStandardDeviation(double standardDeviation)
+  {
+    m_Theta = standardDeviation * standardDeviation;
+    const double shape = 1.0 / m_Theta;
+    m_IntegerShape = std::floor(shape);
+    m_Delta = shape - m_IntegerShape;
+    m_V0 = Math::e / (Math::e + m_Delta);
+  }
+
+  TOutput operator()(double value, CounterBasedRandomStream& stream) const
+  {
+    if(m_Theta == 0.0)
+    {
+      return NoiseClampCast<TOutput>(value);
+    }
+    double xi = 0.0;
+    if(m_Delta > 0.0)
+    {
+      double eta;
+      do
+      {
+        const double v1 = stream.GetVariate();
+        const double v2 = stream.GetVariate();
+        const double v3 = stream.GetVariate();
+        if(v1 <= m_V0)
+        {
+          xi = std::pow(v2, 1.0 / m_Delta);
+          eta = v3 * std::pow(xi, m_Delta - 1.0);
+        }
+        else
+        {
+          xi = 1.0 - std::log(v2);
+          eta = v3 * std::exp(-xi);
+        }
+      } while(eta > std::pow(xi, m_Delta - 1.0) * std::exp(-xi));
+    }
+    double gamma = xi;
+    for(double i = 0.0; i < m_IntegerShape; i++)
+    {
+      gamma -= std::log(stream.GetVariate());
+    }
+    return NoiseClampCast<TOutput>(value * gamma * m_Theta);
+  }
+
+private:
+  double m_Theta;
+  double m_IntegerShape;
+  double m_Delta;
+  double m_V0;
+};
+} // namespace Functor
+
+/** \class CounterBasedNoiseImageFilter
+ * \brief Adds the noise of TNoise (Functor::SaltAndPepperNoise, Functor::ShotNoise or Functor::SpeckleNoise)
+ * to an image, drawing the variates of each value from a Philox4x32 generator keyed on the seed and
+ * counting from the index of the value in the largest possible region.
+ *
+ * The ITK noise filters draw from one generator per thread, so that their output depends on the number of
+ * threads and on how the image is split. Here the noise of a value only depends on the seed and on its
+ * position: the output is the same whatever the threads and the requested regions, so the filter can
+ * also be streamed. The first blocks of the values of a scanline are computed Lanes at a time.
+ *
+ * Each component of a multi-component pixel receives its own noise.
+ */
+template <typename TInputImage, typename TOutputImage, typename TNoise> class CounterBasedNoiseImageFilter : public InPlaceImageFilter<TInputImage, TOutputImage>
+{
+public:
+  typedef CounterBasedNoiseImageFilter Self;
+  typedef InPlaceImageFilter<TInputImage, TOutputImage> Superclass;
+  typedef SmartPointer<Self> Pointer;
+  typedef SmartPointer<const Self> ConstPointer;
+
+  itkNewMacro(Self);
+  itkTypeMacro(CounterBasedNoiseImageFilter, InPlaceImageFilter);
+
+  typedef TInputImage InputImageType;
+  typedef TOutputImage OutputImageType;
+  typedef typename InputImageType::PixelType InputPixelType;
+  typedef typename OutputImageType::PixelType OutputPixelType;
+  typedef typename NumericTraits<InputPixelType>::ValueType InputValueType;
+  typedef typename NumericTraits<OutputPixelType>::ValueType OutputValueType;
+  typedef typename OutputImageType::RegionType OutputImageRegionType;
+  typedef TNoise NoiseType;
+
+  /** Number of first blocks computed at once */
+  static const unsigned int Lanes = 8;
+
+  itkSetMacro(Seed, uint32_t);
+  itkGetConstMacro(Seed, uint32_t);
+
+  /** Noise added to the values, copied by the filter */
+  void SetNoise(const NoiseType& noise)
+  {
+    m_Noise = noise;
+    this->Modified();
+  }
+  const NoiseType& GetNoise() const
+  {
+    return m_Noise;
+  }
+
+protected:
+  CounterBasedNoiseImageFilter()
+  : m_Seed(0)
+  {
+  }
+  ~CounterBasedNoiseImageFilter() override = default;
+
+  void ThreadedGenerateData(const OutputImageRegionType& outputRegionForThread, ThreadIdType threadId) override
+  {
+    const InputImageType* input = this->GetInput();
+    OutputImageType* output = this->GetOutput();
+    if(outputRegionForThread.GetNumberOfPixels() == 0)
+    {
+      return;
+    }
+
+    // Pixels are arrays of values, stored contiguously along a scanline
+    const size_t components = sizeof(InputPixelType) / sizeof(InputValueType);
+    const uint64_t lineLength = outputRegionForThread.GetSize(0) * components;
+    const InputValueType* inputBuffer = reinterpret_cast<const InputValueType*>(input->GetBufferPointer());
+    OutputValueType* outputBuffer = reinterpret_cast<OutputValueType*>(output->GetBufferPointer());
+    const OutputImageRegionType largestRegion = output->GetLargestPossibleRegion();
+    ProgressReporter progress(this, threadId, outputRegionForThread.GetNumberOfPixels() / outputRegionForThread.GetSize(0));
+
+    ImageScanlineIterator<OutputImageType> it(output, outputRegionForThread);
+    while(!it.IsAtEnd())
+    {
+      const typename OutputImageType::IndexType index = it.GetIndex();
+      const InputValueType* in = inputBuffer + input->ComputeOffset(index) * components;
+      OutputValueType* out = outputBuffer + output->ComputeOffset(index) * components;
+
+      // The counter of a value is its position in the largest possible region, not in the buffer
+      uint64_t first = 0;
+      for(unsigned int d = OutputImageType::ImageDimension; d > 0; d--)
+      {
+        first = first * largestRegion.GetSize(d - 1) + static_cast<uint64_t>(index[d - 1] - largestRegion.GetIndex(d - 1));
+      }
+      first *= components;
+
+      for(uint64_t begin = 0; begin < lineLength; begin += Lanes)
+      {
+        uint32_t blocks[4][Lanes];
+        for(unsigned int lane = 0; lane < Lanes; lane++)
+        {
+          const uint64_t value = first + begin + lane;
+          blocks[0][lane] = static_cast<uint32_t>(value);
+          blocks[1][lane] = static_cast<uint32_t>(value >> 32);
+          blocks[2][lane] = 0;
+          blocks[3][lane] = 0;
+        }
+        Philox4x32::Generate(blocks, m_Seed, NoiseType::Key);
+
+        const unsigned int count = static_cast<unsigned int>(std::min<uint64_t>(Lanes, lineLength - begin));
+        for(unsigned int lane = 0; lane < count; lane++)
+        {
+          const uint32_t firstBlock[4] = {blocks[0][lane], blocks[1][lane], blocks[2][lane], blocks[3][lane]};
+          CounterBasedRandomStream stream(first + begin + lane, m_Seed, NoiseType::Key, firstBlock);
+          out[begin + lane] = m_Noise(static_cast<double>(in[begin + lane]), stream);
+        }
+      }
+      it.NextLine();
+      progress.CompletedPixel();
+    }
+  }
+
+private:
+  uint32_t m_Seed;
+  NoiseType m_Noise;
+
+public:
+  CounterBasedNoiseImageFilter(const Self&) = delete;
+  void operator=(const Self&) = delete;
+};
+} // namespace itk
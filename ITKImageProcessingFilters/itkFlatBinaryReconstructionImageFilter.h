@@ -0,0 +1,167 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <itkBinaryReconstructionByDilationImageFilter.h>
+#include <itkBinaryReconstructionByErosionImageFilter.h>
+#include <itkKernelImageFilter.h>
+#include <itkNumericTraits.h>
+#include <itkProgressAccumulator.h>
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkFlatMorphologyImageFilter.h"
+
+namespace itk
+{
+/** \class FlatBinaryReconstructionImageFilter
+ * \brief Binary opening and closing by reconstruction whose erosion or dilation is computed by
+ * itk::FlatMorphologyImageFilter.
+ *
+ * The pipeline is the one of itk::BinaryOpeningByReconstructionImageFilter (binary erosion, then
+ * reconstruction by dilation under the input) and itk::BinaryClosingByReconstructionImageFilter (binary
+ * dilation, then reconstruction by erosion above the input), with the same foreground and background
+ * values, so that the results are identical. The structuring element must be supported by
+ * itk::FlatMorphologyImageFilter::IsSupported().
+ */
+template <typename TImage, typename TKernel> class FlatBinaryReconstructionImageFilter : public KernelImageFilter<TImage, TImage, TKernel>
+{
+public:
+  typedef FlatBinaryReconstructionImageFilter Self;
+  typedef KernelImageFilter<TImage, TImage, TKernel> Superclass;
+  typedef SmartPointer<Self> Pointer;
+  typedef SmartPointer<const Self> ConstPointer;
+
+  itkNewMacro(Self);
+  itkTypeMacro(FlatBinaryReconstructionImageFilter, KernelImageFilter);
+
+  typedef TImage ImageType;
+  typedef TKernel KernelType;
+  typedef typename ImageType::PixelType PixelType;
+  typedef FlatMorphologyImageFilter<ImageType, ImageType, KernelType> FlatFilterType;
+
+  enum class Operation : int
+  {
+    Opening,
+    Closing
+  };
+
+  void SetOperation(Operation operation)
+  {
+    if(m_Operation != operation)
+    {
+      m_Operation = operation;
+      this->Modified();
+    }
+  }
+  Operation GetOperation() const
+  {
+    return m_Operation;
+  }
+
+  itkSetMacro(ForegroundValue, PixelType);
+  itkGetConstMacro(ForegroundValue, PixelType);
+
+  /** Value of the pixels removed by the opening; the closing chooses its own, as the ITK filter */
+  itkSetMacro(BackgroundValue, PixelType);
+  itkGetConstMacro(BackgroundValue, PixelType);
+
+  itkSetMacro(FullyConnected, bool);
+  itkGetConstReferenceMacro(FullyConnected, bool);
+  itkBooleanMacro(FullyConnected);
+
+  /** True if the erosion or dilation of @p kernel can be computed by itk::FlatMorphologyImageFilter */
+  static bool IsSupported(const KernelType& kernel)
+  {
+    return FlatFilterType::IsSupported(kernel);
+  }
+
+protected:
+  FlatBinaryReconstructionImageFilter()
+  : m_Operation(Operation::Opening)
+  , m_ForegroundValue(NumericTraits<PixelType>::max())
+  , m_BackgroundValue(NumericTraits<PixelType>::ZeroValue())
+  , m_FullyConnected(false)
+  {
+  }
+  ~FlatBinaryReconstructionImageFilter() override = default;
+
+  void GenerateInputRequestedRegion() override
+  {
+    Superclass::GenerateInputRequestedRegion();
+    ImageType* input = const_cast<ImageType*>(this->GetInput());
+    if(nullptr != input)
+    {
+      input->SetRequestedRegionToLargestPossibleRegion();
+    }
+  }
+
+  void EnlargeOutputRequestedRegion(DataObject*) override
+  {
+    this->GetOutput()->SetRequestedRegionToLargestPossibleRegion();
+  }
+
+  void GenerateData() override
+  {
+    typename ProgressAccumulator::Pointer progress = ProgressAccumulator::New();
+    progress->SetMiniPipelineFilter(this);
+
+    // Same background as itk::BinaryClosingByReconstructionImageFilter: closing is extensive, the value is
+    // only used by the internal filters
+    PixelType backgroundValue = m_BackgroundValue;
+    if(m_Operation == Operation::Closing)
+    {
+      backgroundValue = NumericTraits<PixelType>::ZeroValue();
+      if(m_ForegroundValue == backgroundValue)
+      {
+        backgroundValue = NumericTraits<PixelType>::max();
+      }
+    }
+
+    // Defaults of itk::BinaryErodeImageFilter and itk::BinaryDilateImageFilter for the outside pixels
+    typename FlatFilterType::Pointer flat = FlatFilterType::New();
+    flat->SetInput(this->GetInput());
+    flat->SetKernel(this->GetKernel());
+    flat->SetOperation(m_Operation == Operation::Opening ? FlatFilterType::Operation::BinaryErode : FlatFilterType::Operation::BinaryDilate);
+    flat->SetBoundaryToForeground(m_Operation == Operation::Opening);
+    flat->SetForegroundValue(static_cast<double>(m_ForegroundValue));
+    flat->SetBackgroundValue(static_cast<double>(backgroundValue));
+    flat->SetNumberOfThreads(this->GetNumberOfThreads());
+    progress->RegisterInternalFilter(flat, 0.5f);
+
+    if(m_Operation == Operation::Opening)
+    {
+      typedef BinaryReconstructionByDilationImageFilter<ImageType> ReconstructionType;
+      Reconstruct<ReconstructionType>(flat, backgroundValue, progress);
+    }
+    else
+    {
+      typedef BinaryReconstructionByErosionImageFilter<ImageType> ReconstructionType;
+      Reconstruct<ReconstructionType>(flat, backgroundValue, progress);
+    }
+  }
+
+private:
+  template <typename TReconstruction> void Reconstruct(FlatFilterType* marker, PixelType backgroundValue, ProgressAccumulator* progress)
+  {
+    typename TReconstruction::Pointer reconstruction = TReconstruction::New();
+    reconstruction->SetMarkerImage(marker->GetOutput());
+    reconstruction->SetMaskImage(this->GetInput());
+    reconstruction->SetForegroundValue(m_ForegroundValue);
+    reconstruction->SetBackgroundValue(backgroundValue);
+    reconstruction->SetFullyConnected(m_FullyConnected);
+    reconstruction->SetNumberOfThreads(this->GetNumberOfThreads());
+    progress->RegisterInternalFilter(reconstruction, 0.5f);
+    reconstruction->GraftOutput(this->GetOutput());
+    reconstruction->Update();
+    this->GraftOutput(reconstruction->GetOutput());
+  }
+
+  Operation m_Operation;
+  PixelType m_ForegroundValue;
+  PixelType m_BackgroundValue;
+  bool m_FullyConnected;
+
+  ITK_DISALLOW_COPY_AND_ASSIGN(FlatBinaryReconstructionImageFilter);
+};
+} // end namespace itk
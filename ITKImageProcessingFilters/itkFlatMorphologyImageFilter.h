@@ -0,0 +1,730 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <itkKernelImageFilter.h>
+#include <itkNumericTraits.h>
+#include <itkProgressReporter.h>
+
+namespace itk
+{
+/** \class FlatMorphologyImageFilter
+ * \brief Grayscale morphology with flat structuring elements decomposed into line segments.
+ *
+ * The dilation (maximum) or erosion (minimum) over a segment of w pixels is computed with the van Herk /
+ * Gil-Werman algorithm, in three comparisons per pixel whatever w. The structuring element is then applied
+ * as a combination of segments, chosen from its shape:
+ * - a box is the succession of a segment along each axis (separable);
+ * - a cross is the union of a segment along each axis: the maximum (minimum) of the three results;
+ * - any other element whose rows along X are contiguous, such as a ball, is the union of these rows: each
+ *   distinct row is applied to a slice once, and its results are combined for each row of the element.
+ * Elements with holes in their rows (annulus) are not decomposable.
+ *
+ * Pixels outside the image are ignored, as the boundary conditions of the ITK morphology filters, and the
+ * opening, closing and top-hats pad the image as their SafeBorder option, so that the results are identical
+ * to those of itk::GrayscaleDilateImageFilter, itk::GrayscaleErodeImageFilter,
+ * itk::GrayscaleMorphologicalOpeningImageFilter, itk::GrayscaleMorphologicalClosingImageFilter,
+ * itk::WhiteTopHatImageFilter, itk::BlackTopHatImageFilter and itk::MorphologicalGradientImageFilter.
+ *
+ * The binary dilation and erosion threshold the input at ForegroundValue and dilate or erode the foreground
+ * as a 0/1 image. As itk::BinaryDilateImageFilter and itk::BinaryErodeImageFilter, the dilated pixels are set
+ * to ForegroundValue, the eroded ones to BackgroundValue, the others keep their value, and the pixels outside
+ * the image are foreground with BoundaryToForeground.
+ *
+ * Each thread copies its region, padded by the radius of the element (twice the radius for the openings and
+ * closings) within the image, line by line in a buffer of its own. Since the threads get whole slices (rows
+ * in 2D), the halo read by each thread is only along the split axis. Only scalar pixels are supported, see
+ * IsSupported().
+ */
+template <typename TInputImage, typename TOutputImage, typename TKernel> class FlatMorphologyImageFilter : public KernelImageFilter<TInputImage, TOutputImage, TKernel>
+{
+public:
+  typedef FlatMorphologyImageFilter Self;
+  typedef KernelImageFilter<TInputImage, TOutputImage, TKernel> Superclass;
+  typedef SmartPointer<Self> Pointer;
+  typedef SmartPointer<const Self> ConstPointer;
+
+  itkNewMacro(Self);
+  itkTypeMacro(FlatMorphologyImageFilter, KernelImageFilter);
+
+  typedef TInputImage InputImageType;
+  typedef TOutputImage OutputImageType;
+  typedef TKernel KernelType;
+  typedef typename InputImageType::PixelType InputPixelType;
+  typedef typename OutputImageType::PixelType OutputPixelType;
+  typedef typename OutputImageType::RegionType OutputImageRegionType;
+  typedef typename Superclass::RadiusType RadiusType;
+
+  enum class Operation : int
+  {
+    Dilate,
+    Erode,
+    Opening,
+    Closing,
+    WhiteTopHat,
+    BlackTopHat,
+    Gradient,
+    BinaryDilate,
+    BinaryErode
+  };
+
+  void SetOperation(Operation operation)
+  {
+    if(m_Operation != operation)
+    {
+      m_Operation = operation;
+      this->Modified();
+    }
+  }
+  Operation GetOperation() const
+  {
+    return m_Operation;
+  }
+
+  /** Pad the image before the opening or closing, as the SafeBorder option of the ITK filters */
+  itkSetMacro(SafeBorder, bool);
+  itkGetConstReferenceMacro(SafeBorder, bool);
+  itkBooleanMacro(SafeBorder);
+
+  /** Value dilated or eroded by the binary operations */
+  itkSetMacro(ForegroundValue, double);
+  itkGetConstMacro(ForegroundValue, double);
+
+  /** Value of the pixels eroded by BinaryErode */
+  itkSetMacro(BackgroundValue, double);
+  itkGetConstMacro(BackgroundValue, double);
+
+  /** Consider the pixels outside the image as foreground in the binary operations */
+  itkSetMacro(BoundaryToForeground, bool);
+  itkGetConstReferenceMacro(BoundaryToForeground, bool);
+  itkBooleanMacro(BoundaryToForeground);
+
+  /** Returns true if the pixels are scalars and each row of @p kernel along X is a single segment */
+  static bool IsSupported(const KernelType& kernel)
+  {
+    return std::is_arithmetic<InputPixelType>::value && Decompose(kernel).kind != Decomposition::Kind::None;
+  }
+
+protected:
+  FlatMorphologyImageFilter()
+  : m_Operation(Operation::Dilate)
+  , m_SafeBorder(true)
+  , m_ForegroundValue(1.0)
+  , m_BackgroundValue(0.0)
+  , m_BoundaryToForeground(false)
+  {
+  }
+  ~FlatMorphologyImageFilter() override = default;
+
+  void GenerateInputRequestedRegion() override
+  {
+    ImageToImageFilter<TInputImage, TOutputImage>::GenerateInputRequestedRegion();
+    InputImageType* input = const_cast<InputImageType*>(this->GetInput());
+    if(nullptr == input)
+    {
+      return;
+    }
+    RadiusType radius = this->GetRadius();
+    for(unsigned int d = 0; d < InputImageType::ImageDimension; d++)
+    {
+      radius[d] *= NumberOfPasses();
+    }
+    typename InputImageType::RegionType region = this->GetOutput()->GetRequestedRegion();
+    region.PadByRadius(radius);
+    region.Crop(input->GetLargestPossibleRegion());
+    input->SetRequestedRegion(region);
+  }
+
+  void BeforeThreadedGenerateData() override
+  {
+    if(!IsSupported(this->GetKernel()))
+    {
+      itkExceptionMacro(<< "The structuring element can not be decomposed in segments or the pixels are not scalars");
+    }
+    m_Decomposition = Decompose(this->GetKernel());
+  }
+
+  void ThreadedGenerateData(const OutputImageRegionType& outputRegionForThread, ThreadIdType threadId) override
+  {
+    const InputImageType* input = this->GetInput();
+    OutputImageType* output = this->GetOutput();
+    if(outputRegionForThread.GetNumberOfPixels() == 0)
+    {
+      return;
+    }
+    ProgressReporter progress(this, threadId, 1);
+
+    // The region of the thread padded by the radius of each pass, in a buffer X fastest, whose missing
+    // dimensions of 2D images are a single pixel. The pixels outside the image are neutral for a single
+    // operation, so the padding stops at the border of the image (the threads get whole slices or rows, the
+    // padding is then only along the split axis). With SafeBorder, the second operation of an opening or
+    // closing reads the result of the first one up to one radius outside the image, and the binary operations
+    // read the outside pixels when they are not neutral.
+    const unsigned int dimension = InputImageType::ImageDimension;
+    const typename InputImageType::RegionType& largest = input->GetLargestPossibleRegion();
+    const typename InputImageType::RegionType& buffered = input->GetBufferedRegion();
+    const long passes = static_cast<long>(NumberOfPasses());
+    const bool binaryBorder = (m_Operation == Operation::BinaryDilate && m_BoundaryToForeground) || (m_Operation == Operation::BinaryErode && !m_BoundaryToForeground);
+    const long border = ((passes == 2 && m_SafeBorder) || binaryBorder) ? 1 : 0;
+    Box box;
+    long bufferStart[3] = {0, 0, 0};
+    long bufferEnd[3] = {1, 1, 1};
+    for(unsigned int d = 0; d < dimension; d++)
+    {
+      const long r = m_Decomposition.radius[d];
+      const long start = std::max(outputRegionForThread.GetIndex(d) - passes * r, largest.GetIndex(d) - border * r);
+      const long end = std::min(outputRegionForThread.GetIndex(d) + static_cast<long>(outputRegionForThread.GetSize(d)) + passes * r,
+                                largest.GetIndex(d) + static_cast<long>(largest.GetSize(d)) + border * r);
+      box.start[d] = start;
+      box.size[d] = end - start;
+      bufferStart[d] = buffered.GetIndex(d);
+      bufferEnd[d] = bufferStart[d] + static_cast<long>(buffered.GetSize(d));
+    }
+    const size_t count = static_cast<size_t>(box.size[0] * box.size[1] * box.size[2]);
+    const size_t inputStride[3] = {1, static_cast<size_t>(bufferEnd[0] - bufferStart[0]), static_cast<size_t>((bufferEnd[0] - bufferStart[0]) * (bufferEnd[1] - bufferStart[1]))};
+    const InputPixelType* inputBuffer = input->GetBufferPointer();
+    // Copies the box line by line from the buffer of the input, the pixels outside being @p outside
+    auto fill = [&](std::vector<InputPixelType>& values, InputPixelType outside) {
+      values.assign(count, outside);
+      const long x0 = std::max(box.start[0], bufferStart[0]);
+      const long x1 = std::min(box.start[0] + box.size[0], bufferEnd[0]);
+      if(x0 >= x1)
+      {
+        return;
+      }
+      for(long z = std::max(box.start[2], bufferStart[2]); z < std::min(box.start[2] + box.size[2], bufferEnd[2]); z++)
+      {
+        for(long y = std::max(box.start[1], bufferStart[1]); y < std::min(box.start[1] + box.size[1], bufferEnd[1]); y++)
+        {
+          const InputPixelType* line = inputBuffer + static_cast<size_t>(z - bufferStart[2]) * inputStride[2] + static_cast<size_t>(y - bufferStart[1]) * inputStride[1] +
+                                       static_cast<size_t>(x0 - bufferStart[0]);
+          InputPixelType* out = values.data() + static_cast<size_t>(((z - box.start[2]) * box.size[1] + y - box.start[1]) * box.size[0] + x0 - box.start[0]);
+          std::copy(line, line + (x1 - x0), out);
+        }
+      }
+    };
+    // Thresholds the input at the foreground value: 1 for the foreground, 0 elsewhere
+    auto fillBinary = [&](std::vector<InputPixelType>& values) {
+      const InputPixelType one = Indicator(true);
+      const InputPixelType zero = Indicator(false);
+      values.assign(count, m_BoundaryToForeground ? one : zero);
+      const long x0 = std::max(box.start[0], bufferStart[0]);
+      const long x1 = std::min(box.start[0] + box.size[0], bufferEnd[0]);
+      if(x0 >= x1)
+      {
+        return;
+      }
+      for(long z = std::max(box.start[2], bufferStart[2]); z < std::min(box.start[2] + box.size[2], bufferEnd[2]); z++)
+      {
+        for(long y = std::max(box.start[1], bufferStart[1]); y < std::min(box.start[1] + box.size[1], bufferEnd[1]); y++)
+        {
+          const InputPixelType* line = inputBuffer + static_cast<size_t>(z - bufferStart[2]) * inputStride[2] + static_cast<size_t>(y - bufferStart[1]) * inputStride[1] +
+                                       static_cast<size_t>(x0 - bufferStart[0]);
+          InputPixelType* out = values.data() + static_cast<size_t>(((z - box.start[2]) * box.size[1] + y - box.start[1]) * box.size[0] + x0 - box.start[0]);
+          for(long x = 0; x < x1 - x0; x++)
+          {
+            out[x] = IsForeground(line[x]) ? one : zero;
+          }
+        }
+      }
+    };
+
+    std::vector<InputPixelType> first;
+    std::vector<InputPixelType> second;
+    switch(m_Operation)
+    {
+    case Operation::Dilate:
+      fill(first, Maximum::Neutral());
+      Apply<Maximum>(first, box);
+      break;
+    case Operation::Erode:
+      fill(first, Minimum::Neutral());
+      Apply<Minimum>(first, box);
+      break;
+    case Operation::Opening:
+    case Operation::WhiteTopHat:
+      fill(first, Minimum::Neutral());
+      Apply<Minimum>(first, box);
+      Apply<Maximum>(first, box);
+      break;
+    case Operation::Closing:
+    case Operation::BlackTopHat:
+      fill(first, Maximum::Neutral());
+      Apply<Maximum>(first, box);
+      Apply<Minimum>(first, box);
+      break;
+    case Operation::Gradient:
+      fill(first, Maximum::Neutral());
+      Apply<Maximum>(first, box);
+      fill(second, Minimum::Neutral());
+      Apply<Minimum>(second, box);
+      break;
+    case Operation::BinaryDilate:
+      fillBinary(first);
+      Apply<Maximum>(first, box);
+      break;
+    case Operation::BinaryErode:
+      fillBinary(first);
+      Apply<Minimum>(first, box);
+      break;
+    }
+
+    // The result is written line by line in the buffer of the output
+    long size[3] = {1, 1, 1};
+    long offset[3] = {0, 0, 0};
+    for(unsigned int d = 0; d < dimension; d++)
+    {
+      size[d] = static_cast<long>(outputRegionForThread.GetSize(d));
+      offset[d] = outputRegionForThread.GetIndex(d) - box.start[d];
+    }
+    typename OutputImageType::IndexType index = outputRegionForThread.GetIndex();
+    for(long z = 0; z < size[2]; z++)
+    {
+      for(long y = 0; y < size[1]; y++)
+      {
+        const long c[3] = {0, y, z};
+        for(unsigned int d = 1; d < dimension; d++)
+        {
+          index[d] = outputRegionForThread.GetIndex(d) + c[d];
+        }
+        const size_t row = static_cast<size_t>(((z + offset[2]) * box.size[1] + y + offset[1]) * box.size[0] + offset[0]);
+        const InputPixelType* result = first.data() + row;
+        const InputPixelType* source = inputBuffer + input->ComputeOffset(index);
+        OutputPixelType* out = output->GetBufferPointer() + output->ComputeOffset(index);
+        switch(m_Operation)
+        {
+        case Operation::WhiteTopHat:
+          for(long x = 0; x < size[0]; x++)
+          {
+            out[x] = Difference(source[x], result[x]);
+          }
+          break;
+        case Operation::BlackTopHat:
+          for(long x = 0; x < size[0]; x++)
+          {
+            out[x] = Difference(result[x], source[x]);
+          }
+          break;
+        case Operation::Gradient:
+          for(long x = 0; x < size[0]; x++)
+          {
+            out[x] = Difference(result[x], second[row + static_cast<size_t>(x)]);
+          }
+          break;
+        case Operation::BinaryDilate:
+        {
+          const OutputPixelType foreground = ToOutput(m_ForegroundValue, std::is_arithmetic<OutputPixelType>());
+          for(long x = 0; x < size[0]; x++)
+          {
+            out[x] = (result[x] == Indicator(true)) ? foreground : static_cast<OutputPixelType>(source[x]);
+          }
+          break;
+        }
+        case Operation::BinaryErode:
+        {
+          const OutputPixelType background = ToOutput(m_BackgroundValue, std::is_arithmetic<OutputPixelType>());
+          for(long x = 0; x < size[0]; x++)
+          {
+            out[x] = (result[x] == Indicator(false) && IsForeground(source[x])) ? background : static_cast<OutputPixelType>(source[x]);
+          }
+          break;
+        }
+        default:
+          for(long x = 0; x < size[0]; x++)
+          {
+            out[x] = static_cast<OutputPixelType>(result[x]);
+          }
+          break;
+        }
+      }
+    }
+    progress.CompletedPixel();
+  }
+
+private:
+  // The comparisons are only compiled for scalar pixels, the only ones IsSupported() accepts
+  static bool Less(const InputPixelType& a, const InputPixelType& b)
+  {
+    return Less(a, b, std::is_arithmetic<InputPixelType>());
+  }
+  static bool Less(const InputPixelType& a, const InputPixelType& b, std::true_type)
+  {
+    return a < b;
+  }
+  static bool Less(const InputPixelType&, const InputPixelType&, std::false_type)
+  {
+    return false;
+  }
+  static InputPixelType Lowest(std::true_type)
+  {
+    return NumericTraits<InputPixelType>::NonpositiveMin();
+  }
+  static InputPixelType Highest(std::true_type)
+  {
+    return NumericTraits<InputPixelType>::max();
+  }
+  static InputPixelType Lowest(std::false_type)
+  {
+    return InputPixelType();
+  }
+  static InputPixelType Highest(std::false_type)
+  {
+    return InputPixelType();
+  }
+  static OutputPixelType Difference(const InputPixelType& a, const InputPixelType& b)
+  {
+    return Difference(a, b, std::is_arithmetic<InputPixelType>());
+  }
+  static OutputPixelType Difference(const InputPixelType& a, const InputPixelType& b, std::true_type)
+  {
+    return static_cast<OutputPixelType>(a - b);
+  }
+  static OutputPixelType Difference(const InputPixelType& a, const InputPixelType&, std::false_type)
+  {
+    return static_cast<OutputPixelType>(a);
+  }
+
+  bool IsForeground(const InputPixelType& value) const
+  {
+    return IsForeground(value, std::is_arithmetic<InputPixelType>());
+  }
+  bool IsForeground(const InputPixelType& value, std::true_type) const
+  {
+    return static_cast<double>(value) == m_ForegroundValue;
+  }
+  bool IsForeground(const InputPixelType&, std::false_type) const
+  {
+    return false;
+  }
+  static InputPixelType Indicator(bool set)
+  {
+    return Indicator(set, std::is_arithmetic<InputPixelType>());
+  }
+  static InputPixelType Indicator(bool set, std::true_type)
+  {
+    return static_cast<InputPixelType>(set ? 1 : 0);
+  }
+  static InputPixelType Indicator(bool, std::false_type)
+  {
+    return InputPixelType();
+  }
+  static OutputPixelType ToOutput(double value, std::true_type)
+  {
+    return static_cast<OutputPixelType>(value);
+  }
+  static OutputPixelType ToOutput(double, std::false_type)
+  {
+    return OutputPixelType();
+  }
+
+  struct Maximum
+  {
+    static InputPixelType Neutral()
+    {
+      return Lowest(std::is_arithmetic<InputPixelType>());
+    }
+    static InputPixelType Select(const InputPixelType& a, const InputPixelType& b)
+    {
+      return Less(a, b) ? b : a;
+    }
+  };
+
+  struct Minimum
+  {
+    static InputPixelType Neutral()
+    {
+      return Highest(std::is_arithmetic<InputPixelType>());
+    }
+    static InputPixelType Select(const InputPixelType& a, const InputPixelType& b)
+    {
+      return Less(b, a) ? b : a;
+    }
+  };
+
+  /** Region of a buffer, 3D */
+  struct Box
+  {
+    long start[3] = {0, 0, 0};
+    long size[3] = {1, 1, 1};
+  };
+
+  /** Row of the structuring element: offsets lo to hi along X, at dy along Y */
+  struct Row
+  {
+    long dy;
+    size_t segment;
+  };
+
+  struct Decomposition
+  {
+    enum class Kind
+    {
+      None,
+      Box,
+      Cross,
+      Rows
+    };
+    Kind kind = Kind::None;
+    long radius[3] = {0, 0, 0};
+    /** Rows: distinct segments [lo, hi] along X and the rows of each slice of the element (dz = index - radius[2]) */
+    std::vector<std::pair<long, long>> segments;
+    std::vector<std::vector<Row>> slices;
+  };
+
+  static unsigned int NumberOfPassesFor(Operation operation)
+  {
+    return (operation == Operation::Opening || operation == Operation::Closing || operation == Operation::WhiteTopHat || operation == Operation::BlackTopHat) ? 2 : 1;
+  }
+
+  unsigned int NumberOfPasses() const
+  {
+    return NumberOfPassesFor(m_Operation);
+  }
+
+  static Decomposition Decompose(const KernelType& kernel)
+  {
+    Decomposition decomposition;
+    const unsigned int dimension = KernelType::NeighborhoodDimension;
+    if(dimension > 3)
+    {
+      return decomposition;
+    }
+    for(unsigned int d = 0; d < dimension; d++)
+    {
+      decomposition.radius[d] = static_cast<long>(kernel.GetRadius(d));
+    }
+    const long* r = decomposition.radius;
+    const long sx = 2 * r[0] + 1;
+    const long sy = 2 * r[1] + 1;
+    const long sz = 2 * r[2] + 1;
+    std::vector<char> mask(static_cast<size_t>(sx * sy * sz), 0);
+    for(unsigned int i = 0; i < kernel.Size(); i++)
+    {
+      if(!kernel[i])
+      {
+        continue;
+      }
+      const typename KernelType::OffsetType o = kernel.GetOffset(i);
+      long c[3] = {0, 0, 0};
+      for(unsigned int d = 0; d < dimension; d++)
+      {
+        c[d] = o[d];
+      }
+      mask[static_cast<size_t>(((c[2] + r[2]) * sy + c[1] + r[1]) * sx + c[0] + r[0])] = 1;
+    }
+    auto at = [&](long x, long y, long z) { return mask[static_cast<size_t>(((z + r[2]) * sy + y + r[1]) * sx + x + r[0])] != 0; };
+
+    bool box = true;
+    bool cross = true;
+    for(long z = -r[2]; z <= r[2]; z++)
+    {
+      for(long y = -r[1]; y <= r[1]; y++)
+      {
+        for(long x = -r[0]; x <= r[0]; x++)
+        {
+          const int axes = (x != 0 ? 1 : 0) + (y != 0 ? 1 : 0) + (z != 0 ? 1 : 0);
+          box = box && at(x, y, z);
+          cross = cross && (at(x, y, z) == (axes <= 1));
+        }
+      }
+    }
+    if(box)
+    {
+      decomposition.kind = Decomposition::Kind::Box;
+      return decomposition;
+    }
+    if(cross)
+    {
+      decomposition.kind = Decomposition::Kind::Cross;
+      return decomposition;
+    }
+
+    decomposition.slices.resize(static_cast<size_t>(sz));
+    for(long z = -r[2]; z <= r[2]; z++)
+    {
+      for(long y = -r[1]; y <= r[1]; y++)
+      {
+        long lo = r[0] + 1;
+        long hi = -r[0] - 1;
+        long count = 0;
+        for(long x = -r[0]; x <= r[0]; x++)
+        {
+          if(at(x, y, z))
+          {
+            lo = std::min(lo, x);
+            hi = std::max(hi, x);
+            count++;
+          }
+        }
+        if(count == 0)
+        {
+          continue;
+        }
+        if(count != hi - lo + 1)
+        {
+          decomposition.kind = Decomposition::Kind::None;
+          return decomposition;
+        }
+        const std::pair<long, long> segment(lo, hi);
+        size_t s = std::find(decomposition.segments.begin(), decomposition.segments.end(), segment) - decomposition.segments.begin();
+        if(s == decomposition.segments.size())
+        {
+          decomposition.segments.push_back(segment);
+        }
+        decomposition.slices[static_cast<size_t>(z + r[2])].push_back(Row{y, s});
+      }
+    }
+    decomposition.kind = Decomposition::Kind::Rows;
+    return decomposition;
+  }
+
+  /**
+   * Writes at out[i * outStride] the selection of in[(i + lo) * inStride] to in[(i + hi) * inStride], for i
+   * in [0, n), values out of [0, n) being neutral (van Herk / Gil-Werman). out may be in.
+   */
+  template <typename TSelect>
+  static void Segment(const InputPixelType* in, size_t inStride, InputPixelType* out, size_t outStride, long n, long lo, long hi, std::vector<InputPixelType>& forward,
+                      std::vector<InputPixelType>& backward)
+  {
+    const long w = hi - lo + 1;
+    const long m = n + w - 1;
+    forward.resize(static_cast<size_t>(m));
+    backward.resize(static_cast<size_t>(m));
+    // Index e of the extended line is the pixel e + lo; blocks of w pixels start at e = 0
+    for(long e = 0, k = 0; e < m; e++, k = (k + 1 == w) ? 0 : k + 1)
+    {
+      const long j = e + lo;
+      const InputPixelType value = (j >= 0 && j < n) ? in[static_cast<size_t>(j) * inStride] : TSelect::Neutral();
+      forward[e] = (k == 0) ? value : TSelect::Select(forward[e - 1], value);
+    }
+    for(long e = m - 1; e >= 0; e--)
+    {
+      const long j = e + lo;
+      const InputPixelType value = (j >= 0 && j < n) ? in[static_cast<size_t>(j) * inStride] : TSelect::Neutral();
+      backward[e] = (e == m - 1 || e % w == w - 1) ? value : TSelect::Select(backward[e + 1], value);
+    }
+    for(long i = 0; i < n; i++)
+    {
+      out[static_cast<size_t>(i) * outStride] = TSelect::Select(backward[i], forward[i + w - 1]);
+    }
+  }
+
+  /** Applies segment [lo, hi] along @p axis to all the lines of @p values, in place */
+  template <typename TSelect> static void Pass(std::vector<InputPixelType>& values, const Box& box, int axis, long lo, long hi, std::vector<InputPixelType>& forward, std::vector<InputPixelType>& backward)
+  {
+    if(lo == 0 && hi == 0)
+    {
+      return;
+    }
+    const size_t stride[3] = {1, static_cast<size_t>(box.size[0]), static_cast<size_t>(box.size[0] * box.size[1])};
+    const int b = (axis == 0) ? 1 : 0;
+    const int c = (axis == 2) ? 1 : 2;
+    for(long j = 0; j < box.size[c]; j++)
+    {
+      for(long i = 0; i < box.size[b]; i++)
+      {
+        InputPixelType* line = values.data() + static_cast<size_t>(i) * stride[b] + static_cast<size_t>(j) * stride[c];
+        Segment<TSelect>(line, stride[axis], line, stride[axis], box.size[axis], lo, hi, forward, backward);
+      }
+    }
+  }
+
+  /** Replaces @p values by their dilation (TSelect = Maximum) or erosion (Minimum) */
+  template <typename TSelect> void Apply(std::vector<InputPixelType>& values, const Box& box) const
+  {
+    const long* r = m_Decomposition.radius;
+    std::vector<InputPixelType> forward;
+    std::vector<InputPixelType> backward;
+    switch(m_Decomposition.kind)
+    {
+    case Decomposition::Kind::Box:
+      for(int axis = 0; axis < 3; axis++)
+      {
+        Pass<TSelect>(values, box, axis, -r[axis], r[axis], forward, backward);
+      }
+      break;
+    case Decomposition::Kind::Cross:
+    {
+      const std::vector<InputPixelType> source(values);
+      Pass<TSelect>(values, box, 0, -r[0], r[0], forward, backward);
+      for(int axis = 1; axis < 3; axis++)
+      {
+        std::vector<InputPixelType> line(source);
+        Pass<TSelect>(line, box, axis, -r[axis], r[axis], forward, backward);
+        for(size_t i = 0; i < values.size(); i++)
+        {
+          values[i] = TSelect::Select(values[i], line[i]);
+        }
+      }
+      break;
+    }
+    case Decomposition::Kind::Rows:
+    {
+      // Each slice of the result combines the rows of the slices of the element, the segments of a source
+      // slice being computed once per slice of the element
+      const size_t sliceSize = static_cast<size_t>(box.size[0] * box.size[1]);
+      const std::vector<InputPixelType> source(values);
+      std::vector<InputPixelType> segments(m_Decomposition.segments.size() * sliceSize);
+      std::vector<char> computed(m_Decomposition.segments.size());
+      for(long z = 0; z < box.size[2]; z++)
+      {
+        InputPixelType* slice = values.data() + static_cast<size_t>(z) * sliceSize;
+        std::fill(slice, slice + sliceSize, TSelect::Neutral());
+        for(long dz = -r[2]; dz <= r[2]; dz++)
+        {
+          const long zz = z + dz;
+          if(zz < 0 || zz >= box.size[2])
+          {
+            continue;
+          }
+          const InputPixelType* sourceSlice = source.data() + static_cast<size_t>(zz) * sliceSize;
+          std::fill(computed.begin(), computed.end(), 0);
+          for(const Row& row : m_Decomposition.slices[static_cast<size_t>(dz + r[2])])
+          {
+            InputPixelType* segment = segments.data() + row.segment * sliceSize;
+            if(!computed[row.segment])
+            {
+              const std::pair<long, long>& s = m_Decomposition.segments[row.segment];
+              for(long y = 0; y < box.size[1]; y++)
+              {
+                const size_t o = static_cast<size_t>(y * box.size[0]);
+                Segment<TSelect>(sourceSlice + o, 1, segment + o, 1, box.size[0], s.first, s.second, forward, backward);
+              }
+              computed[row.segment] = 1;
+            }
+            for(long y = std::max(0L, -row.dy); y < std::min(box.size[1], box.size[1] - row.dy); y++)
+            {
+              InputPixelType* out = slice + static_cast<size_t>(y * box.size[0]);
+              const InputPixelType* in = segment + static_cast<size_t>((y + row.dy) * box.size[0]);
+              for(long x = 0; x < box.size[0]; x++)
+              {
+                out[x] = TSelect::Select(out[x], in[x]);
+              }
+            }
+          }
+        }
+      }
+      break;
+    }
+    case Decomposition::Kind::None:
+      break;
+    }
+  }
+
+  Operation m_Operation;
+  bool m_SafeBorder;
+  double m_ForegroundValue;
+  double m_BackgroundValue;
+  bool m_BoundaryToForeground;
+  Decomposition m_Decomposition;
+
+  ITK_DISALLOW_COPY_AND_ASSIGN(FlatMorphologyImageFilter);
+};
+} // end namespace itk
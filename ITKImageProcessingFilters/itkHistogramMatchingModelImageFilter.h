@@ -0,0 +1,401 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <itkHistogram.h>
+#include <itkImageIOBase.h>
+#include <itkImageRegionConstIterator.h>
+#include <itkImageScanlineIterator.h>
+#include <itkImageToImageFilter.h>
+#include <itkNumericTraits.h>
+#include <itkProgressReporter.h>
+
+namespace itk
+{
+/** \class HistogramMatchingModelImageFilter
+ * \brief Histogram matching of itk::HistogramMatchingImageFilter, the reference image being replaced by a
+ * model of its histogram computed once with ComputeModel().
+ *
+ * The model starts with a header recording how it was computed: NumberOfHistogramLevels, NumberOfMatchPoints,
+ * ThresholdAtMeanIntensity and the component type of the pixels (itk::ImageIOBase::IOComponentType). It then
+ * holds the minimum of the reference image followed by the NumberOfMatchPoints + 2 intensities it is matched
+ * at: the intensity threshold (the mean with ThresholdAtMeanIntensity, the minimum otherwise), the quantiles
+ * of its histogram and its maximum. A model is only applied with the parameters and pixel type of its header. The source quantiles and the piecewise linear mapping are
+ * computed as by the ITK filter, so that the output pixels are the same.
+ *
+ * For 8 and 16 bit integer pixels, the source histogram is built from the count of each value and the
+ * mapping is tabulated for every value: the filter then reads the source twice, once to count the values and
+ * once through the lookup table.
+ */
+template <typename TInputImage, typename TOutputImage, typename THistogramMeasurement = typename TInputImage::PixelType>
+class HistogramMatchingModelImageFilter : public ImageToImageFilter<TInputImage, TOutputImage>
+{
+public:
+  typedef HistogramMatchingModelImageFilter Self;
+  typedef ImageToImageFilter<TInputImage, TOutputImage> Superclass;
+  typedef SmartPointer<Self> Pointer;
+  typedef SmartPointer<const Self> ConstPointer;
+
+  itkNewMacro(Self);
+  itkTypeMacro(HistogramMatchingModelImageFilter, ImageToImageFilter);
+
+  typedef TInputImage InputImageType;
+  typedef TOutputImage OutputImageType;
+  typedef typename InputImageType::PixelType InputPixelType;
+  typedef typename OutputImageType::PixelType OutputPixelType;
+  typedef typename OutputImageType::RegionType OutputImageRegionType;
+  typedef Statistics::Histogram<THistogramMeasurement> HistogramType;
+  typedef std::vector<double> ModelType;
+
+  /** Values of 8 and 16 bit integer pixels are mapped through a lookup table */
+  typedef std::integral_constant<bool, NumericTraits<InputPixelType>::is_integer && sizeof(InputPixelType) <= 2> UseLookupTable;
+
+  itkSetMacro(NumberOfHistogramLevels, SizeValueType);
+  itkGetConstMacro(NumberOfHistogramLevels, SizeValueType);
+
+  itkSetMacro(NumberOfMatchPoints, SizeValueType);
+  itkGetConstMacro(NumberOfMatchPoints, SizeValueType);
+
+  itkSetMacro(ThresholdAtMeanIntensity, bool);
+  itkGetConstMacro(ThresholdAtMeanIntensity, bool);
+  itkBooleanMacro(ThresholdAtMeanIntensity);
+
+  /** Model of the reference image, of GetModelSize(NumberOfMatchPoints) values */
+  void SetReferenceModel(const ModelType& model)
+  {
+    m_ReferenceModel = model;
+    this->Modified();
+  }
+  const ModelType& GetReferenceModel() const
+  {
+    return m_ReferenceModel;
+  }
+
+  /** Number of values of the header of a model */
+  static SizeValueType GetModelHeaderSize()
+  {
+    return 4;
+  }
+
+  /** Number of values of a model: its header, the minimum and the NumberOfMatchPoints + 2 intensities */
+  static SizeValueType GetModelSize(SizeValueType numberOfMatchPoints)
+  {
+    return GetModelHeaderSize() + numberOfMatchPoints + 3;
+  }
+
+  /** Returns the model of @p reference, to match images with the same parameters */
+  static ModelType ComputeModel(const InputImageType* reference, SizeValueType numberOfHistogramLevels, SizeValueType numberOfMatchPoints, bool thresholdAtMeanIntensity)
+  {
+    double minimum = 0.0;
+    ModelType quantiles;
+    ComputeQuantiles(reference, numberOfHistogramLevels, numberOfMatchPoints, thresholdAtMeanIntensity, minimum, quantiles, UseLookupTable());
+    ModelType model = ModelHeader(numberOfHistogramLevels, numberOfMatchPoints, thresholdAtMeanIntensity);
+    model.push_back(minimum);
+    model.insert(model.end(), quantiles.begin(), quantiles.end());
+    return model;
+  }
+
+  /** Returns an empty string if the @p size values of @p model were computed with these parameters from
+   * pixels of the type of the input, the mismatch otherwise */
+  static std::string CheckModel(const double* model, size_t size, SizeValueType numberOfHistogramLevels, SizeValueType numberOfMatchPoints, bool thresholdAtMeanIntensity)
+  {
+    std::ostringstream message;
+    if(size != GetModelSize(numberOfMatchPoints))
+    {
+      message << "The reference model has " << size << " values instead of " << GetModelSize(numberOfMatchPoints);
+      return message.str();
+    }
+    const ModelType expected = ModelHeader(numberOfHistogramLevels, numberOfMatchPoints, thresholdAtMeanIntensity);
+    const char* names[] = {"NumberOfHistogramLevels", "NumberOfMatchPoints", "ThresholdAtMeanIntensity", "pixel component type"};
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+      if(model[i] != expected[i])
+      {
+        message << "The reference model was computed with " << names[i] << " " << model[i] << " instead of " << expected[i];
+        return message.str();
+      }
+    }
+    return message.str();
+  }
+
+protected:
+  HistogramMatchingModelImageFilter()
+  : m_NumberOfHistogramLevels(256)
+  , m_NumberOfMatchPoints(1)
+  , m_ThresholdAtMeanIntensity(true)
+  , m_LowerGradient(0.0)
+  , m_UpperGradient(0.0)
+  {
+  }
+  ~HistogramMatchingModelImageFilter() override = default;
+
+  void GenerateInputRequestedRegion() override
+  {
+    Superclass::GenerateInputRequestedRegion();
+    InputImageType* input = const_cast<InputImageType*>(this->GetInput());
+    if(nullptr != input)
+    {
+      input->SetRequestedRegionToLargestPossibleRegion();
+    }
+  }
+
+  void BeforeThreadedGenerateData() override
+  {
+    const SizeValueType points = m_NumberOfMatchPoints + 2;
+    const std::string mismatch = CheckModel(m_ReferenceModel.data(), m_ReferenceModel.size(), m_NumberOfHistogramLevels, m_NumberOfMatchPoints, m_ThresholdAtMeanIntensity);
+    if(!mismatch.empty())
+    {
+      itkExceptionMacro(<< mismatch);
+    }
+    double sourceMinimum = 0.0;
+    ComputeQuantiles(this->GetInput(), m_NumberOfHistogramLevels, m_NumberOfMatchPoints, m_ThresholdAtMeanIntensity, sourceMinimum, m_SourceQuantiles, UseLookupTable());
+    const double referenceMinimum = m_ReferenceModel[GetModelHeaderSize()];
+    const double* reference = &m_ReferenceModel[GetModelHeaderSize() + 1];
+
+    // Same gradients as itk::HistogramMatchingImageFilter
+    m_Gradients.assign(points - 1, 0.0);
+    for(SizeValueType j = 0; j < points - 1; j++)
+    {
+      const double denominator = m_SourceQuantiles[j + 1] - m_SourceQuantiles[j];
+      if(denominator != 0)
+      {
+        m_Gradients[j] = reference[j + 1] - reference[j];
+        m_Gradients[j] /= denominator;
+      }
+    }
+    m_LowerGradient = 0.0;
+    double denominator = m_SourceQuantiles[0] - sourceMinimum;
+    if(denominator != 0)
+    {
+      m_LowerGradient = reference[0] - referenceMinimum;
+      m_LowerGradient /= denominator;
+    }
+    // The last intensity of the table is the maximum of the source, so that the ITK filter divides by 0 and
+    // uses no gradient above it
+    m_UpperGradient = 0.0;
+
+    FillLookupTable(UseLookupTable());
+  }
+
+  void ThreadedGenerateData(const OutputImageRegionType& outputRegionForThread, ThreadIdType threadId) override
+  {
+    ProgressReporter progress(this, threadId, outputRegionForThread.GetNumberOfPixels() / outputRegionForThread.GetSize(0));
+    ImageRegionConstIterator<InputImageType> in(this->GetInput(), outputRegionForThread);
+    ImageScanlineIterator<OutputImageType> out(this->GetOutput(), outputRegionForThread);
+    while(!out.IsAtEnd())
+    {
+      while(!out.IsAtEndOfLine())
+      {
+        out.Set(Map(in.Get(), UseLookupTable()));
+        ++in;
+        ++out;
+      }
+      out.NextLine();
+      progress.CompletedPixel();
+    }
+  }
+
+private:
+  SizeValueType m_NumberOfHistogramLevels;
+  SizeValueType m_NumberOfMatchPoints;
+  bool m_ThresholdAtMeanIntensity;
+  ModelType m_ReferenceModel;
+
+  // Mapping computed before the threads run
+  std::vector<double> m_SourceQuantiles;
+  std::vector<double> m_Gradients;
+  double m_LowerGradient;
+  double m_UpperGradient;
+  std::vector<OutputPixelType> m_LookupTable;
+
+  static ModelType ModelHeader(SizeValueType numberOfHistogramLevels, SizeValueType numberOfMatchPoints, bool thresholdAtMeanIntensity)
+  {
+    ModelType header(GetModelHeaderSize());
+    header[0] = static_cast<double>(numberOfHistogramLevels);
+    header[1] = static_cast<double>(numberOfMatchPoints);
+    header[2] = thresholdAtMeanIntensity ? 1.0 : 0.0;
+    header[3] = static_cast<double>(ImageIOBase::MapPixelType<InputPixelType>::CType);
+    return header;
+  }
+
+  /** Fills @p quantiles with the intensity threshold, the quantiles and the maximum of @p image, as
+   * itk::HistogramMatchingImageFilter does, from the count of each value */
+  static void ComputeQuantiles(const InputImageType* image, SizeValueType levels, SizeValueType matchPoints, bool thresholdAtMeanIntensity, double& minimum, ModelType& quantiles, std::true_type)
+  {
+    const double lowest = static_cast<double>(NumericTraits<InputPixelType>::NonpositiveMin());
+    std::vector<SizeValueType> counts(static_cast<size_t>(NumericTraits<InputPixelType>::max() - NumericTraits<InputPixelType>::NonpositiveMin()) + 1, 0);
+    for(ImageRegionConstIterator<InputImageType> it(image, image->GetBufferedRegion()); !it.IsAtEnd(); ++it)
+    {
+      counts[static_cast<size_t>(static_cast<double>(it.Get()) - lowest)]++;
+    }
+    // The sum of the integer values is exact, as the one of the ITK filter
+    THistogramMeasurement minValue = NumericTraits<THistogramMeasurement>::max();
+    THistogramMeasurement maxValue = NumericTraits<THistogramMeasurement>::NonpositiveMin();
+    double sum = 0.0;
+    SizeValueType count = 0;
+    for(size_t v = 0; v < counts.size(); v++)
+    {
+      if(counts[v] == 0)
+      {
+        continue;
+      }
+      const THistogramMeasurement value = static_cast<THistogramMeasurement>(lowest + static_cast<double>(v));
+      minValue = std::min(minValue, value);
+      maxValue = std::max(maxValue, value);
+      sum += static_cast<double>(value) * static_cast<double>(counts[v]);
+      count += counts[v];
+    }
+    const THistogramMeasurement threshold = Threshold(minValue, sum / static_cast<double>(count), thresholdAtMeanIntensity);
+    typename HistogramType::Pointer histogram = CreateHistogram(levels, threshold, maxValue);
+    typename HistogramType::IndexType index(1);
+    typename HistogramType::MeasurementVectorType measurement(1);
+    for(size_t v = 0; v < counts.size(); v++)
+    {
+      const double value = lowest + static_cast<double>(v);
+      if(counts[v] > 0 && value >= static_cast<double>(threshold) && value <= static_cast<double>(maxValue))
+      {
+        measurement[0] = static_cast<THistogramMeasurement>(value);
+        histogram->GetIndex(measurement, index);
+        histogram->IncreaseFrequencyOfIndex(index, counts[v]);
+      }
+    }
+    minimum = static_cast<double>(minValue);
+    FillQuantiles(histogram, matchPoints, threshold, maxValue, quantiles);
+  }
+
+  /** Fills @p quantiles as itk::HistogramMatchingImageFilter does */
+  static void ComputeQuantiles(const InputImageType* image, SizeValueType levels, SizeValueType matchPoints, bool thresholdAtMeanIntensity, double& minimum, ModelType& quantiles, std::false_type)
+  {
+    THistogramMeasurement minValue = NumericTraits<THistogramMeasurement>::max();
+    THistogramMeasurement maxValue = NumericTraits<THistogramMeasurement>::NonpositiveMin();
+    double sum = 0.0;
+    SizeValueType count = 0;
+    for(ImageRegionConstIterator<InputImageType> it(image, image->GetBufferedRegion()); !it.IsAtEnd(); ++it)
+    {
+      const THistogramMeasurement value = static_cast<THistogramMeasurement>(it.Get());
+      minValue = std::min(minValue, value);
+      maxValue = std::max(maxValue, value);
+      sum += static_cast<double>(value);
+      count++;
+    }
+    const THistogramMeasurement threshold = Threshold(minValue, sum / static_cast<double>(count), thresholdAtMeanIntensity);
+    typename HistogramType::Pointer histogram = CreateHistogram(levels, threshold, maxValue);
+    typename HistogramType::IndexType index(1);
+    typename HistogramType::MeasurementVectorType measurement(1);
+    for(ImageRegionConstIterator<InputImageType> it(image, image->GetBufferedRegion()); !it.IsAtEnd(); ++it)
+    {
+      const InputPixelType value = it.Get();
+      if(static_cast<double>(value) >= static_cast<double>(threshold) && static_cast<double>(value) <= static_cast<double>(maxValue))
+      {
+        measurement[0] = value;
+        histogram->GetIndex(measurement, index);
+        histogram->IncreaseFrequencyOfIndex(index, 1);
+      }
+    }
+    minimum = static_cast<double>(minValue);
+    FillQuantiles(histogram, matchPoints, threshold, maxValue, quantiles);
+  }
+
+  static THistogramMeasurement Threshold(THistogramMeasurement minValue, double mean, bool thresholdAtMeanIntensity)
+  {
+    return thresholdAtMeanIntensity ? static_cast<THistogramMeasurement>(static_cast<InputPixelType>(mean)) : minValue;
+  }
+
+  static typename HistogramType::Pointer CreateHistogram(SizeValueType levels, THistogramMeasurement minValue, THistogramMeasurement maxValue)
+  {
+    typename HistogramType::Pointer histogram = HistogramType::New();
+    typename HistogramType::SizeType size;
+    typename HistogramType::MeasurementVectorType lowerBound;
+    typename HistogramType::MeasurementVectorType upperBound;
+    size.SetSize(1);
+    lowerBound.SetSize(1);
+    upperBound.SetSize(1);
+    histogram->SetMeasurementVectorSize(1);
+    size[0] = levels;
+    lowerBound.Fill(minValue);
+    upperBound.Fill(maxValue);
+    histogram->Initialize(size, lowerBound, upperBound);
+    histogram->SetToZero();
+    return histogram;
+  }
+
+  static void FillQuantiles(HistogramType* histogram, SizeValueType matchPoints, THistogramMeasurement threshold, THistogramMeasurement maxValue, ModelType& quantiles)
+  {
+    quantiles.assign(matchPoints + 2, 0.0);
+    quantiles[0] = static_cast<double>(threshold);
+    quantiles[matchPoints + 1] = static_cast<double>(maxValue);
+    const double delta = 1.0 / (double(matchPoints) + 1.0);
+    for(SizeValueType j = 1; j < matchPoints + 1; j++)
+    {
+      quantiles[j] = histogram->Quantile(0, double(j) * delta);
+    }
+  }
+
+  /** Mapping of itk::HistogramMatchingImageFilter */
+  OutputPixelType MapValue(double value) const
+  {
+    const double* reference = &m_ReferenceModel[GetModelHeaderSize() + 1];
+    const SizeValueType points = m_NumberOfMatchPoints + 2;
+    // First intensity of the table greater than the value, searched in the same order as the ITK filter
+    SizeValueType j = 0;
+    for(; j < points; j++)
+    {
+      if(value < m_SourceQuantiles[j])
+      {
+        break;
+      }
+    }
+    double mappedValue;
+    if(j == 0)
+    {
+      mappedValue = reference[0] + (value - m_SourceQuantiles[0]) * m_LowerGradient;
+    }
+    else if(j == points)
+    {
+      mappedValue = reference[points - 1] + (value - m_SourceQuantiles[points - 1]) * m_UpperGradient;
+    }
+    else
+    {
+      mappedValue = reference[j - 1] + (value - m_SourceQuantiles[j - 1]) * m_Gradients[j - 1];
+    }
+    return static_cast<OutputPixelType>(mappedValue);
+  }
+
+  void FillLookupTable(std::true_type)
+  {
+    const double lowest = static_cast<double>(NumericTraits<InputPixelType>::NonpositiveMin());
+    m_LookupTable.resize(static_cast<size_t>(NumericTraits<InputPixelType>::max() - NumericTraits<InputPixelType>::NonpositiveMin()) + 1);
+    for(size_t v = 0; v < m_LookupTable.size(); v++)
+    {
+      m_LookupTable[v] = MapValue(lowest + static_cast<double>(v));
+    }
+  }
+
+  void FillLookupTable(std::false_type)
+  {
+    m_LookupTable.clear();
+  }
+
+  OutputPixelType Map(InputPixelType value, std::true_type) const
+  {
+    return m_LookupTable[static_cast<size_t>(static_cast<double>(value) - static_cast<double>(NumericTraits<InputPixelType>::NonpositiveMin()))];
+  }
+
+  OutputPixelType Map(InputPixelType value, std::false_type) const
+  {
+    return MapValue(static_cast<double>(value));
+  }
+
+public:
+  HistogramMatchingModelImageFilter(const Self&) = delete;
+  void operator=(const Self&) = delete;
+};
+} // namespace itk
@@ -0,0 +1,245 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <itkBoxImageFilter.h>
+#include <itkNumericTraits.h>
+#include <itkProgressReporter.h>
+
+namespace itk
+{
+/** \class HistogramMedianImageFilter
+ * \brief Median filter of 8 and 16 bit integer images, computed with a sliding window histogram (Huang).
+ *
+ * itk::MedianImageFilter sorts the whole neighborhood of each pixel, a cost that grows with the volume of
+ * the neighborhood. This filter keeps the histogram of the neighborhood while the window slides through
+ * the region of each thread in a serpentine order, so that moving the window by one pixel only removes
+ * and adds the values of two faces of the window. The median is then found from the median of the
+ * previous position, skipping whole blocks of bins: a coarse histogram of 16 (8 bit) or 256 (16 bit)
+ * bins is kept along the full histogram.
+ *
+ * The neighborhood is clamped to the buffered region of the input (zero flux Neumann boundary condition)
+ * and the median is the value of rank n / 2 of the n values of the neighborhood, so that the output is
+ * identical to that of itk::MedianImageFilter.
+ */
+template <typename TInputImage, typename TOutputImage> class HistogramMedianImageFilter : public BoxImageFilter<TInputImage, TOutputImage>
+{
+public:
+  typedef HistogramMedianImageFilter Self;
+  typedef BoxImageFilter<TInputImage, TOutputImage> Superclass;
+  typedef SmartPointer<Self> Pointer;
+  typedef SmartPointer<const Self> ConstPointer;
+
+  itkNewMacro(Self);
+  itkTypeMacro(HistogramMedianImageFilter, BoxImageFilter);
+
+  typedef TInputImage InputImageType;
+  typedef TOutputImage OutputImageType;
+  typedef typename InputImageType::PixelType InputPixelType;
+  typedef typename OutputImageType::PixelType OutputPixelType;
+  typedef typename OutputImageType::RegionType OutputImageRegionType;
+  typedef typename Superclass::RadiusType RadiusType;
+
+  static_assert(std::is_integral<InputPixelType>::value && sizeof(InputPixelType) <= 2, "HistogramMedianImageFilter requires 8 or 16 bit integer pixels");
+
+protected:
+  HistogramMedianImageFilter() = default;
+  ~HistogramMedianImageFilter() override = default;
+
+  void ThreadedGenerateData(const OutputImageRegionType& outputRegionForThread, ThreadIdType threadId) override
+  {
+    const InputImageType* input = this->GetInput();
+    OutputImageType* output = this->GetOutput();
+    if(outputRegionForThread.GetNumberOfPixels() == 0)
+    {
+      return;
+    }
+
+    // Missing dimensions of 2D images are a single pixel without neighbors
+    const unsigned int dimension = InputImageType::ImageDimension;
+    const RadiusType radius = this->GetRadius();
+    const typename InputImageType::RegionType& buffered = input->GetBufferedRegion();
+    const typename OutputImageType::RegionType& outputBuffered = output->GetBufferedRegion();
+    long bufferStart[3] = {0, 0, 0};
+    long bufferEnd[3] = {0, 0, 0};
+    size_t stride[3] = {0, 0, 0};
+    long outputStart[3] = {0, 0, 0};
+    size_t outputStride[3] = {0, 0, 0};
+    long r[3] = {0, 0, 0};
+    long start[3] = {0, 0, 0};
+    long size[3] = {1, 1, 1};
+    for(unsigned int d = 0; d < dimension; d++)
+    {
+      bufferStart[d] = buffered.GetIndex(d);
+      bufferEnd[d] = bufferStart[d] + static_cast<long>(buffered.GetSize(d)) - 1;
+      stride[d] = input->GetOffsetTable()[d];
+      outputStart[d] = outputBuffered.GetIndex(d);
+      outputStride[d] = output->GetOffsetTable()[d];
+      r[d] = static_cast<long>(radius[d]);
+      start[d] = outputRegionForThread.GetIndex(d);
+      size[d] = static_cast<long>(outputRegionForThread.GetSize(d));
+    }
+    auto offset = [&](int d, long c) { return static_cast<size_t>(std::min(std::max(c, bufferStart[d]), bufferEnd[d]) - bufferStart[d]) * stride[d]; };
+
+    const InputPixelType* in = input->GetBufferPointer();
+    OutputPixelType* out = output->GetBufferPointer();
+    const size_t rank = static_cast<size_t>((2 * r[0] + 1) * (2 * r[1] + 1) * (2 * r[2] + 1)) / 2;
+    ProgressReporter progress(this, threadId, static_cast<SizeValueType>(size[1] * size[2]));
+
+    // Histogram of the neighborhood of the first pixel
+    Histogram histogram;
+    long c[3] = {start[0], start[1], start[2]};
+    for(long z = c[2] - r[2]; z <= c[2] + r[2]; z++)
+    {
+      for(long y = c[1] - r[1]; y <= c[1] + r[1]; y++)
+      {
+        for(long x = c[0] - r[0]; x <= c[0] + r[0]; x++)
+        {
+          histogram.add(Bin(in[offset(0, x) + offset(1, y) + offset(2, z)]));
+        }
+      }
+    }
+
+    // Moves the window by one pixel along axis a: the values of its trailing face leave the histogram, those
+    // of the face ahead of it enter
+    auto move = [&](int a, long direction) {
+      const int b = (a + 1) % 3;
+      const int e = (a + 2) % 3;
+      const size_t leaving = offset(a, c[a] - direction * r[a]);
+      const size_t entering = offset(a, c[a] + direction * (r[a] + 1));
+      for(long j = c[e] - r[e]; j <= c[e] + r[e]; j++)
+      {
+        const size_t oj = offset(e, j);
+        for(long i = c[b] - r[b]; i <= c[b] + r[b]; i++)
+        {
+          const size_t oij = oj + offset(b, i);
+          histogram.remove(Bin(in[leaving + oij]));
+          histogram.add(Bin(in[entering + oij]));
+        }
+      }
+      c[a] += direction;
+    };
+
+    // Serpentine sweep: the rows alternate between +X and -X, the slices between +Y and -Y
+    long directionX = 1;
+    long directionY = 1;
+    for(long iz = 0; iz < size[2]; iz++)
+    {
+      for(long iy = 0; iy < size[1]; iy++)
+      {
+        for(long ix = 0; ix < size[0]; ix++)
+        {
+          size_t o = 0;
+          for(int d = 0; d < 3; d++)
+          {
+            o += static_cast<size_t>(c[d] - outputStart[d]) * outputStride[d];
+          }
+          out[o] = static_cast<OutputPixelType>(Value(histogram.median(rank)));
+          if(ix + 1 < size[0])
+          {
+            move(0, directionX);
+          }
+        }
+        directionX = -directionX;
+        if(iy + 1 < size[1])
+        {
+          move(1, directionY);
+        }
+        progress.CompletedPixel();
+      }
+      directionY = -directionY;
+      if(iz + 1 < size[2])
+      {
+        move(2, 1);
+      }
+    }
+  }
+
+private:
+  static const unsigned int ValueBits = 8 * sizeof(InputPixelType);
+  static const unsigned int BlockBits = ValueBits / 2;
+  static const size_t NumberOfBins = size_t(1) << ValueBits;
+  static const size_t BlockSize = size_t(1) << BlockBits;
+
+  static size_t Bin(InputPixelType value)
+  {
+    return static_cast<size_t>(static_cast<long>(value) - static_cast<long>(NumericTraits<InputPixelType>::NonpositiveMin()));
+  }
+
+  static InputPixelType Value(size_t bin)
+  {
+    return static_cast<InputPixelType>(static_cast<long>(bin) + static_cast<long>(NumericTraits<InputPixelType>::NonpositiveMin()));
+  }
+
+  /** Two level histogram tracking the bin of a given rank */
+  class Histogram
+  {
+  public:
+    Histogram()
+    : m_Fine(NumberOfBins, 0)
+    , m_Coarse(NumberOfBins / BlockSize, 0)
+    , m_Median(0)
+    , m_Below(0)
+    {
+    }
+
+    void add(size_t bin)
+    {
+      m_Fine[bin]++;
+      m_Coarse[bin >> BlockBits]++;
+      m_Below += (bin < m_Median) ? 1 : 0;
+    }
+
+    void remove(size_t bin)
+    {
+      m_Fine[bin]--;
+      m_Coarse[bin >> BlockBits]--;
+      m_Below -= (bin < m_Median) ? 1 : 0;
+    }
+
+    /** Returns the bin of the value of rank @p rank, moving from the previous one */
+    size_t median(size_t rank)
+    {
+      // m_Below counts the values in the bins below m_Median
+      while(m_Below > rank)
+      {
+        if((m_Median & (BlockSize - 1)) == 0 && m_Below - m_Coarse[(m_Median >> BlockBits) - 1] > rank)
+        {
+          m_Below -= m_Coarse[(m_Median >> BlockBits) - 1];
+          m_Median -= BlockSize;
+          continue;
+        }
+        m_Median--;
+        m_Below -= m_Fine[m_Median];
+      }
+      while(m_Below + m_Fine[m_Median] <= rank)
+      {
+        if((m_Median & (BlockSize - 1)) == 0 && m_Below + m_Coarse[m_Median >> BlockBits] <= rank)
+        {
+          m_Below += m_Coarse[m_Median >> BlockBits];
+          m_Median += BlockSize;
+          continue;
+        }
+        m_Below += m_Fine[m_Median];
+        m_Median++;
+      }
+      return m_Median;
+    }
+
+  private:
+    std::vector<uint32_t> m_Fine;
+    std::vector<uint32_t> m_Coarse;
+    size_t m_Median;
+    size_t m_Below;
+  };
+
+  ITK_DISALLOW_COPY_AND_ASSIGN(HistogramMedianImageFilter);
+};
+} // end namespace itk
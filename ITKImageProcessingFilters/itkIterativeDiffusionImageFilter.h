@@ -0,0 +1,302 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <algorithm>
+
+#include <itkAnisotropicDiffusionFunction.h>
+#include <itkImage.h>
+#include <itkImageRegionConstIterator.h>
+#include <itkImageRegionIterator.h>
+#include <itkImageToImageFilter.h>
+#include <itkMultiThreader.h>
+#include <itkNeighborhoodAlgorithm.h>
+
+namespace itk
+{
+/** \class IterativeDiffusionImageFilter
+ * \brief Runs the finite difference function of an ITK diffusion or curvature flow filter for a fixed number
+ * of iterations, from any scalar input to any scalar output, with two buffers of real pixels.
+ *
+ * The ITK filters (itk::DenseFiniteDifferenceImageFilter) work on an image of real pixels: the input has to be
+ * cast to it first, and the output cast back. Each iteration stores the update of every pixel in a buffer
+ * of the size of the image, then adds it to the image. This filter instead computes each iteration from one
+ * buffer into the other (ping-pong): the first buffer is filled from the input, and the last iteration writes
+ * the output pixels directly. An iteration then reads and writes the image once, and no buffer of updates nor
+ * cast images are needed: one iteration only needs the first buffer.
+ *
+ * The function, its parameters (time step, conductance...) and its neighborhood radius are those of the ITK
+ * filter, which it is given with SetDifferenceFunction(); the time step must not depend on the updates, as
+ * for the anisotropic diffusion and curvature flow functions. The pixels are computed exactly as by the ITK
+ * filter, with the same boundary condition. When ConductanceScalingUpdateInterval is not 0, the function must
+ * be an itk::AnisotropicDiffusionFunction, whose average gradient magnitude is computed every
+ * ConductanceScalingUpdateInterval iterations as itk::AnisotropicDiffusionImageFilter does.
+ *
+ * The filter requests the largest possible region.
+ */
+template <typename TInputImage, typename TOutputImage, typename TFunction> class IterativeDiffusionImageFilter : public ImageToImageFilter<TInputImage, TOutputImage>
+{
+public:
+  typedef IterativeDiffusionImageFilter Self;
+  typedef ImageToImageFilter<TInputImage, TOutputImage> Superclass;
+  typedef SmartPointer<Self> Pointer;
+  typedef SmartPointer<const Self> ConstPointer;
+
+  itkNewMacro(Self);
+  itkTypeMacro(IterativeDiffusionImageFilter, ImageToImageFilter);
+
+  typedef TInputImage InputImageType;
+  typedef TOutputImage OutputImageType;
+  typedef typename InputImageType::PixelType InputPixelType;
+  typedef typename OutputImageType::PixelType OutputPixelType;
+  typedef typename OutputImageType::RegionType OutputImageRegionType;
+  typedef TFunction FunctionType;
+  typedef typename FunctionType::ImageType RealImageType;
+  typedef typename RealImageType::PixelType RealPixelType;
+  typedef typename FunctionType::TimeStepType TimeStepType;
+
+  itkStaticConstMacro(ImageDimension, unsigned int, OutputImageType::ImageDimension);
+
+  itkSetObjectMacro(DifferenceFunction, FunctionType);
+  itkGetModifiableObjectMacro(DifferenceFunction, FunctionType);
+
+  itkSetMacro(NumberOfIterations, unsigned int);
+  itkGetConstReferenceMacro(NumberOfIterations, unsigned int);
+
+  /** Scale the derivatives by the spacing of the image, on by default as for the ITK filters */
+  itkSetMacro(UseImageSpacing, bool);
+  itkGetConstReferenceMacro(UseImageSpacing, bool);
+  itkBooleanMacro(UseImageSpacing);
+
+  /** Number of iterations between two computations of the average gradient magnitude, 0 for functions that
+   * are not anisotropic diffusion functions */
+  itkSetMacro(ConductanceScalingUpdateInterval, unsigned int);
+  itkGetConstReferenceMacro(ConductanceScalingUpdateInterval, unsigned int);
+
+protected:
+  IterativeDiffusionImageFilter()
+  : m_NumberOfIterations(1)
+  , m_UseImageSpacing(true)
+  , m_ConductanceScalingUpdateInterval(0)
+  , m_Current(nullptr)
+  , m_Next(nullptr)
+  , m_TimeStep(0.0)
+  , m_LastIteration(false)
+  {
+  }
+  ~IterativeDiffusionImageFilter() override = default;
+
+  void GenerateInputRequestedRegion() override
+  {
+    Superclass::GenerateInputRequestedRegion();
+    InputImageType* input = const_cast<InputImageType*>(this->GetInput());
+    if(nullptr != input)
+    {
+      input->SetRequestedRegionToLargestPossibleRegion();
+    }
+  }
+
+  void EnlargeOutputRequestedRegion(DataObject* output) override
+  {
+    Superclass::EnlargeOutputRequestedRegion(output);
+    output->SetRequestedRegionToLargestPossibleRegion();
+  }
+
+  void GenerateData() override
+  {
+    if(m_DifferenceFunction.IsNull())
+    {
+      itkExceptionMacro(<< "No difference function was set");
+    }
+    typename AnisotropicDiffusionFunction<RealImageType>::Pointer anisotropic = dynamic_cast<AnisotropicDiffusionFunction<RealImageType>*>(m_DifferenceFunction.GetPointer());
+    if(m_ConductanceScalingUpdateInterval > 0 && anisotropic.IsNull())
+    {
+      itkExceptionMacro(<< "The conductance can only be scaled by an anisotropic diffusion function");
+    }
+    this->AllocateOutputs();
+    const InputImageType* input = this->GetInput();
+    OutputImageType* output = this->GetOutput();
+
+    double coefficients[ImageDimension];
+    for(unsigned int d = 0; d < ImageDimension; d++)
+    {
+      coefficients[d] = m_UseImageSpacing ? 1.0 / input->GetSpacing()[d] : 1.0;
+    }
+    m_DifferenceFunction->SetScaleCoefficients(coefficients);
+
+    m_Current = CreateBuffer();
+    Execute(ConvertPass);
+    if(m_NumberOfIterations == 0)
+    {
+      Execute(CopyPass);
+      m_Current = nullptr;
+      return;
+    }
+    if(m_NumberOfIterations > 1)
+    {
+      m_Next = CreateBuffer();
+    }
+
+    for(unsigned int iteration = 0; iteration < m_NumberOfIterations; iteration++)
+    {
+      // Same initialization as itk::AnisotropicDiffusionImageFilter and itk::FiniteDifferenceImageFilter
+      if(m_ConductanceScalingUpdateInterval > 0 && iteration % m_ConductanceScalingUpdateInterval == 0)
+      {
+        anisotropic->CalculateAverageGradientMagnitudeSquared(m_Current);
+      }
+      m_DifferenceFunction->InitializeIteration();
+      void* globalData = m_DifferenceFunction->GetGlobalDataPointer();
+      m_TimeStep = m_DifferenceFunction->ComputeGlobalTimeStep(globalData);
+      m_DifferenceFunction->ReleaseGlobalDataPointer(globalData);
+
+      m_LastIteration = (iteration + 1 == m_NumberOfIterations);
+      Execute(IterationPass);
+      std::swap(m_Current, m_Next);
+      this->UpdateProgress(static_cast<float>(iteration + 1) / static_cast<float>(m_NumberOfIterations));
+    }
+    m_Current = nullptr;
+    m_Next = nullptr;
+  }
+
+private:
+  typename FunctionType::Pointer m_DifferenceFunction;
+  unsigned int m_NumberOfIterations;
+  bool m_UseImageSpacing;
+  unsigned int m_ConductanceScalingUpdateInterval;
+
+  // State of the passes shared with the threads
+  typename RealImageType::Pointer m_Current;
+  typename RealImageType::Pointer m_Next;
+  TimeStepType m_TimeStep;
+  bool m_LastIteration;
+
+  enum Pass
+  {
+    ConvertPass,
+    CopyPass,
+    IterationPass
+  };
+
+  struct ThreadStruct
+  {
+    Self* filter;
+    Pass pass;
+  };
+
+  typename RealImageType::Pointer CreateBuffer() const
+  {
+    typename RealImageType::Pointer buffer = RealImageType::New();
+    buffer->CopyInformation(this->GetOutput());
+    buffer->SetRegions(this->GetOutput()->GetRequestedRegion());
+    buffer->Allocate();
+    return buffer;
+  }
+
+  /** Runs @p pass on all the threads, each one processing a piece of the output region */
+  void Execute(Pass pass)
+  {
+    ThreadStruct str;
+    str.filter = this;
+    str.pass = pass;
+    this->GetMultiThreader()->SetNumberOfThreads(this->GetNumberOfThreads());
+    this->GetMultiThreader()->SetSingleMethod(Self::PassThreaderCallback, &str);
+    this->GetMultiThreader()->SingleMethodExecute();
+  }
+
+  static ITK_THREAD_RETURN_TYPE PassThreaderCallback(void* arg)
+  {
+    MultiThreader::ThreadInfoStruct* info = static_cast<MultiThreader::ThreadInfoStruct*>(arg);
+    ThreadStruct* str = static_cast<ThreadStruct*>(info->UserData);
+    OutputImageRegionType region;
+    const ThreadIdType total = str->filter->SplitRequestedRegion(info->ThreadID, info->NumberOfThreads, region);
+    if(info->ThreadID >= total)
+    {
+      return ITK_THREAD_RETURN_VALUE;
+    }
+    switch(str->pass)
+    {
+    case ConvertPass:
+      str->filter->Convert(region);
+      break;
+    case CopyPass:
+      str->filter->Copy(region);
+      break;
+    case IterationPass:
+      str->filter->Iterate(region);
+      break;
+    }
+    return ITK_THREAD_RETURN_VALUE;
+  }
+
+  /** Fills the first buffer with the input pixels */
+  void Convert(const OutputImageRegionType& region)
+  {
+    ImageRegionConstIterator<InputImageType> in(this->GetInput(), region);
+    ImageRegionIterator<RealImageType> out(m_Current, region);
+    for(; !in.IsAtEnd(); ++in, ++out)
+    {
+      out.Set(static_cast<RealPixelType>(in.Get()));
+    }
+  }
+
+  /** Writes the current buffer to the output, when there is no iteration */
+  void Copy(const OutputImageRegionType& region)
+  {
+    ImageRegionConstIterator<RealImageType> in(m_Current, region);
+    ImageRegionIterator<OutputImageType> out(this->GetOutput(), region);
+    for(; !in.IsAtEnd(); ++in, ++out)
+    {
+      out.Set(static_cast<OutputPixelType>(in.Get()));
+    }
+  }
+
+  /** Computes one iteration of @p region from the current buffer into the next one, or into the output at the
+   * last iteration. The inner region and the boundary faces are processed as by
+   * itk::DenseFiniteDifferenceImageFilter. */
+  void Iterate(const OutputImageRegionType& region)
+  {
+    typedef typename FunctionType::NeighborhoodType NeighborhoodType;
+    typedef NeighborhoodAlgorithm::ImageBoundaryFacesCalculator<RealImageType> FaceCalculatorType;
+    const typename FunctionType::RadiusType radius = m_DifferenceFunction->GetRadius();
+    FaceCalculatorType faceCalculator;
+    typename FaceCalculatorType::FaceListType faceList = faceCalculator(m_Current, region, radius);
+
+    void* globalData = m_DifferenceFunction->GetGlobalDataPointer();
+    for(typename FaceCalculatorType::FaceListType::const_iterator face = faceList.begin(); face != faceList.end(); ++face)
+    {
+      NeighborhoodType neighborhood(radius, m_Current, *face);
+      if(m_LastIteration)
+      {
+        ImageRegionIterator<OutputImageType> out(this->GetOutput(), *face);
+        for(neighborhood.GoToBegin(); !neighborhood.IsAtEnd(); ++neighborhood, ++out)
+        {
+          out.Set(static_cast<OutputPixelType>(Update(neighborhood, globalData)));
+        }
+      }
+      else
+      {
+        ImageRegionIterator<RealImageType> out(m_Next, *face);
+        for(neighborhood.GoToBegin(); !neighborhood.IsAtEnd(); ++neighborhood, ++out)
+        {
+          out.Set(Update(neighborhood, globalData));
+        }
+      }
+    }
+    m_DifferenceFunction->ReleaseGlobalDataPointer(globalData);
+  }
+
+  /** Value of the pixel at the center of @p neighborhood after the iteration, rounded as the update applied by
+   * itk::DenseFiniteDifferenceImageFilter */
+  RealPixelType Update(const typename FunctionType::NeighborhoodType& neighborhood, void* globalData) const
+  {
+    const RealPixelType update = m_DifferenceFunction->ComputeUpdate(neighborhood, globalData);
+    return neighborhood.GetCenterPixel() + static_cast<RealPixelType>(update * m_TimeStep);
+  }
+
+public:
+  IterativeDiffusionImageFilter(const Self&) = delete;
+  void operator=(const Self&) = delete;
+};
+} // namespace itk
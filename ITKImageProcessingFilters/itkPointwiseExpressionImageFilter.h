@@ -0,0 +1,147 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include <itkImageScanlineIterator.h>
+#include <itkInPlaceImageFilter.h>
+#include <itkNumericTraits.h>
+#include <itkProgressReporter.h>
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKPointwiseExpression.h"
+
+namespace itk
+{
+/** \class PointwiseExpressionImageFilter
+ * \brief Replaces each pixel value by the value of a compiled ITKPointwiseExpression.
+ *
+ * The filter does in one pass what a chain of unary filters (Abs, Sqrt, ShiftScale, Sigmoid...) does in
+ * one pass per filter: each scanline is read once, the whole expression is evaluated in double precision
+ * on blocks of values, and the result is written once. No intermediate image is allocated.
+ *
+ * Each component of a multi-component pixel is processed independently. Values that do not fit an integer
+ * output pixel type are clamped to its range, and NaN becomes 0.
+ *
+ * In-place execution is off by default. When it is turned on and the input and output types match, each
+ * block of values is read before it is overwritten, so the output reuses the input buffer.
+ */
+template <typename TInputImage, typename TOutputImage> class PointwiseExpressionImageFilter : public InPlaceImageFilter<TInputImage, TOutputImage>
+{
+public:
+  typedef PointwiseExpressionImageFilter Self;
+  typedef InPlaceImageFilter<TInputImage, TOutputImage> Superclass;
+  typedef SmartPointer<Self> Pointer;
+  typedef SmartPointer<const Self> ConstPointer;
+
+  itkNewMacro(Self);
+  itkTypeMacro(PointwiseExpressionImageFilter, InPlaceImageFilter);
+
+  typedef TInputImage InputImageType;
+  typedef TOutputImage OutputImageType;
+  typedef typename InputImageType::PixelType InputPixelType;
+  typedef typename OutputImageType::PixelType OutputPixelType;
+  typedef typename NumericTraits<InputPixelType>::ValueType InputValueType;
+  typedef typename NumericTraits<OutputPixelType>::ValueType OutputValueType;
+  typedef typename OutputImageType::RegionType OutputImageRegionType;
+
+  /** Expression evaluated for each pixel, copied by the filter */
+  void SetExpression(const ITKPointwiseExpression& expression)
+  {
+    m_Expression = expression;
+    this->Modified();
+  }
+  const ITKPointwiseExpression& GetExpression() const
+  {
+    return m_Expression;
+  }
+
+protected:
+  PointwiseExpressionImageFilter()
+  {
+    this->InPlaceOff();
+  }
+  ~PointwiseExpressionImageFilter() override = default;
+
+  void BeforeThreadedGenerateData() override
+  {
+    if(!m_Expression.isValid())
+    {
+      itkExceptionMacro(<< "The expression is not compiled");
+    }
+  }
+
+  void ThreadedGenerateData(const OutputImageRegionType& outputRegionForThread, ThreadIdType threadId) override
+  {
+    const InputImageType* input = this->GetInput();
+    OutputImageType* output = this->GetOutput();
+    if(outputRegionForThread.GetNumberOfPixels() == 0)
+    {
+      return;
+    }
+
+    // Pixels are arrays of values (scalars, itk::Vector, itk::RGBPixel...), stored contiguously along a scanline
+    const size_t components = sizeof(InputPixelType) / sizeof(InputValueType);
+    const size_t lineLength = outputRegionForThread.GetSize(0) * components;
+    const InputValueType* inputBuffer = reinterpret_cast<const InputValueType*>(input->GetBufferPointer());
+    OutputValueType* outputBuffer = reinterpret_cast<OutputValueType*>(output->GetBufferPointer());
+
+    std::vector<double> values(ITKPointwiseExpression::BlockSize);
+    std::vector<double> scratch(m_Expression.getScratchSize());
+    ProgressReporter progress(this, threadId, outputRegionForThread.GetNumberOfPixels() / outputRegionForThread.GetSize(0));
+
+    ImageScanlineIterator<OutputImageType> it(output, outputRegionForThread);
+    while(!it.IsAtEnd())
+    {
+      const typename OutputImageType::IndexType index = it.GetIndex();
+      const InputValueType* in = inputBuffer + input->ComputeOffset(index) * components;
+      OutputValueType* out = outputBuffer + output->ComputeOffset(index) * components;
+      for(size_t begin = 0; begin < lineLength; begin += ITKPointwiseExpression::BlockSize)
+      {
+        const size_t count = std::min(lineLength - begin, ITKPointwiseExpression::BlockSize);
+        for(size_t i = 0; i < count; i++)
+        {
+          values[i] = static_cast<double>(in[begin + i]);
+        }
+        m_Expression.evaluate(values.data(), count, scratch.data());
+        for(size_t i = 0; i < count; i++)
+        {
+          out[begin + i] = Convert(values[i]);
+        }
+      }
+      it.NextLine();
+      progress.CompletedPixel();
+    }
+  }
+
+  /** Converts a value to the output type, clamping it to the range of integer types */
+  static OutputValueType Convert(double value)
+  {
+    if(std::numeric_limits<OutputValueType>::is_integer)
+    {
+      if(value != value)
+      {
+        return OutputValueType(0);
+      }
+      if(value <= static_cast<double>(NumericTraits<OutputValueType>::NonpositiveMin()))
+      {
+        return NumericTraits<OutputValueType>::NonpositiveMin();
+      }
+      if(value >= static_cast<double>(NumericTraits<OutputValueType>::max()))
+      {
+        return NumericTraits<OutputValueType>::max();
+      }
+    }
+    return static_cast<OutputValueType>(value);
+  }
+
+private:
+  ITKPointwiseExpression m_Expression;
+
+  ITK_DISALLOW_COPY_AND_ASSIGN(PointwiseExpressionImageFilter);
+};
+} // end namespace itk
@@ -0,0 +1,463 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include <itkImageToImageFilter.h>
+#include <itkMultiThreader.h>
+#include <itkNumericTraits.h>
+
+namespace itk
+{
+/** \class SeparableDistanceMapImageFilter
+ * \brief Exact Euclidean distance map computed one axis at a time (Felzenszwalb / Maurer).
+ *
+ * The squared distance to the nearest site is first computed along each row (X), then each pass along the
+ * next axis takes, for each pixel of a line, the lower envelope of the parabolas centered on the pixels of
+ * that line, whose heights are the squared distances of the previous pass. Every pass is exact, so that the
+ * result is the exact Euclidean distance, with or without the spacing of the image. The lines of a pass
+ * are independent and split between the threads; the distances are kept in the output image between the
+ * passes, with a buffer of one line per thread.
+ *
+ * The sites and the sign of the distance reproduce the ITK distance map filters:
+ * - Distance: the sites are the non-zero pixels (itk::DanielssonDistanceMapImageFilter);
+ * - SignedObjects: the distance to the non-zero pixels minus the distance to the zero pixels dilated by a
+ *   ball of radius 1, negative inside the objects (itk::SignedDanielssonDistanceMapImageFilter);
+ * - SignedContour: the sites are the pixels different from BackgroundValue having a neighbor (faces, edges
+ *   and vertices) equal to it; the distances are negative inside the objects
+ *   (itk::SignedMaurerDistanceMapImageFilter).
+ * InsideIsPositive flips the sign of the signed distances. The distance of images without sites is the
+ * largest value of the output pixel type (its square root unless SquaredDistance is set).
+ *
+ * The output pixel type must be a floating point type. The filter requests the largest possible region.
+ */
+template <typename TInputImage, typename TOutputImage> class SeparableDistanceMapImageFilter : public ImageToImageFilter<TInputImage, TOutputImage>
+{
+public:
+  typedef SeparableDistanceMapImageFilter Self;
+  typedef ImageToImageFilter<TInputImage, TOutputImage> Superclass;
+  typedef SmartPointer<Self> Pointer;
+  typedef SmartPointer<const Self> ConstPointer;
+
+  itkNewMacro(Self);
+  itkTypeMacro(SeparableDistanceMapImageFilter, ImageToImageFilter);
+
+  typedef TInputImage InputImageType;
+  typedef TOutputImage OutputImageType;
+  typedef typename InputImageType::PixelType InputPixelType;
+  typedef typename OutputImageType::PixelType OutputPixelType;
+  typedef typename NumericTraits<InputPixelType>::ValueType InputValueType;
+
+  static_assert(std::is_floating_point<OutputPixelType>::value, "SeparableDistanceMapImageFilter requires floating point output pixels");
+
+  enum class Mode : int
+  {
+    Distance,
+    SignedObjects,
+    SignedContour
+  };
+
+  void SetMode(Mode mode)
+  {
+    if(m_Mode != mode)
+    {
+      m_Mode = mode;
+      this->Modified();
+    }
+  }
+  Mode GetMode() const
+  {
+    return m_Mode;
+  }
+
+  itkSetMacro(SquaredDistance, bool);
+  itkGetConstReferenceMacro(SquaredDistance, bool);
+  itkBooleanMacro(SquaredDistance);
+
+  itkSetMacro(UseImageSpacing, bool);
+  itkGetConstReferenceMacro(UseImageSpacing, bool);
+  itkBooleanMacro(UseImageSpacing);
+
+  itkSetMacro(InsideIsPositive, bool);
+  itkGetConstReferenceMacro(InsideIsPositive, bool);
+  itkBooleanMacro(InsideIsPositive);
+
+  /** Value of the background pixels in SignedContour mode */
+  itkSetMacro(BackgroundValue, InputValueType);
+  itkGetConstReferenceMacro(BackgroundValue, InputValueType);
+
+protected:
+  SeparableDistanceMapImageFilter()
+  : m_Mode(Mode::Distance)
+  , m_SquaredDistance(false)
+  , m_UseImageSpacing(false)
+  , m_InsideIsPositive(false)
+  , m_BackgroundValue(NumericTraits<InputValueType>::ZeroValue())
+  , m_Input(nullptr)
+  , m_Distance(nullptr)
+  , m_Background(nullptr)
+  , m_SiteMode(Mode::Distance)
+  {
+  }
+  ~SeparableDistanceMapImageFilter() override = default;
+
+  void GenerateInputRequestedRegion() override
+  {
+    Superclass::GenerateInputRequestedRegion();
+    InputImageType* input = const_cast<InputImageType*>(this->GetInput());
+    if(nullptr != input)
+    {
+      input->SetRequestedRegionToLargestPossibleRegion();
+    }
+  }
+
+  void EnlargeOutputRequestedRegion(DataObject* output) override
+  {
+    Superclass::EnlargeOutputRequestedRegion(output);
+    output->SetRequestedRegionToLargestPossibleRegion();
+  }
+
+  void GenerateData() override
+  {
+    this->AllocateOutputs();
+    const InputImageType* input = this->GetInput();
+    OutputImageType* output = this->GetOutput();
+    const unsigned int dimension = InputImageType::ImageDimension;
+    m_Dims[0] = m_Dims[1] = m_Dims[2] = 1;
+    m_Spacing[0] = m_Spacing[1] = m_Spacing[2] = 1.0;
+    for(unsigned int d = 0; d < dimension; d++)
+    {
+      m_Dims[d] = input->GetBufferedRegion().GetSize(d);
+      m_Spacing[d] = m_UseImageSpacing ? static_cast<double>(input->GetSpacing()[d]) : 1.0;
+    }
+    m_Input = input->GetBufferPointer();
+    const size_t numberOfPixels = m_Dims[0] * m_Dims[1] * m_Dims[2];
+    if(numberOfPixels == 0)
+    {
+      return;
+    }
+
+    // Squared distances to the sites, in the output
+    m_Distance = output->GetBufferPointer();
+    // The first transform of SignedObjects is the distance to the objects
+    m_SiteMode = (m_Mode == Mode::SignedObjects) ? Mode::Distance : m_Mode;
+    Transform(0.0f, 0.5f);
+    if(m_Mode != Mode::SignedObjects)
+    {
+      Execute(FinishPass);
+      return;
+    }
+    // Distances of the pixels of the objects to the dilated background
+    std::vector<OutputPixelType> background(numberOfPixels);
+    m_Distance = background.data();
+    m_SiteMode = Mode::SignedObjects;
+    Transform(0.5f, 0.5f);
+    m_Distance = output->GetBufferPointer();
+    m_Background = background.data();
+    Execute(FinishPass);
+    m_Background = nullptr;
+  }
+
+private:
+  Mode m_Mode;
+  bool m_SquaredDistance;
+  bool m_UseImageSpacing;
+  bool m_InsideIsPositive;
+  InputValueType m_BackgroundValue;
+
+  // State of the passes shared with the threads
+  const InputPixelType* m_Input;
+  OutputPixelType* m_Distance;
+  const OutputPixelType* m_Background;
+  Mode m_SiteMode;
+  size_t m_Dims[3];
+  double m_Spacing[3];
+
+  // Pass turning the squared distances into the final ones
+  static const unsigned int FinishPass = 3;
+
+  struct ThreadStruct
+  {
+    Self* filter;
+    unsigned int pass;
+  };
+
+  /** Runs a pass along each axis of more than one pixel, reporting progress from @p progress to @p progress + @p weight */
+  void Transform(float progress, float weight)
+  {
+    const unsigned int dimension = InputImageType::ImageDimension;
+    for(unsigned int axis = 0; axis < dimension; axis++)
+    {
+      if(axis > 0 && m_Dims[axis] == 1)
+      {
+        continue;
+      }
+      Execute(axis);
+      this->UpdateProgress(progress + weight * static_cast<float>(axis + 1) / static_cast<float>(dimension));
+    }
+  }
+
+  /** Runs @p pass (an axis or FinishPass) on all the threads */
+  void Execute(unsigned int pass)
+  {
+    ThreadStruct str;
+    str.filter = this;
+    str.pass = pass;
+    this->GetMultiThreader()->SetNumberOfThreads(this->GetNumberOfThreads());
+    this->GetMultiThreader()->SetSingleMethod(Self::PassThreaderCallback, &str);
+    this->GetMultiThreader()->SingleMethodExecute();
+  }
+
+  static ITK_THREAD_RETURN_TYPE PassThreaderCallback(void* arg)
+  {
+    MultiThreader::ThreadInfoStruct* info = static_cast<MultiThreader::ThreadInfoStruct*>(arg);
+    ThreadStruct* str = static_cast<ThreadStruct*>(info->UserData);
+    if(str->pass == FinishPass)
+    {
+      const size_t numberOfPixels = str->filter->m_Dims[0] * str->filter->m_Dims[1] * str->filter->m_Dims[2];
+      str->filter->Finish(numberOfPixels * info->ThreadID / info->NumberOfThreads, numberOfPixels * (info->ThreadID + 1) / info->NumberOfThreads);
+    }
+    else
+    {
+      str->filter->ProcessLines(str->pass, info->ThreadID, info->NumberOfThreads);
+    }
+    return ITK_THREAD_RETURN_VALUE;
+  }
+
+  /** Processes the share of @p threadId of the lines along @p axis */
+  void ProcessLines(unsigned int axis, ThreadIdType threadId, ThreadIdType numberOfThreads)
+  {
+    const size_t length = m_Dims[axis];
+    const size_t lines = m_Dims[0] * m_Dims[1] * m_Dims[2] / length;
+    const size_t first = lines * threadId / numberOfThreads;
+    const size_t last = lines * (threadId + 1) / numberOfThreads;
+    const size_t stride = (axis == 0) ? 1 : (axis == 1 ? m_Dims[0] : m_Dims[0] * m_Dims[1]);
+
+    std::vector<double> f(length);
+    std::vector<double> d(length);
+    std::vector<size_t> v(length);
+    std::vector<double> z(length + 1);
+    for(size_t line = first; line < last; line++)
+    {
+      // Offset of the first pixel of the line: the lines are ordered by the other axes, X first
+      size_t start = 0;
+      if(axis == 0)
+      {
+        start = line * m_Dims[0];
+      }
+      else if(axis == 1)
+      {
+        start = (line % m_Dims[0]) + (line / m_Dims[0]) * m_Dims[0] * m_Dims[1];
+      }
+      else
+      {
+        start = line;
+      }
+      OutputPixelType* distance = m_Distance + start;
+      if(axis == 0)
+      {
+        Sites(start, length, d);
+        for(size_t i = 0; i < length; i++)
+        {
+          distance[i] = static_cast<OutputPixelType>(d[i]);
+        }
+        continue;
+      }
+      for(size_t i = 0; i < length; i++)
+      {
+        f[i] = static_cast<double>(distance[i * stride]);
+      }
+      if(LowerEnvelope(f, m_Spacing[axis], v, z, d))
+      {
+        for(size_t i = 0; i < length; i++)
+        {
+          distance[i * stride] = static_cast<OutputPixelType>(d[i]);
+        }
+      }
+    }
+  }
+
+  bool IsObject(size_t offset) const
+  {
+    return static_cast<InputValueType>(m_Input[offset]) != NumericTraits<InputValueType>::ZeroValue();
+  }
+
+  /** Returns true if a neighbor of pixel (x, y, z) inside the image satisfies @p predicate, the neighbors being
+   * those of the ball of radius 1 (faces and edges) or, when @p vertices is set, all the pixels of the 3x3x3 box */
+  template <typename Predicate> bool AnyNeighbor(size_t x, size_t y, size_t z, bool vertices, Predicate predicate) const
+  {
+    for(int dz = -1; dz <= 1; dz++)
+    {
+      if((dz < 0 && z == 0) || (dz > 0 && z + 1 >= m_Dims[2]))
+      {
+        continue;
+      }
+      for(int dy = -1; dy <= 1; dy++)
+      {
+        if((dy < 0 && y == 0) || (dy > 0 && y + 1 >= m_Dims[1]))
+        {
+          continue;
+        }
+        for(int dx = -1; dx <= 1; dx++)
+        {
+          if((dx < 0 && x == 0) || (dx > 0 && x + 1 >= m_Dims[0]))
+          {
+            continue;
+          }
+          const int order = (dx != 0) + (dy != 0) + (dz != 0);
+          if(order == 0 || (order == 3 && !vertices))
+          {
+            continue;
+          }
+          if(predicate(((z + dz) * m_Dims[1] + (y + dy)) * m_Dims[0] + (x + dx)))
+          {
+            return true;
+          }
+        }
+      }
+    }
+    return false;
+  }
+
+  bool IsSite(size_t offset) const
+  {
+    if(m_SiteMode == Mode::Distance)
+    {
+      return IsObject(offset);
+    }
+    const size_t x = offset % m_Dims[0];
+    const size_t y = (offset / m_Dims[0]) % m_Dims[1];
+    const size_t z = offset / (m_Dims[0] * m_Dims[1]);
+    if(m_SiteMode == Mode::SignedObjects)
+    {
+      // Second transform: zero pixels, dilated by the ball of radius 1
+      return !IsObject(offset) || AnyNeighbor(x, y, z, false, [this](size_t o) { return !IsObject(o); });
+    }
+    const InputValueType background = m_BackgroundValue;
+    auto isBackground = [this, background](size_t o) { return static_cast<InputValueType>(m_Input[o]) == background; };
+    return !isBackground(offset) && AnyNeighbor(x, y, z, true, isBackground);
+  }
+
+  /** Squared distances along X of the row starting at @p start to the sites of the row, infinite without sites */
+  void Sites(size_t start, size_t length, std::vector<double>& d) const
+  {
+    const double infinity = std::numeric_limits<double>::infinity();
+    const double spacing = m_Spacing[0];
+    double last = -1.0;
+    for(size_t i = 0; i < length; i++)
+    {
+      if(IsSite(start + i))
+      {
+        last = static_cast<double>(i);
+      }
+      d[i] = (last < 0.0) ? infinity : (static_cast<double>(i) - last) * spacing;
+    }
+    last = -1.0;
+    for(size_t i = length; i-- > 0;)
+    {
+      if(d[i] == 0.0)
+      {
+        last = static_cast<double>(i);
+      }
+      if(last >= 0.0)
+      {
+        d[i] = std::min(d[i], (last - static_cast<double>(i)) * spacing);
+      }
+      d[i] = d[i] * d[i];
+    }
+  }
+
+  /** d[q] = min over p of f[p] + (spacing (q - p))^2, skipping the infinite f. Returns false if all are infinite. */
+  static bool LowerEnvelope(const std::vector<double>& f, double spacing, std::vector<size_t>& v, std::vector<double>& z, std::vector<double>& d)
+  {
+    const size_t n = f.size();
+    const double infinity = std::numeric_limits<double>::infinity();
+    // Parabolas of the envelope: v[0..k), the one of v[j] being the lowest from z[j] to z[j + 1]
+    size_t k = 0;
+    for(size_t q = 0; q < n; q++)
+    {
+      if(std::isinf(f[q]))
+      {
+        continue;
+      }
+      const double pq = spacing * static_cast<double>(q);
+      double s = -infinity;
+      while(k > 0)
+      {
+        const double pv = spacing * static_cast<double>(v[k - 1]);
+        s = ((f[q] + pq * pq) - (f[v[k - 1]] + pv * pv)) / (2.0 * (pq - pv));
+        if(s > z[k - 1])
+        {
+          break;
+        }
+        k--;
+        s = -infinity;
+      }
+      v[k] = q;
+      z[k] = s;
+      z[k + 1] = infinity;
+      k++;
+    }
+    if(k == 0)
+    {
+      return false;
+    }
+    size_t j = 0;
+    for(size_t q = 0; q < n; q++)
+    {
+      const double pq = spacing * static_cast<double>(q);
+      while(z[j + 1] < pq)
+      {
+        j++;
+      }
+      const double delta = pq - spacing * static_cast<double>(v[j]);
+      d[q] = delta * delta + f[v[j]];
+    }
+    return true;
+  }
+
+  /** Turns the squared distances of pixels [@p first, @p last) into the final ones. In SignedObjects mode,
+   * m_Background holds the squared distances to the dilated background. */
+  void Finish(size_t first, size_t last) const
+  {
+    OutputPixelType* distance = m_Distance;
+    const OutputPixelType largest = NumericTraits<OutputPixelType>::max();
+    auto value = [this, largest](OutputPixelType squared) {
+      squared = std::isinf(squared) ? largest : squared;
+      return m_SquaredDistance ? squared : static_cast<OutputPixelType>(std::sqrt(static_cast<double>(squared)));
+    };
+    for(size_t i = first; i < last; i++)
+    {
+      const OutputPixelType d = value(distance[i]);
+      switch(m_Mode)
+      {
+      case Mode::SignedObjects:
+      {
+        // As the difference of two Danielsson distance maps
+        const OutputPixelType b = value(m_Background[i]);
+        distance[i] = m_InsideIsPositive ? (b - d) : (d - b);
+        break;
+      }
+      case Mode::SignedContour:
+      {
+        const bool inside = static_cast<InputValueType>(m_Input[i]) != m_BackgroundValue;
+        distance[i] = (inside != m_InsideIsPositive) ? -d : d;
+        break;
+      }
+      default:
+        distance[i] = d;
+        break;
+      }
+    }
+  }
+
+  ITK_DISALLOW_COPY_AND_ASSIGN(SeparableDistanceMapImageFilter);
+};
+} // end namespace itk
@@ -0,0 +1,418 @@
+/*
+ * Your License or Copyright can go here
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <itkImageRegionConstIterator.h>
+#include <itkImageScanlineIterator.h>
+#include <itkImageToImageFilter.h>
+#include <itkMinimumMaximumImageCalculator.h>
+#include <itkMultiThreader.h>
+#include <itkNumericTraits.h>
+#include <itkProgressReporter.h>
+
+namespace itk
+{
+/** \class TiledAdaptiveHistogramEqualizationImageFilter
+ * \brief Contrast limited adaptive histogram equalization computed on a grid of tiles, with the power law
+ * mapping of itk::AdaptiveHistogramEqualizationImageFilter.
+ *
+ * itk::AdaptiveHistogramEqualizationImageFilter maps every pixel through the histogram of the neighborhood
+ * of radius Radius around it, whose cost grows with the volume of the neighborhood. This filter instead cuts
+ * the image into tiles of 2 * Radius + 1 pixels along each axis and computes one mapping function per tile,
+ * from its histogram of NumberOfBins bins spanning the intensity range of the image (the tiles are processed
+ * in parallel). Each pixel is then mapped by the functions of the tiles whose centers surround it,
+ * interpolated linearly along each axis, as in CLAHE (Zuiderveld, "Contrast Limited Adaptive Histogram
+ * Equalization", Graphics Gems IV, 1994). The cost no longer depends on the radius.
+ *
+ * The mapping functions are those of the ITK filter for the parameters Alpha and Beta, sampled at the
+ * centers of the bins: Alpha = 0 and Beta = 0 give the histogram equalization, Alpha = 1 and Beta = 1 leave
+ * the image unchanged. When ClipLimit is not 0, the bins of a tile holding more than ClipLimit times the
+ * count of a uniform histogram are clipped, and their excess is spread over all the bins, which limits the
+ * amplification of the contrast in the uniform regions. ClipLimit must then be at least 1.
+ *
+ * The grid holds at most MaximumNumberOfTiles tiles (see ComputeTileSize()), which bounds the memory of the
+ * mapping functions whatever the radius. Each mapping function is computed from prefix sums of the tile
+ * histogram when Alpha is 0 or 1, and otherwise from the bins of the tile that are not empty.
+ *
+ * The filter requests the largest possible region of its input.
+ */
+template <typename TImage> class TiledAdaptiveHistogramEqualizationImageFilter : public ImageToImageFilter<TImage, TImage>
+{
+public:
+  typedef TiledAdaptiveHistogramEqualizationImageFilter Self;
+  typedef ImageToImageFilter<TImage, TImage> Superclass;
+  typedef SmartPointer<Self> Pointer;
+  typedef SmartPointer<const Self> ConstPointer;
+
+  itkNewMacro(Self);
+  itkTypeMacro(TiledAdaptiveHistogramEqualizationImageFilter, ImageToImageFilter);
+
+  typedef TImage ImageType;
+  typedef typename ImageType::PixelType PixelType;
+  typedef typename ImageType::RegionType RegionType;
+  typedef typename ImageType::IndexType IndexType;
+  typedef typename ImageType::SizeType SizeType;
+  typedef SizeType RadiusType;
+  typedef double RealType;
+
+  itkStaticConstMacro(ImageDimension, unsigned int, ImageType::ImageDimension);
+
+  /** Tiles are 2 * Radius + 1 pixels wide along each axis */
+  itkSetMacro(Radius, RadiusType);
+  itkGetConstReferenceMacro(Radius, RadiusType);
+
+  itkSetMacro(Alpha, float);
+  itkGetConstMacro(Alpha, float);
+
+  itkSetMacro(Beta, float);
+  itkGetConstMacro(Beta, float);
+
+  /** Maximum height of the bins of a tile, relative to a uniform histogram, 0 for no limit */
+  itkSetMacro(ClipLimit, float);
+  itkGetConstMacro(ClipLimit, float);
+
+  itkSetClampMacro(NumberOfBins, unsigned int, 2, NumericTraits<unsigned int>::max());
+  itkGetConstMacro(NumberOfBins, unsigned int);
+
+  /** Largest number of tiles of the grid; larger tiles than 2 * Radius + 1 are used beyond it */
+  itkSetClampMacro(MaximumNumberOfTiles, SizeValueType, 1, NumericTraits<SizeValueType>::max());
+  itkGetConstMacro(MaximumNumberOfTiles, SizeValueType);
+
+  /**
+   * Returns the size of the tiles of an image of size @p imageSize: 2 * @p radius + 1 pixels along each axis,
+   * doubled along the axis with the most tiles until the grid holds at most @p maximumNumberOfTiles tiles
+   */
+  static SizeType ComputeTileSize(const RadiusType& radius, const SizeType& imageSize, SizeValueType maximumNumberOfTiles)
+  {
+    SizeType tileSize;
+    for(unsigned int d = 0; d < ImageDimension; d++)
+    {
+      tileSize[d] = 2 * radius[d] + 1;
+    }
+    while(true)
+    {
+      SizeValueType numberOfTiles = 1;
+      SizeValueType most = 0;
+      unsigned int axis = 0;
+      for(unsigned int d = 0; d < ImageDimension; d++)
+      {
+        const SizeValueType tiles = (imageSize[d] + tileSize[d] - 1) / tileSize[d];
+        numberOfTiles *= tiles;
+        if(tiles > most)
+        {
+          most = tiles;
+          axis = d;
+        }
+      }
+      if(numberOfTiles <= maximumNumberOfTiles || most <= 1)
+      {
+        return tileSize;
+      }
+      tileSize[axis] *= 2;
+    }
+  }
+
+protected:
+  TiledAdaptiveHistogramEqualizationImageFilter()
+  : m_Alpha(0.3f)
+  , m_Beta(0.3f)
+  , m_ClipLimit(0.0f)
+  , m_NumberOfBins(256)
+  , m_MaximumNumberOfTiles(65536)
+  , m_Minimum(0.0)
+  , m_Range(0.0)
+  , m_NumberOfTilesTotal(0)
+  {
+    m_Radius.Fill(5);
+  }
+  ~TiledAdaptiveHistogramEqualizationImageFilter() override = default;
+
+  void GenerateInputRequestedRegion() override
+  {
+    Superclass::GenerateInputRequestedRegion();
+    ImageType* input = const_cast<ImageType*>(this->GetInput());
+    if(nullptr != input)
+    {
+      input->SetRequestedRegionToLargestPossibleRegion();
+    }
+  }
+
+  void BeforeThreadedGenerateData() override
+  {
+    if(m_ClipLimit != 0.0f && m_ClipLimit < 1.0f)
+    {
+      itkExceptionMacro(<< "The clip limit must be 0 or at least 1");
+    }
+    const ImageType* input = this->GetInput();
+    typedef MinimumMaximumImageCalculator<ImageType> CalculatorType;
+    typename CalculatorType::Pointer calculator = CalculatorType::New();
+    calculator->SetImage(input);
+    calculator->Compute();
+    m_Minimum = static_cast<RealType>(calculator->GetMinimum());
+    m_Range = static_cast<RealType>(calculator->GetMaximum()) - m_Minimum;
+
+    // Grid of tiles, and for each position along each axis the tile whose center is just below it
+    const RegionType& largest = input->GetLargestPossibleRegion();
+    m_TileSize = ComputeTileSize(m_Radius, largest.GetSize(), m_MaximumNumberOfTiles);
+    m_NumberOfTilesTotal = 1;
+    for(unsigned int d = 0; d < ImageDimension; d++)
+    {
+      m_NumberOfTiles[d] = (largest.GetSize(d) + m_TileSize[d] - 1) / m_TileSize[d];
+      m_TileStride[d] = m_NumberOfTilesTotal;
+      m_NumberOfTilesTotal *= m_NumberOfTiles[d];
+
+      const SizeValueType size = largest.GetSize(d);
+      m_LowerTile[d].resize(size);
+      m_UpperWeight[d].resize(size);
+      const RealType tileSize = static_cast<RealType>(m_TileSize[d]);
+      for(SizeValueType x = 0; x < size; x++)
+      {
+        const RealType position = (static_cast<RealType>(x) - 0.5 * (tileSize - 1.0)) / tileSize;
+        RealType lower = std::floor(position);
+        RealType weight = position - lower;
+        if(lower < 0.0)
+        {
+          lower = 0.0;
+          weight = 0.0;
+        }
+        else if(lower >= static_cast<RealType>(m_NumberOfTiles[d] - 1))
+        {
+          lower = static_cast<RealType>(m_NumberOfTiles[d] - 1);
+          weight = 0.0;
+        }
+        m_LowerTile[d][x] = static_cast<SizeValueType>(lower);
+        m_UpperWeight[d][x] = weight;
+      }
+    }
+
+    // Power term of the cumulative function of the ITK filter, which only depends on the difference between
+    // the two bins. It is only needed when Alpha is neither 0 nor 1.
+    const int bins = static_cast<int>(m_NumberOfBins);
+    m_Kernel.clear();
+    if(m_Alpha != 0.0f && m_Alpha != 1.0f)
+    {
+      m_Kernel.resize(2 * bins - 1);
+      for(int difference = 1 - bins; difference < bins; difference++)
+      {
+        const RealType s = (difference > 0) ? 1.0 : ((difference < 0) ? -1.0 : 0.0);
+        const RealType ad = std::abs(2.0 * static_cast<RealType>(difference) / static_cast<RealType>(bins));
+        m_Kernel[difference + bins - 1] = 0.5 * s * std::pow(ad, static_cast<RealType>(m_Alpha));
+      }
+    }
+
+    m_Mappings.assign(m_NumberOfTilesTotal * m_NumberOfBins, 0.0);
+    if(m_Range > 0.0)
+    {
+      this->GetMultiThreader()->SetNumberOfThreads(this->GetNumberOfThreads());
+      this->GetMultiThreader()->SetSingleMethod(Self::TilesThreaderCallback, this);
+      this->GetMultiThreader()->SingleMethodExecute();
+    }
+  }
+
+  void ThreadedGenerateData(const RegionType& outputRegionForThread, ThreadIdType threadId) override
+  {
+    const ImageType* input = this->GetInput();
+    ImageType* output = this->GetOutput();
+    const IndexType start = input->GetLargestPossibleRegion().GetIndex();
+    ProgressReporter progress(this, threadId, outputRegionForThread.GetNumberOfPixels() / outputRegionForThread.GetSize(0));
+
+    const RealType lowest = static_cast<RealType>(NumericTraits<PixelType>::NonpositiveMin());
+    const RealType highest = static_cast<RealType>(NumericTraits<PixelType>::max());
+    const RealType bins = static_cast<RealType>(m_NumberOfBins);
+    ImageRegionConstIterator<ImageType> in(input, outputRegionForThread);
+    ImageScanlineIterator<ImageType> out(output, outputRegionForThread);
+    while(!out.IsAtEnd())
+    {
+      while(!out.IsAtEndOfLine())
+      {
+        if(m_Range <= 0.0)
+        {
+          out.Set(in.Get());
+          ++in;
+          ++out;
+          continue;
+        }
+        const IndexType index = out.GetIndex();
+        const RealType u = (static_cast<RealType>(in.Get()) - m_Minimum) / m_Range - 0.5;
+        const RealType bin = std::min(std::max((u + 0.5) * bins - 0.5, 0.0), bins - 1.0);
+        const unsigned int lowerBin = std::min(static_cast<unsigned int>(bin), m_NumberOfBins - 2);
+        const RealType binWeight = bin - static_cast<RealType>(lowerBin);
+
+        RealType value = 0.0;
+        for(unsigned int corner = 0; corner < (1u << ImageDimension); corner++)
+        {
+          RealType weight = 1.0;
+          SizeValueType tile = 0;
+          for(unsigned int d = 0; d < ImageDimension; d++)
+          {
+            const SizeValueType x = static_cast<SizeValueType>(index[d] - start[d]);
+            const bool upper = (corner >> d) & 1u;
+            weight *= upper ? m_UpperWeight[d][x] : 1.0 - m_UpperWeight[d][x];
+            tile += (m_LowerTile[d][x] + (upper ? 1 : 0)) * m_TileStride[d];
+          }
+          if(weight > 0.0)
+          {
+            const RealType* mapping = &m_Mappings[tile * m_NumberOfBins];
+            value += weight * (mapping[lowerBin] + binWeight * (mapping[lowerBin + 1] - mapping[lowerBin]));
+          }
+        }
+        // Back to the intensity range of the input, as done by the ITK filter
+        value = m_Range * (value + 0.5) + m_Minimum;
+        out.Set(static_cast<PixelType>(std::min(std::max(value, lowest), highest)));
+        ++in;
+        ++out;
+      }
+      out.NextLine();
+      progress.CompletedPixel();
+    }
+  }
+
+private:
+  RadiusType m_Radius;
+  float m_Alpha;
+  float m_Beta;
+  float m_ClipLimit;
+  unsigned int m_NumberOfBins;
+  SizeValueType m_MaximumNumberOfTiles;
+
+  // State computed before the threads run
+  RealType m_Minimum;
+  RealType m_Range;
+  SizeType m_TileSize;
+  SizeType m_NumberOfTiles;
+  SizeType m_TileStride;
+  SizeValueType m_NumberOfTilesTotal;
+  std::vector<SizeValueType> m_LowerTile[ImageDimension];
+  std::vector<RealType> m_UpperWeight[ImageDimension];
+  std::vector<RealType> m_Kernel;
+  std::vector<RealType> m_Mappings;
+
+  /** Computes the mapping functions of every NumberOfThreads-th tile, starting at the tile of the thread */
+  static ITK_THREAD_RETURN_TYPE TilesThreaderCallback(void* arg)
+  {
+    MultiThreader::ThreadInfoStruct* info = static_cast<MultiThreader::ThreadInfoStruct*>(arg);
+    Self* filter = static_cast<Self*>(info->UserData);
+    std::vector<RealType> histogram(filter->m_NumberOfBins);
+    for(SizeValueType tile = info->ThreadID; tile < filter->m_NumberOfTilesTotal; tile += info->NumberOfThreads)
+    {
+      filter->ComputeMapping(tile, histogram);
+    }
+    return ITK_THREAD_RETURN_VALUE;
+  }
+
+  /** Fills the mapping function of @p tile, @p histogram being the buffer of the thread */
+  void ComputeMapping(SizeValueType tile, std::vector<RealType>& histogram)
+  {
+    const ImageType* input = this->GetInput();
+    const RegionType& largest = input->GetLargestPossibleRegion();
+    RegionType region;
+    for(unsigned int d = 0; d < ImageDimension; d++)
+    {
+      const SizeValueType position = (tile / m_TileStride[d]) % m_NumberOfTiles[d];
+      const SizeValueType first = position * m_TileSize[d];
+      region.SetIndex(d, largest.GetIndex(d) + static_cast<IndexValueType>(first));
+      region.SetSize(d, std::min(m_TileSize[d], largest.GetSize(d) - first));
+    }
+
+    const unsigned int bins = m_NumberOfBins;
+    std::fill(histogram.begin(), histogram.end(), 0.0);
+    const RealType scale = static_cast<RealType>(bins) / m_Range;
+    for(ImageRegionConstIterator<ImageType> it(input, region); !it.IsAtEnd(); ++it)
+    {
+      const RealType bin = (static_cast<RealType>(it.Get()) - m_Minimum) * scale;
+      histogram[std::min(static_cast<unsigned int>(std::max(bin, 0.0)), bins - 1)] += 1.0;
+    }
+    const RealType count = static_cast<RealType>(region.GetNumberOfPixels());
+    for(unsigned int b = 0; b < bins; b++)
+    {
+      histogram[b] /= count;
+    }
+
+    if(m_ClipLimit > 0.0f)
+    {
+      // The excess is spread uniformly, which can push bins over the limit again: repeat until it vanishes
+      const RealType limit = static_cast<RealType>(m_ClipLimit) / static_cast<RealType>(bins);
+      for(unsigned int pass = 0; pass < 16; pass++)
+      {
+        RealType excess = 0.0;
+        for(unsigned int b = 0; b < bins; b++)
+        {
+          if(histogram[b] > limit)
+          {
+            excess += histogram[b] - limit;
+            histogram[b] = limit;
+          }
+        }
+        if(excess < 1e-6)
+        {
+          break;
+        }
+        const RealType share = excess / static_cast<RealType>(bins);
+        for(unsigned int b = 0; b < bins; b++)
+        {
+          histogram[b] += share;
+        }
+      }
+    }
+
+    // The cumulative function of the ITK filter, summed over the histogram, is
+    //   Beta * u + sum_c h[c] * (0.5 * sign(b - c) * |2 (b - c) / bins|^Alpha - Beta * (b - c) / bins)
+    // Its Beta term only needs the mass and the first moment of the histogram. With Alpha = 0 the power
+    // term is half the mass below b minus the mass above it, read from the prefix sums of the histogram;
+    // with Alpha = 1 it is linear like the Beta term. Other values convolve the bins that are not empty.
+    RealType mass = 0.0;
+    RealType moment = 0.0;
+    for(unsigned int c = 0; c < bins; c++)
+    {
+      mass += histogram[c];
+      moment += histogram[c] * static_cast<RealType>(c);
+    }
+    const RealType binsReal = static_cast<RealType>(bins);
+    const RealType alpha = static_cast<RealType>(m_Alpha);
+    const RealType linearWeight = ((alpha == 1.0) ? 1.0 : 0.0) - static_cast<RealType>(m_Beta);
+    std::vector<unsigned int> nonEmpty;
+    if(!m_Kernel.empty())
+    {
+      for(unsigned int c = 0; c < bins; c++)
+      {
+        if(histogram[c] > 0.0)
+        {
+          nonEmpty.push_back(c);
+        }
+      }
+    }
+
+    RealType* mapping = &m_Mappings[tile * bins];
+    RealType below = 0.0;
+    for(unsigned int b = 0; b < bins; b++)
+    {
+      const RealType u = (static_cast<RealType>(b) + 0.5) / binsReal - 0.5;
+      RealType sum = m_Beta * u + linearWeight * (static_cast<RealType>(b) * mass - moment) / binsReal;
+      if(alpha == 0.0)
+      {
+        sum += 0.5 * (below - (mass - below - histogram[b]));
+      }
+      else if(!m_Kernel.empty())
+      {
+        const RealType* kernel = &m_Kernel[b + bins - 1];
+        for(unsigned int c : nonEmpty)
+        {
+          sum += histogram[c] * kernel[-static_cast<int>(c)];
+        }
+      }
+      mapping[b] = sum;
+      below += histogram[b];
+    }
+  }
+
+public:
+  TiledAdaptiveHistogramEqualizationImageFilter(const Self&) = delete;
+  void operator=(const Self&) = delete;
+};
+} // namespace itk
@@ -84,6 +84,45 @@ int TestITKAbsImageshortTest()
 }
 
 
+int TestITKAbsImageInPlaceTest()
+{
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Slice-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    IDataArray::Pointer inputArray = containerArray->getAttributeMatrix(input_path)->getAttributeArray(input_path.getDataArrayName());
+    DREAM3D_REQUIRE_NE(inputArray.get(), 0);
+    void* inputBuffer = inputArray->getVoidPointer(0);
+    QString filtName = "ITKAbsImage";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(input_path);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(false);
+    propWasSet = filter->setProperty("SaveAsNewArray", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    // Same input and output type: the filter must have written into the original array
+    IDataArray::Pointer outputArray = containerArray->getAttributeMatrix(input_path)->getAttributeArray(input_path.getDataArrayName());
+    DREAM3D_REQUIRE_EQUAL(outputArray.get(), inputArray.get());
+    DREAM3D_REQUIRE_EQUAL(outputArray->getVoidPointer(0), inputBuffer);
+    QString baseline_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Baseline/BasicFilters_AbsImageFilter_short.nrrd");
+    DataArrayPath baseline_path("BContainer", "BAttributeMatrixName", "BAttributeArrayName");
+    this->ReadImage(baseline_filename, containerArray, baseline_path);
+    int res = this->CompareImages(containerArray, input_path, baseline_path, 0.01);
+    DREAM3D_REQUIRE_EQUAL(res, 0);
+    return 0;
+}
+
+
 
   // -----------------------------------------------------------------------------
   //
@@ -96,6 +135,7 @@ int TestITKAbsImageshortTest()
 
     DREAM3D_REGISTER_TEST( TestITKAbsImagefloatTest());
     DREAM3D_REGISTER_TEST( TestITKAbsImageshortTest());
+    DREAM3D_REGISTER_TEST( TestITKAbsImageInPlaceTest());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
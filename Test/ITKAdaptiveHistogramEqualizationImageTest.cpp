@@ -10,6 +10,7 @@
 #include <SIMPLib/FilterParameters/FloatFilterParameter.h>
 #include <SIMPLib/FilterParameters/FloatVec3FilterParameter.h>
 
+#include "ITKImageProcessing/ITKImageProcessingFilters/itkTiledAdaptiveHistogramEqualizationImageFilter.h"
 
 class ITKAdaptiveHistogramEqualizationImageTest : public ITKTestBase
 {
@@ -101,6 +102,89 @@ int TestITKAdaptiveHistogramEqualizationImagehistoTest()
 }
 
 
+int TestITKAdaptiveHistogramEqualizationImageTiledTest()
+{
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/cthead1.png");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    // Alpha = 1 and Beta = 1 leave the image unchanged, up to the rounding of the bins
+    QVariantMap properties;
+    properties["SelectedCellArrayPath"] = QVariant::fromValue(input_path);
+    properties["SaveAsNewArray"] = true;
+    properties["NewCellArrayName"] = QString("Identity");
+    properties["TiledInterpolation"] = true;
+    properties["Alpha"] = 1.0f;
+    properties["Beta"] = 1.0f;
+    properties["ClipLimit"] = 0.0f;
+    AbstractFilter::Pointer filter = CreateFilter("ITKAdaptiveHistogramEqualizationImage", properties);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    int res = this->CompareImages(containerArray, DataArrayPath("TestContainer", "TestAttributeMatrixName", "Identity"), input_path, 1.0);
+    DREAM3D_REQUIRE_EQUAL(res, 0);
+
+    // The tiles do not depend on the threads
+    QVariant var;
+    var.setValue(0.0f);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("Alpha", var), true);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("Beta", var), true);
+    var.setValue(3.0f);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("ClipLimit", var), true);
+    var.setValue(QString("OneThread"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("NewCellArrayName", var), true);
+    var.setValue(1);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("NumberOfThreads", var), true);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    var.setValue(QString("FourThreads"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("NewCellArrayName", var), true);
+    var.setValue(4);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("NumberOfThreads", var), true);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    QString md5OneThread;
+    GetMD5FromDataContainer(containerArray, DataArrayPath("TestContainer", "TestAttributeMatrixName", "OneThread"), md5OneThread);
+    QString md5FourThreads;
+    GetMD5FromDataContainer(containerArray, DataArrayPath("TestContainer", "TestAttributeMatrixName", "FourThreads"), md5FourThreads);
+    DREAM3D_REQUIRE_EQUAL(md5FourThreads, md5OneThread);
+    QString md5Input;
+    GetMD5FromDataContainer(containerArray, input_path, md5Input);
+    DREAM3D_REQUIRE_NE(md5OneThread, md5Input);
+
+    // Clip limits below the uniform histogram cannot be reached
+    var.setValue(QString("Invalid"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("NewCellArrayName", var), true);
+    var.setValue(0.5f);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("ClipLimit", var), true);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -55620);
+
+    // The grid of tiles is capped: the tiles grow along the axes with the most tiles
+    typedef itk::TiledAdaptiveHistogramEqualizationImageFilter<itk::Image<float, 3>> TiledFilterType;
+    TiledFilterType::RadiusType radius;
+    radius.Fill(0);
+    TiledFilterType::SizeType imageSize;
+    imageSize[0] = 1000;
+    imageSize[1] = 1000;
+    imageSize[2] = 10;
+    TiledFilterType::SizeType tileSize = TiledFilterType::ComputeTileSize(radius, imageSize, 4096);
+    size_t numberOfTiles = 1;
+    for(unsigned int d = 0; d < 3; d++)
+    {
+      numberOfTiles *= (imageSize[d] + tileSize[d] - 1) / tileSize[d];
+    }
+    DREAM3D_REQUIRED(numberOfTiles, <=, 4096);
+    DREAM3D_REQUIRE_EQUAL(tileSize[0], tileSize[1]);
+    // 91 x 91 x 1 tiles of 11 pixels: only the two large axes are enlarged
+    radius.Fill(5);
+    tileSize = TiledFilterType::ComputeTileSize(radius, imageSize, 4096);
+    DREAM3D_REQUIRE_EQUAL(tileSize[0], 22);
+    DREAM3D_REQUIRE_EQUAL(tileSize[1], 22);
+    DREAM3D_REQUIRE_EQUAL(tileSize[2], 11);
+    return 0;
+}
+
 
   // -----------------------------------------------------------------------------
   //
@@ -113,6 +197,7 @@ int TestITKAdaptiveHistogramEqualizationImagehistoTest()
 
     DREAM3D_REGISTER_TEST( TestITKAdaptiveHistogramEqualizationImagedefaultsTest());
     DREAM3D_REGISTER_TEST( TestITKAdaptiveHistogramEqualizationImagehistoTest());
+    DREAM3D_REGISTER_TEST( TestITKAdaptiveHistogramEqualizationImageTiledTest());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
@@ -4,10 +4,15 @@
 // Insert your license & copyright information here
 // -----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cmath>
+
 #include "ITKTestBase.h"
 // Auto includes
 #include <SIMPLib/FilterParameters/BooleanFilterParameter.h>
 
+#include <itkDanielssonDistanceMapImageFilter.h>
+
 
 class ITKDanielssonDistanceMapImageTest : public ITKTestBase
 {
@@ -54,6 +59,74 @@ public:
 
 
 
+  // -----------------------------------------------------------------------------
+  // Runs the filter and itk::DanielssonDistanceMapImageFilter on 2th_cthead1 with an anisotropic spacing. The filter computes
+  // exact distances, which differ from the ITK ones by 1% at most where its vector propagation is approximate.
+  // -----------------------------------------------------------------------------
+  int CompareWithITKFilter(bool squaredDistance, bool useImageSpacing)
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/2th_cthead1.png");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    containerArray->getDataContainer(input_path.getDataContainerName())->getGeometryAs<ImageGeom>()->setResolution(1.0f, 2.5f, 1.0f);
+
+    QVariantMap properties;
+    properties["SelectedCellArrayPath"] = QVariant::fromValue(input_path);
+    properties["SaveAsNewArray"] = true;
+    properties["NewCellArrayName"] = QString("Distance");
+    properties["SquaredDistance"] = squaredDistance;
+    properties["UseImageSpacing"] = useImageSpacing;
+    AbstractFilter::Pointer filter = CreateFilter("ITKDanielssonDistanceMapImage", properties);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+
+    typedef itk::InPlaceDream3DDataToImageFilter<uint8_t, 2> ToITKType;
+    typedef itk::DanielssonDistanceMapImageFilter<itk::Dream3DImage<uint8_t, 2>, itk::Image<float, 2>> FilterType;
+    ToITKType::Pointer toITK = ToITKType::New();
+    toITK->SetInput(containerArray->getDataContainer(input_path.getDataContainerName()));
+    toITK->SetAttributeMatrixArrayName(input_path.getAttributeMatrixName().toStdString());
+    toITK->SetDataArrayName(input_path.getDataArrayName().toStdString());
+    toITK->SetInPlace(true);
+    FilterType::Pointer itkFilter = FilterType::New();
+    itkFilter->SetInput(toITK->GetOutput());
+    itkFilter->SetSquaredDistance(squaredDistance);
+    itkFilter->SetUseImageSpacing(useImageSpacing);
+    itkFilter->Update();
+
+    FloatArrayType::Pointer distance = std::dynamic_pointer_cast<FloatArrayType>(containerArray->getAttributeMatrix(input_path)->getAttributeArray("Distance"));
+    DREAM3D_REQUIRE_VALID_POINTER(distance.get());
+    const float* expected = itkFilter->GetOutput()->GetBufferPointer();
+    DREAM3D_REQUIRE_EQUAL(itkFilter->GetOutput()->GetBufferedRegion().GetNumberOfPixels(), distance->getNumberOfTuples());
+    for(size_t i = 0; i < distance->getNumberOfTuples(); i++)
+    {
+      // Squared distances are compared through their square roots
+      double value = distance->getValue(i);
+      double reference = expected[i];
+      if(squaredDistance)
+      {
+        value = std::copysign(std::sqrt(std::fabs(value)), value);
+        reference = std::copysign(std::sqrt(std::fabs(reference)), reference);
+      }
+      DREAM3D_REQUIRE(std::fabs(value - reference) <= 0.01 * std::max(1.0, std::fabs(reference)));
+    }
+    return 0;
+  }
+
+  int TestITKDanielssonDistanceMapImageCompareWithITKTest()
+  {
+    for(bool squaredDistance : {false, true})
+    {
+      for(bool useImageSpacing : {false, true})
+      {
+        DREAM3D_REQUIRE_EQUAL(CompareWithITKFilter(squaredDistance, useImageSpacing), 0);
+      }
+    }
+    return 0;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -64,6 +137,7 @@ public:
     DREAM3D_REGISTER_TEST(this->TestFilterAvailability("ITKDanielssonDistanceMapImage"));
 
     DREAM3D_REGISTER_TEST( TestITKDanielssonDistanceMapImagedefaultTest());
+    DREAM3D_REGISTER_TEST(TestITKDanielssonDistanceMapImageCompareWithITKTest());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
@@ -0,0 +1,140 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKTestBase.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKFilterScheduler.h"
+
+class ITKFilterSchedulerTest : public ITKTestBase
+{
+
+public:
+  ITKFilterSchedulerTest()
+  {
+  }
+  virtual ~ITKFilterSchedulerTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  // Two independent chains: Median then Abs on the first container, Abs then Median on the second one
+  // -----------------------------------------------------------------------------
+  ITKFilterScheduler::FilterList CreateFilters(DataContainerArray::Pointer containerArray)
+  {
+    DataArrayPath first_path("FirstContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataArrayPath second_path("SecondContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataArrayPath first_output("FirstContainer", "TestAttributeMatrixName", "Output");
+    const QStringList filtNames = {"ITKMedianImage", "ITKAbsImage", "ITKAbsImage", "ITKMedianImage"};
+    const QVector<DataArrayPath> inputPaths = {first_path, second_path, first_output, second_path};
+    const QVector<bool> saveAsNewArray = {true, false, false, true};
+    ITKFilterScheduler::FilterList filters;
+    for(int i = 0; i < filtNames.size(); i++)
+    {
+      QVariantMap properties;
+      properties["SelectedCellArrayPath"] = QVariant::fromValue(inputPaths[i]);
+      properties["SaveAsNewArray"] = saveAsNewArray[i];
+      properties["NewCellArrayName"] = QString("Output");
+      ITKImageProcessingBase::Pointer filter = std::dynamic_pointer_cast<ITKImageProcessingBase>(CreateFilter(filtNames[i], properties));
+      DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+      filter->setDataContainerArray(containerArray);
+      filters.push_back(filter);
+    }
+    return filters;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer ReadImages()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, DataArrayPath("FirstContainer", "TestAttributeMatrixName", "TestAttributeArrayName"));
+    this->ReadImage(input_filename, containerArray, DataArrayPath("SecondContainer", "TestAttributeMatrixName", "TestAttributeArrayName"));
+    return containerArray;
+  }
+
+  int TestITKFilterSchedulerDependenciesTest()
+  {
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    ITKFilterScheduler::FilterList filters = CreateFilters(containerArray);
+    for(const ITKImageProcessingBase::Pointer& filter : filters)
+    {
+      DREAM3D_REQUIRE_NE(filter.get(), 0);
+    }
+    ITKFilterScheduler scheduler(filters);
+    DREAM3D_REQUIRE_EQUAL(scheduler.getDependencies(0).size(), 0);
+    DREAM3D_REQUIRE_EQUAL(scheduler.getDependencies(1).size(), 0);
+    DREAM3D_REQUIRE_EQUAL(scheduler.getDependencies(2).size(), 1);
+    DREAM3D_REQUIRE_EQUAL(scheduler.getDependencies(2)[0], 0);
+    DREAM3D_REQUIRE_EQUAL(scheduler.getDependencies(3).size(), 1);
+    DREAM3D_REQUIRE_EQUAL(scheduler.getDependencies(3)[0], 1);
+    return 0;
+  }
+
+  int TestITKFilterSchedulerMatchesSequentialTest()
+  {
+    DataArrayPath first_output("FirstContainer", "TestAttributeMatrixName", "Output");
+    DataArrayPath second_output("SecondContainer", "TestAttributeMatrixName", "Output");
+
+    DataContainerArray::Pointer sequentialArray = ReadImages();
+    ITKFilterScheduler::FilterList sequentialFilters = CreateFilters(sequentialArray);
+    for(const ITKImageProcessingBase::Pointer& filter : sequentialFilters)
+    {
+      DREAM3D_REQUIRE_NE(filter.get(), 0);
+      filter->execute();
+      DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+      DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    }
+    QString md5FirstSequential;
+    GetMD5FromDataContainer(sequentialArray, first_output, md5FirstSequential);
+    QString md5SecondSequential;
+    GetMD5FromDataContainer(sequentialArray, second_output, md5SecondSequential);
+
+    DataContainerArray::Pointer containerArray = ReadImages();
+    ITKFilterScheduler scheduler(CreateFilters(containerArray));
+    DREAM3D_REQUIRE_EQUAL(scheduler.execute(2), 0);
+    DREAM3D_REQUIRE_EQUAL(scheduler.getFailedFilter(), -1);
+    QString md5First;
+    GetMD5FromDataContainer(containerArray, first_output, md5First);
+    DREAM3D_REQUIRE_EQUAL(md5First, md5FirstSequential);
+    QString md5Second;
+    GetMD5FromDataContainer(containerArray, second_output, md5Second);
+    DREAM3D_REQUIRE_EQUAL(md5Second, md5SecondSequential);
+    return 0;
+  }
+
+  int TestITKFilterSchedulerFailureTest()
+  {
+    DataContainerArray::Pointer containerArray = ReadImages();
+    ITKFilterScheduler::FilterList filters = CreateFilters(containerArray);
+    // The second filter reads an array that does not exist
+    filters[1]->setSelectedCellArrayPath(DataArrayPath("SecondContainer", "TestAttributeMatrixName", "Missing"));
+    ITKFilterScheduler scheduler(filters);
+    DREAM3D_REQUIRED(scheduler.execute(2), <, 0);
+    DREAM3D_REQUIRE_EQUAL(scheduler.getFailedFilter(), 1);
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()() override
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestITKFilterSchedulerDependenciesTest());
+    DREAM3D_REGISTER_TEST(TestITKFilterSchedulerMatchesSequentialTest());
+    DREAM3D_REGISTER_TEST(TestITKFilterSchedulerFailureTest());
+
+    if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
+    {
+      DREAM3D_REGISTER_TEST(this->RemoveTestFiles())
+    }
+  }
+
+private:
+  ITKFilterSchedulerTest(const ITKFilterSchedulerTest&); // Copy Constructor Not Implemented
+  void operator=(const ITKFilterSchedulerTest&);         // Move assignment Not Implemented
+};
@@ -0,0 +1,205 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+
+#include "ITKTestBase.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKFusedPipelineImage.h"
+
+class ITKFusedPipelineImageTest : public ITKTestBase
+{
+
+public:
+  ITKFusedPipelineImageTest()
+  {
+  }
+  virtual ~ITKFusedPipelineImageTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int RunSequential(DataContainerArray::Pointer containerArray, const DataArrayPath& input_path)
+  {
+    QStringList filtNames = {"ITKMedianImage", "ITKAbsImage"};
+    for(const QString& filtName : filtNames)
+    {
+      QVariantMap properties;
+      properties["SelectedCellArrayPath"] = QVariant::fromValue(input_path);
+      properties["SaveAsNewArray"] = false;
+      AbstractFilter::Pointer filter = CreateFilter(filtName, properties);
+      filter->setDataContainerArray(containerArray);
+      filter->execute();
+      DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+      DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    }
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  ITKFusedPipelineImage::Pointer CreateFusedFilter(const DataArrayPath& input_path, bool saveAsNewArray)
+  {
+    ITKFusedPipelineImage::Pointer fused = ITKFusedPipelineImage::New();
+    fused->appendStage(std::dynamic_pointer_cast<ITKImageProcessingBase>(CreateFilter("ITKMedianImage")));
+    fused->appendStage(std::dynamic_pointer_cast<ITKImageProcessingBase>(CreateFilter("ITKAbsImage")));
+    fused->setSelectedCellArrayPath(input_path);
+    fused->setSaveAsNewArray(saveAsNewArray);
+    fused->setNewCellArrayName("FusedOutput");
+    return fused;
+  }
+
+  int TestITKFusedPipelineImageMatchesSequentialTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer sequentialArray = DataContainerArray::New();
+    this->ReadImage(input_filename, sequentialArray, input_path);
+    DREAM3D_REQUIRE_EQUAL(RunSequential(sequentialArray, input_path), 0);
+    QString md5Sequential;
+    GetMD5FromDataContainer(sequentialArray, input_path, md5Sequential);
+
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    ITKFusedPipelineImage::Pointer fused = CreateFusedFilter(input_path, false);
+    DREAM3D_REQUIRE_EQUAL(QJsonDocument::fromJson(fused->getStageDescriptions().toUtf8()).array().size(), 2);
+    fused->setDataContainerArray(containerArray);
+    fused->execute();
+    DREAM3D_REQUIRED(fused->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(fused->getWarningCondition(), >=, 0);
+    WriteImage("ITKFusedPipelineImageMatchesSequential.nrrd", containerArray, input_path);
+    QString md5Output;
+    GetMD5FromDataContainer(containerArray, input_path, md5Output);
+    DREAM3D_REQUIRE_EQUAL(md5Output, md5Sequential);
+    // Only the input array (now replaced by the output) is left in the Attribute Matrix
+    AttributeMatrix::Pointer am = containerArray->getAttributeMatrix(input_path);
+    DREAM3D_REQUIRE_EQUAL(am->getAttributeArrayNames().size(), 1);
+    return 0;
+  }
+
+  int TestITKFusedPipelineImageNewArrayTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer sequentialArray = DataContainerArray::New();
+    this->ReadImage(input_filename, sequentialArray, input_path);
+    DREAM3D_REQUIRE_EQUAL(RunSequential(sequentialArray, input_path), 0);
+    QString md5Sequential;
+    GetMD5FromDataContainer(sequentialArray, input_path, md5Sequential);
+
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    ITKFusedPipelineImage::Pointer fused = CreateFusedFilter(input_path, true);
+    fused->setDataContainerArray(containerArray);
+    // The stages are only known once the filter is checked
+    DREAM3D_REQUIRE_EQUAL(fused->canRunConcurrently(), false);
+    DREAM3D_REQUIRE_EQUAL(fused->isStreamable(), false);
+    fused->preflight();
+    DREAM3D_REQUIRED(fused->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRE_EQUAL(fused->canRunConcurrently(), true);
+    DREAM3D_REQUIRE_EQUAL(fused->isStreamable(), true);
+    fused->execute();
+    DREAM3D_REQUIRED(fused->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(fused->getWarningCondition(), >=, 0);
+    DataArrayPath output_path("TestContainer", "TestAttributeMatrixName", "FusedOutput");
+    QString md5Output;
+    GetMD5FromDataContainer(containerArray, output_path, md5Output);
+    DREAM3D_REQUIRE_EQUAL(md5Output, md5Sequential);
+    AttributeMatrix::Pointer am = containerArray->getAttributeMatrix(input_path);
+    DREAM3D_REQUIRE_EQUAL(am->getAttributeArrayNames().size(), 2);
+    return 0;
+  }
+
+  int TestITKFusedPipelineImageNoStageTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    ITKFusedPipelineImage::Pointer fused = ITKFusedPipelineImage::New();
+    fused->setSelectedCellArrayPath(input_path);
+    fused->setDataContainerArray(containerArray);
+    fused->preflight();
+    DREAM3D_REQUIRE_EQUAL(fused->getErrorCondition(), -55570);
+    return 0;
+  }
+
+  int TestITKFusedPipelineImageStageDescriptionsTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer sequentialArray = DataContainerArray::New();
+    this->ReadImage(input_filename, sequentialArray, input_path);
+    DREAM3D_REQUIRE_EQUAL(RunSequential(sequentialArray, input_path), 0);
+    QString md5Sequential;
+    GetMD5FromDataContainer(sequentialArray, input_path, md5Sequential);
+
+    // The stages are set as text, the way they are read from a pipeline file or set from Python
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    QVariantMap properties;
+    properties["SelectedCellArrayPath"] = QVariant::fromValue(input_path);
+    properties["SaveAsNewArray"] = false;
+    properties["StageDescriptions"] = QString("[{\"Filter\": \"ITKMedianImage\", \"Parameters\": {\"Radius\": {\"x\": 1, \"y\": 1, \"z\": 1}}},"
+                                              " {\"Filter\": \"ITKAbsImage\"}]");
+    AbstractFilter::Pointer filter = CreateFilter("ITKFusedPipelineImage", properties);
+    // A copy of the filter gets the same stages
+    filter = filter->newFilterInstance(true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    QString md5Output;
+    GetMD5FromDataContainer(containerArray, input_path, md5Output);
+    DREAM3D_REQUIRE_EQUAL(md5Output, md5Sequential);
+    return 0;
+  }
+
+  int TestITKFusedPipelineImageInvalidStageTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    ITKFusedPipelineImage::Pointer fused = ITKFusedPipelineImage::New();
+    fused->setSelectedCellArrayPath(input_path);
+    fused->setDataContainerArray(containerArray);
+    fused->setStageDescriptions("{\"Filter\": \"ITKMedianImage\"}");
+    fused->preflight();
+    DREAM3D_REQUIRE_EQUAL(fused->getErrorCondition(), -55573);
+    fused->setStageDescriptions("[{\"Filter\": \"DataContainerReader\"}]");
+    fused->preflight();
+    DREAM3D_REQUIRE_EQUAL(fused->getErrorCondition(), -55574);
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()() override
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(this->TestFilterAvailability("ITKFusedPipelineImage"));
+
+    DREAM3D_REGISTER_TEST(TestITKFusedPipelineImageMatchesSequentialTest());
+    DREAM3D_REGISTER_TEST(TestITKFusedPipelineImageNewArrayTest());
+    DREAM3D_REGISTER_TEST(TestITKFusedPipelineImageNoStageTest());
+    DREAM3D_REGISTER_TEST(TestITKFusedPipelineImageStageDescriptionsTest());
+    DREAM3D_REGISTER_TEST(TestITKFusedPipelineImageInvalidStageTest());
+
+    if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
+    {
+      DREAM3D_REGISTER_TEST(this->RemoveTestFiles())
+    }
+  }
+
+private:
+  ITKFusedPipelineImageTest(const ITKFusedPipelineImageTest&); // Copy Constructor Not Implemented
+  void operator=(const ITKFusedPipelineImageTest&);            // Move assignment Not Implemented
+};
@@ -8,6 +8,9 @@
 // Auto includes
 #include <SIMPLib/FilterParameters/DoubleFilterParameter.h>
 
+#include <itkCastImageFilter.h>
+#include <itkGradientAnisotropicDiffusionImageFilter.h>
+
 
 class ITKGradientAnisotropicDiffusionImageTest : public ITKTestBase
 {
@@ -106,6 +109,96 @@ int TestITKGradientAnisotropicDiffusionImagelongerTest()
 }
 
 
+  // -----------------------------------------------------------------------------
+  // Runs the ITK filter on the short input cast to double, as the filter did before its ping-pong engine
+  // -----------------------------------------------------------------------------
+  template <unsigned int Dimension> int CompareWithITKFilter(DataContainerArray::Pointer containerArray, const DataArrayPath& input_path, const DataArrayPath& output_path)
+  {
+    typedef itk::Dream3DImage<short, Dimension> ShortImageType;
+    typedef itk::Image<double, Dimension> RealImageType;
+    typedef itk::InPlaceDream3DDataToImageFilter<short, Dimension> toITKType;
+    typename toITKType::Pointer toITK = toITKType::New();
+    toITK->SetInput(containerArray->getDataContainer(input_path.getDataContainerName()));
+    toITK->SetInPlace(true);
+    toITK->SetAttributeMatrixArrayName(input_path.getAttributeMatrixName().toStdString());
+    toITK->SetDataArrayName(input_path.getDataArrayName().toStdString());
+    typedef itk::CastImageFilter<ShortImageType, RealImageType> CasterToType;
+    typename CasterToType::Pointer casterTo = CasterToType::New();
+    casterTo->SetInput(toITK->GetOutput());
+    typedef itk::GradientAnisotropicDiffusionImageFilter<RealImageType, RealImageType> FilterType;
+    typename FilterType::Pointer filter = FilterType::New();
+    filter->SetInput(casterTo->GetOutput());
+    filter->SetTimeStep(0.01);
+    filter->SetConductanceParameter(3.0);
+    filter->SetConductanceScalingUpdateInterval(1);
+    filter->SetNumberOfIterations(5);
+    typedef itk::CastImageFilter<RealImageType, ShortImageType> CasterFromType;
+    typename CasterFromType::Pointer casterFrom = CasterFromType::New();
+    casterFrom->SetInput(filter->GetOutput());
+    casterFrom->Update();
+
+    Int16ArrayType::Pointer output = std::dynamic_pointer_cast<Int16ArrayType>(containerArray->getAttributeMatrix(output_path)->getAttributeArray(output_path.getDataArrayName()));
+    DREAM3D_REQUIRE_NE(output.get(), 0);
+    const short* expected = casterFrom->GetOutput()->GetBufferPointer();
+    DREAM3D_REQUIRE_EQUAL(casterFrom->GetOutput()->GetBufferedRegion().GetNumberOfPixels(), output->getNumberOfTuples());
+    for(size_t i = 0; i < output->getNumberOfTuples(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(output->getValue(i), expected[i]);
+    }
+    return 0;
+  }
+
+  int TestITKGradientAnisotropicDiffusionImageIntegerTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataArrayPath output_path("TestContainer", "TestAttributeMatrixName", "Diffused");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    QString filtName = "ITKGradientAnisotropicDiffusionImage";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(input_path);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(true);
+    propWasSet = filter->setProperty("SaveAsNewArray", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(output_path.getDataArrayName());
+    propWasSet = filter->setProperty("NewCellArrayName", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(0.01);
+    propWasSet = filter->setProperty("TimeStep", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(3.0);
+    propWasSet = filter->setProperty("ConductanceParameter", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(1.0);
+    propWasSet = filter->setProperty("ConductanceScalingUpdateInterval", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(5.0);
+    propWasSet = filter->setProperty("NumberOfIterations", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+
+    // The engine computes the same pixels as the ITK filter
+    ImageGeom::Pointer imageGeometry = containerArray->getDataContainer(input_path.getDataContainerName())->getGeometryAs<ImageGeom>();
+    size_t dims[3] = {0, 0, 0};
+    std::tie(dims[0], dims[1], dims[2]) = imageGeometry->getDimensions();
+    if(dims[2] == 1)
+    {
+      return CompareWithITKFilter<2>(containerArray, input_path, output_path);
+    }
+    return CompareWithITKFilter<3>(containerArray, input_path, output_path);
+  }
+
 
   // -----------------------------------------------------------------------------
   //
@@ -118,6 +211,7 @@ int TestITKGradientAnisotropicDiffusionImagelongerTest()
 
     DREAM3D_REGISTER_TEST( TestITKGradientAnisotropicDiffusionImagedefaultsTest());
     DREAM3D_REGISTER_TEST( TestITKGradientAnisotropicDiffusionImagelongerTest());
+    DREAM3D_REGISTER_TEST( TestITKGradientAnisotropicDiffusionImageIntegerTest());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
@@ -11,6 +11,20 @@
 #include <SIMPLib/FilterParameters/FloatVec3FilterParameter.h>
 #include <SIMPLib/FilterParameters/IntFilterParameter.h>
 
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKMorphologyKernel.h"
+
+#include <itkBinaryClosingByReconstructionImageFilter.h>
+#include <itkBinaryDilateImageFilter.h>
+#include <itkBinaryErodeImageFilter.h>
+#include <itkBinaryOpeningByReconstructionImageFilter.h>
+#include <itkBlackTopHatImageFilter.h>
+#include <itkGrayscaleDilateImageFilter.h>
+#include <itkGrayscaleErodeImageFilter.h>
+#include <itkGrayscaleMorphologicalClosingImageFilter.h>
+#include <itkGrayscaleMorphologicalOpeningImageFilter.h>
+#include <itkMorphologicalGradientImageFilter.h>
+#include <itkWhiteTopHatImageFilter.h>
+
 class ITKGrayscaleMorphologicalClosingImageTest : public ITKTestBase
 {
 
@@ -68,6 +82,175 @@ public:
     return 0;
   }
 
+  // -----------------------------------------------------------------------------
+  // Runs the filter @p filtName on the 2D uint8 input and compares its output with @p itkFilter applied to the same input
+  // -----------------------------------------------------------------------------
+  template <typename FilterType>
+  int CompareWithITKFilter(const QString& filtName, QVariantMap properties, typename FilterType::Pointer itkFilter, DataContainerArray::Pointer containerArray, const DataArrayPath& input_path)
+  {
+    properties["SelectedCellArrayPath"] = QVariant::fromValue(input_path);
+    properties["SaveAsNewArray"] = true;
+    properties["NewCellArrayName"] = QString("Output");
+    AbstractFilter::Pointer filter = CreateFilter(filtName, properties);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+
+    typedef itk::InPlaceDream3DDataToImageFilter<uint8_t, 2> ToITKType;
+    ToITKType::Pointer toITK = ToITKType::New();
+    toITK->SetInput(containerArray->getDataContainer(input_path.getDataContainerName()));
+    toITK->SetAttributeMatrixArrayName(input_path.getAttributeMatrixName().toStdString());
+    toITK->SetDataArrayName(input_path.getDataArrayName().toStdString());
+    toITK->SetInPlace(true);
+    itkFilter->SetInput(toITK->GetOutput());
+    itkFilter->Update();
+
+    AttributeMatrix::Pointer attributeMatrix = containerArray->getAttributeMatrix(input_path);
+    UInt8ArrayType::Pointer output = std::dynamic_pointer_cast<UInt8ArrayType>(attributeMatrix->getAttributeArray("Output"));
+    DREAM3D_REQUIRE_NE(output.get(), 0);
+    const uint8_t* expected = itkFilter->GetOutput()->GetBufferPointer();
+    DREAM3D_REQUIRE_EQUAL(itkFilter->GetOutput()->GetBufferedRegion().GetNumberOfPixels(), output->getNumberOfTuples());
+    size_t mismatches = 0;
+    for(size_t i = 0; i < output->getNumberOfTuples(); i++)
+    {
+      if(output->getValue(i) != expected[i])
+      {
+        mismatches++;
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(mismatches, 0);
+    attributeMatrix->removeAttributeArray("Output");
+    return 0;
+  }
+
+  int TestITKGrayscaleMorphologicalClosingImageCompareWithITKTest()
+  {
+    // The flat morphology filters must match the ITK filters for every kernel and border handling
+    typedef itk::Dream3DImage<uint8_t, 2> ImageType;
+    typedef itk::FlatStructuringElement<2> StructuringElementType;
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/STAPLE1.png");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    FloatVec3_t radius;
+    radius.x = 9;
+    radius.y = 5;
+    radius.z = 1;
+    StructuringElementType::RadiusType elementRadius;
+    elementRadius[0] = 9;
+    elementRadius[1] = 5;
+    for(int kernelType : {itk::simple::sitkBall, itk::simple::sitkBox, itk::simple::sitkCross})
+    {
+      StructuringElementType element;
+      DREAM3D_REQUIRE_EQUAL(ITKMorphologyKernel::Create<2>(kernelType, elementRadius, element), true);
+      QVariantMap properties;
+      properties["KernelRadius"] = QVariant::fromValue(radius);
+      properties["KernelType"] = kernelType;
+      {
+        typedef itk::GrayscaleDilateImageFilter<ImageType, ImageType, StructuringElementType> FilterType;
+        FilterType::Pointer itkFilter = FilterType::New();
+        itkFilter->SetKernel(element);
+        DREAM3D_REQUIRE_EQUAL(CompareWithITKFilter<FilterType>("ITKGrayscaleDilateImage", properties, itkFilter, containerArray, input_path), 0);
+      }
+      {
+        typedef itk::GrayscaleErodeImageFilter<ImageType, ImageType, StructuringElementType> FilterType;
+        FilterType::Pointer itkFilter = FilterType::New();
+        itkFilter->SetKernel(element);
+        DREAM3D_REQUIRE_EQUAL(CompareWithITKFilter<FilterType>("ITKGrayscaleErodeImage", properties, itkFilter, containerArray, input_path), 0);
+      }
+      {
+        typedef itk::MorphologicalGradientImageFilter<ImageType, ImageType, StructuringElementType> FilterType;
+        FilterType::Pointer itkFilter = FilterType::New();
+        itkFilter->SetKernel(element);
+        DREAM3D_REQUIRE_EQUAL(CompareWithITKFilter<FilterType>("ITKMorphologicalGradientImage", properties, itkFilter, containerArray, input_path), 0);
+      }
+      for(bool safeBorder : {false, true})
+      {
+        properties["SafeBorder"] = safeBorder;
+        {
+          typedef itk::GrayscaleMorphologicalOpeningImageFilter<ImageType, ImageType, StructuringElementType> FilterType;
+          FilterType::Pointer itkFilter = FilterType::New();
+          itkFilter->SetKernel(element);
+          itkFilter->SetSafeBorder(safeBorder);
+          DREAM3D_REQUIRE_EQUAL(CompareWithITKFilter<FilterType>("ITKGrayscaleMorphologicalOpeningImage", properties, itkFilter, containerArray, input_path), 0);
+        }
+        {
+          typedef itk::GrayscaleMorphologicalClosingImageFilter<ImageType, ImageType, StructuringElementType> FilterType;
+          FilterType::Pointer itkFilter = FilterType::New();
+          itkFilter->SetKernel(element);
+          itkFilter->SetSafeBorder(safeBorder);
+          DREAM3D_REQUIRE_EQUAL(CompareWithITKFilter<FilterType>("ITKGrayscaleMorphologicalClosingImage", properties, itkFilter, containerArray, input_path), 0);
+        }
+        {
+          typedef itk::WhiteTopHatImageFilter<ImageType, ImageType, StructuringElementType> FilterType;
+          FilterType::Pointer itkFilter = FilterType::New();
+          itkFilter->SetKernel(element);
+          itkFilter->SetSafeBorder(safeBorder);
+          DREAM3D_REQUIRE_EQUAL(CompareWithITKFilter<FilterType>("ITKWhiteTopHatImage", properties, itkFilter, containerArray, input_path), 0);
+        }
+        {
+          typedef itk::BlackTopHatImageFilter<ImageType, ImageType, StructuringElementType> FilterType;
+          FilterType::Pointer itkFilter = FilterType::New();
+          itkFilter->SetKernel(element);
+          itkFilter->SetSafeBorder(safeBorder);
+          DREAM3D_REQUIRE_EQUAL(CompareWithITKFilter<FilterType>("ITKBlackTopHatImage", properties, itkFilter, containerArray, input_path), 0);
+        }
+      }
+      properties.remove("SafeBorder");
+      // The binary filters threshold at the foreground value; the other values must be left untouched
+      properties["ForegroundValue"] = 255.0;
+      properties["BackgroundValue"] = 0.0;
+      for(bool boundaryToForeground : {false, true})
+      {
+        properties["BoundaryToForeground"] = boundaryToForeground;
+        {
+          typedef itk::BinaryDilateImageFilter<ImageType, ImageType, StructuringElementType> FilterType;
+          FilterType::Pointer itkFilter = FilterType::New();
+          itkFilter->SetKernel(element);
+          itkFilter->SetForegroundValue(255);
+          itkFilter->SetBackgroundValue(0);
+          itkFilter->SetBoundaryToForeground(boundaryToForeground);
+          DREAM3D_REQUIRE_EQUAL(CompareWithITKFilter<FilterType>("ITKBinaryDilateImage", properties, itkFilter, containerArray, input_path), 0);
+        }
+        {
+          typedef itk::BinaryErodeImageFilter<ImageType, ImageType, StructuringElementType> FilterType;
+          FilterType::Pointer itkFilter = FilterType::New();
+          itkFilter->SetKernel(element);
+          itkFilter->SetForegroundValue(255);
+          itkFilter->SetBackgroundValue(0);
+          itkFilter->SetBoundaryToForeground(boundaryToForeground);
+          DREAM3D_REQUIRE_EQUAL(CompareWithITKFilter<FilterType>("ITKBinaryErodeImage", properties, itkFilter, containerArray, input_path), 0);
+        }
+      }
+      properties.remove("BoundaryToForeground");
+      for(bool fullyConnected : {false, true})
+      {
+        properties["FullyConnected"] = fullyConnected;
+        {
+          typedef itk::BinaryOpeningByReconstructionImageFilter<ImageType, StructuringElementType> FilterType;
+          FilterType::Pointer itkFilter = FilterType::New();
+          itkFilter->SetKernel(element);
+          itkFilter->SetForegroundValue(255);
+          itkFilter->SetBackgroundValue(0);
+          itkFilter->SetFullyConnected(fullyConnected);
+          DREAM3D_REQUIRE_EQUAL(CompareWithITKFilter<FilterType>("ITKBinaryOpeningByReconstructionImage", properties, itkFilter, containerArray, input_path), 0);
+        }
+        {
+          QVariantMap closingProperties = properties;
+          closingProperties.remove("BackgroundValue");
+          typedef itk::BinaryClosingByReconstructionImageFilter<ImageType, StructuringElementType> FilterType;
+          FilterType::Pointer itkFilter = FilterType::New();
+          itkFilter->SetKernel(element);
+          itkFilter->SetForegroundValue(255);
+          itkFilter->SetFullyConnected(fullyConnected);
+          DREAM3D_REQUIRE_EQUAL(CompareWithITKFilter<FilterType>("ITKBinaryClosingByReconstructionImage", closingProperties, itkFilter, containerArray, input_path), 0);
+        }
+      }
+    }
+    return 0;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -78,6 +261,7 @@ public:
     DREAM3D_REGISTER_TEST(this->TestFilterAvailability("ITKGrayscaleMorphologicalClosingImage"));
 
     DREAM3D_REGISTER_TEST(TestITKGrayscaleMorphologicalClosingImageGrayscaleMorphologicalClosingTest());
+    DREAM3D_REGISTER_TEST(TestITKGrayscaleMorphologicalClosingImageCompareWithITKTest());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
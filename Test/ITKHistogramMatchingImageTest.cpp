@@ -196,6 +196,81 @@ public:
     return 0;
   }
 
+  // -----------------------------------------------------------------------------
+  // The model saved from the reference matches the source to the same pixels as the reference itself
+  // -----------------------------------------------------------------------------
+  int TestReferenceModel(const QString& source_filename, const QString& reference_filename)
+  {
+    DataArrayPath source_path("SourceContainer", "SourceAttributeMatrixName", "SourceAttributeArrayName");
+    DataArrayPath reference_path("ReferenceContainer", "ReferenceAttributeMatrixName", "ReferenceAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(UnitTest::DataDir + source_filename, containerArray, source_path);
+    this->ReadImage(UnitTest::DataDir + reference_filename, containerArray, reference_path);
+    QVariantMap properties;
+    properties["SelectedCellArrayPath"] = QVariant::fromValue(source_path);
+    properties["ReferenceCellArrayPath"] = QVariant::fromValue(reference_path);
+    properties["SaveReferenceModel"] = true;
+    properties["SaveAsNewArray"] = true;
+    properties["NewCellArrayName"] = QString("Matched");
+    properties["NumberOfMatchPoints"] = 7.0;
+    AbstractFilter::Pointer filter = CreateFilter("ITKHistogramMatchingImage", properties);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+
+    DataArrayPath model_path("ReferenceContainer", "HistogramMatchingModel", "ReferenceModel");
+    QVariant var;
+    var.setValue(false);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("SaveReferenceModel", var), true);
+    var.setValue(true);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("UseReferenceModel", var), true);
+    var.setValue(model_path);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("ReferenceModelArrayPath", var), true);
+    var.setValue(QString("MatchedWithModel"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("NewCellArrayName", var), true);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    QString md5Matched;
+    GetMD5FromDataContainer(containerArray, DataArrayPath("SourceContainer", "SourceAttributeMatrixName", "Matched"), md5Matched);
+    QString md5MatchedWithModel;
+    GetMD5FromDataContainer(containerArray, DataArrayPath("SourceContainer", "SourceAttributeMatrixName", "MatchedWithModel"), md5MatchedWithModel);
+    DREAM3D_REQUIRE_EQUAL(md5MatchedWithModel, md5Matched);
+
+    // The header of the model records the parameters it was computed with
+    DoubleArrayType::Pointer model = std::dynamic_pointer_cast<DoubleArrayType>(containerArray->getAttributeMatrix(model_path)->getAttributeArray(model_path.getDataArrayName()));
+    DREAM3D_REQUIRE_VALID_POINTER(model.get());
+    DREAM3D_REQUIRE_EQUAL(model->getNumberOfComponents(), 14);
+    DREAM3D_REQUIRE_EQUAL(model->getValue(0), 256.0);
+    DREAM3D_REQUIRE_EQUAL(model->getValue(1), 7.0);
+    DREAM3D_REQUIRE_EQUAL(model->getValue(2), 1.0);
+
+    // A model is not applied with other parameters
+    var.setValue(128.0);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("NumberOfHistogramLevels", var), true);
+    var.setValue(QString("MatchedWithOtherLevels"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("NewCellArrayName", var), true);
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -55632);
+
+    // Nor saved by the filter using it
+    var.setValue(true);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("SaveReferenceModel", var), true);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -55631);
+    return 0;
+  }
+
+  int TestITKHistogramMatchingImageReferenceModel()
+  {
+    // 8 and 16 bit pixels are mapped through a lookup table, float pixels are not
+    DREAM3D_REQUIRE_EQUAL(TestReferenceModel("/Data/JSONFilters/Input/cthead1.png", "/Data/JSONFilters/Input/LargeWhiteCircle.nrrd"), 0);
+    DREAM3D_REQUIRE_EQUAL(TestReferenceModel("/Data/JSONFilters/Input/RA-Short.nrrd", "/Data/JSONFilters/Input/RA-Short.nrrd"), 0);
+    DREAM3D_REQUIRE_EQUAL(TestReferenceModel("/Data/JSONFilters/Input/RA-Float.nrrd", "/Data/JSONFilters/Input/RA-Float.nrrd"), 0);
+    return 0;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -210,6 +285,7 @@ public:
     DREAM3D_REGISTER_TEST(TestITKHistogramMatchingImageSameDimension());
     DREAM3D_REGISTER_TEST(TestITKHistogramMatchingImageTestSamePixelType());
     DREAM3D_REGISTER_TEST(TestITKHistogramMatchingImageTestDataArrayDoesnotExist());
+    DREAM3D_REGISTER_TEST(TestITKHistogramMatchingImageReferenceModel());
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
       DREAM3D_REGISTER_TEST(this->RemoveTestFiles())
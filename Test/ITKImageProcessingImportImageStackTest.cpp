@@ -52,6 +52,8 @@
 #include <itkImageFileWriter.h>
 #include <itkImageIOBase.h>
 
+#include <cstring>
+
 class ITKImageProcessingImportImageStackTest
 {
 
@@ -300,6 +302,42 @@ public:
     return EXIT_SUCCESS;
   }
 
+  IDataArray::Pointer ReadStack(int numberOfReaderThreads)
+  {
+    ITKImportImageStack::Pointer reader = ITKImportImageStack::New();
+    FileListInfo_t fileListInfo;
+    fileListInfo.InputPath = UnitTest::ITKImageProcessingImportImageStackTest::StackInputTestDir;
+    fileListInfo.StartIndex = 11;
+    fileListInfo.EndIndex = 13;
+    fileListInfo.IncrementIndex = 1;
+    fileListInfo.FileExtension = "tif";
+    fileListInfo.FilePrefix = "slice_";
+    fileListInfo.FileSuffix = "";
+    fileListInfo.PaddingDigits = 2;
+    fileListInfo.Ordering = 0;
+    reader->setInputFileListInfo(fileListInfo);
+    reader->setNumberOfReaderThreads(numberOfReaderThreads);
+    reader->setDataContainerArray(DataContainerArray::New());
+    reader->execute();
+    DREAM3D_REQUIRED(reader->getErrorCondition(), >=, 0);
+    DataArrayPath path(reader->getDataContainerName(), reader->getCellAttributeMatrixName(), reader->getImageDataArrayName());
+    return reader->getDataContainerArray()->getAttributeMatrix(path)->getAttributeArray(path.getDataArrayName());
+  }
+
+  int TestReaderThreads()
+  {
+    IDataArray::Pointer serial = ReadStack(1);
+    IDataArray::Pointer parallel = ReadStack(0);
+    DREAM3D_REQUIRE_VALID_POINTER(serial.get());
+    DREAM3D_REQUIRE_VALID_POINTER(parallel.get());
+    DREAM3D_REQUIRE_EQUAL(serial->getTypeAsString(), parallel->getTypeAsString());
+    DREAM3D_REQUIRE_EQUAL(serial->getNumberOfTuples(), 524 * 390 * 3);
+    DREAM3D_REQUIRE_EQUAL(serial->getSize(), parallel->getSize());
+    const size_t numberOfBytes = serial->getSize() * static_cast<size_t>(serial->getTypeSize());
+    DREAM3D_REQUIRE_EQUAL(::memcmp(serial->getVoidPointer(0), parallel->getVoidPointer(0), numberOfBytes), 0);
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -313,6 +351,7 @@ public:
     DREAM3D_REGISTER_TEST(TestNoFiles());
     DREAM3D_REGISTER_TEST(TestFileDoesNotExist());
     DREAM3D_REGISTER_TEST(TestCompareImage());
+    DREAM3D_REGISTER_TEST(TestReaderThreads());
   }
 
 private:
@@ -44,6 +44,7 @@
 #include "SIMPLib/SIMPLib.h"
 #include "UnitTestSupport.hpp"
 
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageIOMetaDataCache.h"
 #include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageReader.h"
 
 #include "ITKImageProcessingTestFileLocations.h"
@@ -347,6 +348,66 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestMetaDataCache()
+  {
+    const QString file = UnitTest::ITKImageProcessingReaderTest::METAIOInputTestFile;
+    itk::Dream3DImage<DefaultPixelType, 3>::Pointer expectedImage = WriteMetaIOTestFile();
+    ITKImageIOMetaDataCache::Instance().clear();
+
+    // Preflights and execution reuse the cached header of the file
+    for(int i = 0; i < 3; i++)
+    {
+      ITKImageReader::Pointer reader = ITKImageReader::New();
+      reader->setDataContainerArray(DataContainerArray::New());
+      reader->setDataContainerName("TestContainer");
+      reader->setFileName(file);
+      if(i < 2)
+      {
+        reader->preflight();
+      }
+      else
+      {
+        reader->execute();
+      }
+      DREAM3D_REQUIRED(reader->getErrorCondition(), >=, 0);
+      DREAM3D_REQUIRE_EQUAL(ITKImageIOMetaDataCache::Instance().size(), 1);
+
+      DataContainer::Pointer container = reader->getDataContainerArray()->getDataContainer("TestContainer");
+      ImageGeom::Pointer imageGeometry = container->getGeometryAs<ImageGeom>();
+      DREAM3D_REQUIRE_NE(imageGeometry.get(), 0);
+      size_t dimensions[3] = {0, 0, 0};
+      std::tie(dimensions[0], dimensions[1], dimensions[2]) = imageGeometry->getDimensions();
+      float resolution[3];
+      imageGeometry->getResolution(resolution);
+      for(size_t d = 0; d < 3; d++)
+      {
+        DREAM3D_REQUIRE_EQUAL(dimensions[d], expectedImage->GetLargestPossibleRegion().GetSize()[d]);
+        float imageSpacing = expectedImage->GetSpacing()[d];
+        DREAM3D_COMPARE_FLOATS(&resolution[d], &imageSpacing, 1e-6);
+      }
+      AttributeMatrix::Pointer attributeMatrix = container->getAttributeMatrix(SIMPL::Defaults::CellAttributeMatrixName);
+      DREAM3D_REQUIRE_NE(attributeMatrix.get(), 0);
+      IDataArray::Pointer dataArray = attributeMatrix->getAttributeArray(SIMPL::CellData::ImageData);
+      DREAM3D_REQUIRE_NE(dataArray.get(), 0);
+      DREAM3D_REQUIRE_EQUAL(dataArray->getNumberOfComponents(), 1);
+      DREAM3D_REQUIRE_EQUAL(dataArray->getTypeAsString(), DataArray<DefaultPixelType>::CreateArray(0, "Type", false)->getTypeAsString());
+    }
+
+    // A file that changed is read again
+    itk::Dream3DImage<DefaultPixelType, 2>::Pointer image2D = WriteTestFile<DefaultPixelType, 2>(file, itk::MetaImageIO::New().GetPointer());
+    ITKImageIOMetaDataCache::MetaData metaData;
+    DREAM3D_REQUIRE(ITKImageIOMetaDataCache::Instance().getMetaData(file, metaData).isEmpty());
+    DREAM3D_REQUIRE_EQUAL(metaData.dimensions.size(), 2);
+    DREAM3D_REQUIRE_EQUAL(metaData.dimensions[0], image2D->GetLargestPossibleRegion().GetSize()[0]);
+    DREAM3D_REQUIRE_EQUAL(ITKImageIOMetaDataCache::Instance().size(), 1);
+
+    DREAM3D_REQUIRE(!ITKImageIOMetaDataCache::Instance().getMetaData(file + ".missing", metaData).isEmpty());
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -412,6 +473,7 @@ public:
     typedef itk::Vector<DefaultPixelType, 3> RGBAPixelType;
     itk::Dream3DImage<RGBAPixelType, 3>::Pointer rgbaImage = WriteNRRDIOTestFile<RGBAPixelType>();
     DREAM3D_REGISTER_TEST((TestCompareImage<RGBAPixelType, 3>(UnitTest::ITKImageProcessingReaderTest::NRRDIOInputTestFile, rgbaImage)))
+    DREAM3D_REGISTER_TEST(TestMetaDataCache())
     DREAM3D_REGISTER_TEST(RemoveTestFiles())
   }
 
@@ -31,6 +31,7 @@
 *
 * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 #include <QtCore/QCoreApplication>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QFile>
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
@@ -49,6 +50,7 @@
 #include "UnitTestSupport.hpp"
 
 #include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageWriter.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKPlaneExtractor.h"
 
 #include "ITKImageProcessingTestFileLocations.h"
 
@@ -497,6 +499,187 @@ public:
     return EXIT_SUCCESS;
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  QByteArray ReadFileContent(const QString& filename)
+  {
+    QFile file(filename);
+    DREAM3D_REQUIRE(file.open(QIODevice::ReadOnly));
+    return file.readAll();
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int TestWriterThreads()
+  {
+    DataArrayPath path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = CreateTestData<uint8_t, 3>(path);
+    // Non-uniform values so that a slice written with the wrong layout or in the wrong file is detected
+    IDataArray::Pointer data = containerArray->getAttributeMatrix(path)->getAttributeArray(path.getDataArrayName());
+    uint8_t* values = static_cast<uint8_t*>(data->getVoidPointer(0));
+    for(size_t i = 0; i < data->getSize(); i++)
+    {
+      values[i] = static_cast<uint8_t>((i * 7) % 251);
+    }
+    size_t dims[3] = {90, 93, 96};
+    for(int plane = ITKImageWriter::XYPlane; plane <= ITKImageWriter::YZPlane; plane++)
+    {
+      QString serialBaseName = UnitTest::ITKImageProcessingWriterTest::OutputBaseFile + QString("_serial%1").arg(plane);
+      QString parallelBaseName = UnitTest::ITKImageProcessingWriterTest::OutputBaseFile + QString("_parallel%1").arg(plane);
+      for(int numberOfThreads = 0; numberOfThreads < 2; numberOfThreads++)
+      {
+        ITKImageWriter::Pointer writer = ITKImageWriter::New();
+        writer->setFileName((numberOfThreads == 1 ? serialBaseName : parallelBaseName) + ".png");
+        writer->setImageArrayPath(path);
+        writer->setPlane(plane);
+        writer->setNumberOfWriterThreads(numberOfThreads);
+        writer->setDataContainerArray(containerArray);
+        writer->execute();
+        DREAM3D_REQUIRED(writer->getErrorCondition(), >=, 0);
+      }
+      const size_t numberOfSlices = dims[2 - plane];
+      for(size_t slice = 0; slice < numberOfSlices; slice++)
+      {
+        QString serialFileName = serialBaseName + QString("_%1.png").arg(slice);
+        QString parallelFileName = parallelBaseName + QString("_%1.png").arg(slice);
+        this->FilesToRemove << serialFileName << parallelFileName;
+        DREAM3D_REQUIRE(ReadFileContent(serialFileName) == ReadFileContent(parallelFileName));
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> int TestPlaneExtractor(size_t nComp)
+  {
+    const size_t dims[3] = {37, 29, 23};
+    std::vector<T> volume(dims[0] * dims[1] * dims[2] * nComp);
+    for(size_t i = 0; i < volume.size(); i++)
+    {
+      volume[i] = static_cast<T>(i % 65521);
+    }
+    ITKPlaneExtractor<T> extractor(volume.data(), dims, nComp);
+    // Blocks that do not divide the number of slices evenly, and blocks larger than a tile
+    const size_t blockSizes[3] = {1, 5, 16};
+    for(size_t count : blockSizes)
+    {
+      const size_t xzSize = dims[0] * dims[2] * nComp;
+      std::vector<T> planes(count * xzSize);
+      for(size_t first = 0; first < dims[1]; first += count)
+      {
+        const size_t n = std::min(count, dims[1] - first);
+        extractor.extractXZ(first, n, planes.data());
+        for(size_t i = 0; i < n; i++)
+        {
+          for(size_t z = 0; z < dims[2]; z++)
+          {
+            for(size_t x = 0; x < dims[0] * nComp; x++)
+            {
+              DREAM3D_REQUIRE_EQUAL(planes[i * xzSize + z * dims[0] * nComp + x], volume[((z * dims[1] + first + i) * dims[0]) * nComp + x]);
+            }
+          }
+        }
+      }
+      const size_t yzSize = dims[1] * dims[2] * nComp;
+      planes.resize(count * yzSize);
+      for(size_t first = 0; first < dims[0]; first += count)
+      {
+        const size_t n = std::min(count, dims[0] - first);
+        extractor.extractYZ(first, n, planes.data());
+        for(size_t i = 0; i < n; i++)
+        {
+          for(size_t zy = 0; zy < dims[1] * dims[2]; zy++)
+          {
+            for(size_t c = 0; c < nComp; c++)
+            {
+              DREAM3D_REQUIRE_EQUAL(planes[i * yzSize + zy * nComp + c], volume[(zy * dims[0] + first + i) * nComp + c]);
+            }
+          }
+        }
+      }
+    }
+    return EXIT_SUCCESS;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Prints the export throughput of the three planes. Nothing is checked but the error condition:
+  // the numbers are meant to be compared between the planes and between builds. Only run when the
+  // ITKImageProcessing_ENABLE_BENCHMARKS CMake option is ON.
+  // -----------------------------------------------------------------------------
+  int BenchmarkPlaneExport()
+  {
+    const size_t dims[3] = {256, 256, 256};
+    DataArrayPath path("BenchmarkContainer", "BenchmarkAttributeMatrix", "BenchmarkArray");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    DataContainer::Pointer container = DataContainer::New(path.getDataContainerName());
+    ImageGeom::Pointer imageGeom = ImageGeom::CreateGeometry(SIMPL::Geometry::ImageGeometry);
+    imageGeom->setDimensions(dims);
+    container->setGeometry(imageGeom);
+    QVector<size_t> tDims = {dims[0], dims[1], dims[2]};
+    AttributeMatrix::Pointer am = AttributeMatrix::New(tDims, path.getAttributeMatrixName(), AttributeMatrix::Type::Cell);
+    container->addAttributeMatrix(am->getName(), am);
+    UInt8ArrayType::Pointer data = UInt8ArrayType::CreateArray(tDims, QVector<size_t>(1, 3), path.getDataArrayName(), true);
+    for(size_t i = 0; i < data->getSize(); i++)
+    {
+      data->setValue(i, static_cast<uint8_t>((i * 7) % 251));
+    }
+    am->addAttributeArray(data->getName(), data);
+    containerArray->addDataContainer(container);
+
+    const double megaBytes = static_cast<double>(data->getSize()) / (1024.0 * 1024.0);
+    const char* planeNames[3] = {"XY", "XZ", "YZ"};
+    for(int plane = ITKImageWriter::XYPlane; plane <= ITKImageWriter::YZPlane; plane++)
+    {
+      // Extraction only: every slice of the plane, one block of 16 slices at a time
+      ITKPlaneExtractor<uint8_t> extractor(data->getPointer(0), dims, 3);
+      const size_t numberOfSlices = dims[2 - plane];
+      const size_t sliceSize = data->getSize() / numberOfSlices;
+      std::vector<uint8_t> planes(16 * sliceSize);
+      QElapsedTimer timer;
+      timer.start();
+      for(size_t first = 0; first < numberOfSlices; first += 16)
+      {
+        const size_t count = std::min<size_t>(16, numberOfSlices - first);
+        if(ITKImageWriter::XYPlane == plane)
+        {
+          std::copy(data->getPointer(first * sliceSize), data->getPointer(first * sliceSize) + count * sliceSize, planes.data());
+        }
+        else if(ITKImageWriter::XZPlane == plane)
+        {
+          extractor.extractXZ(first, count, planes.data());
+        }
+        else
+        {
+          extractor.extractYZ(first, count, planes.data());
+        }
+      }
+      const qint64 extractTime = std::max<qint64>(timer.elapsed(), 1);
+
+      // Whole export, encoding included
+      QString baseName = UnitTest::ITKImageProcessingWriterTest::OutputBaseFile + QString("_benchmark%1").arg(plane);
+      ITKImageWriter::Pointer writer = ITKImageWriter::New();
+      writer->setFileName(baseName + ".tif");
+      writer->setImageArrayPath(path);
+      writer->setPlane(plane);
+      writer->setDataContainerArray(containerArray);
+      timer.restart();
+      writer->execute();
+      const qint64 exportTime = std::max<qint64>(timer.elapsed(), 1);
+      DREAM3D_REQUIRED(writer->getErrorCondition(), >=, 0);
+      for(size_t slice = 0; slice < numberOfSlices; slice++)
+      {
+        this->FilesToRemove << baseName + QString("_%1.tif").arg(slice);
+      }
+
+      std::cout << planeNames[plane] << " plane: extraction " << megaBytes * 1000.0 / extractTime << " MB/s, export " << megaBytes * 1000.0 / exportTime << " MB/s" << std::endl;
+    }
+    return EXIT_SUCCESS;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -616,6 +799,14 @@ public:
 
     // Test image series
     DREAM3D_REGISTER_TEST(TestWriteImageSeries())
+    DREAM3D_REGISTER_TEST(TestWriterThreads())
+    DREAM3D_REGISTER_TEST(TestPlaneExtractor<uint8_t>(1))
+    DREAM3D_REGISTER_TEST(TestPlaneExtractor<uint8_t>(3))
+    DREAM3D_REGISTER_TEST(TestPlaneExtractor<uint16_t>(4))
+    DREAM3D_REGISTER_TEST(TestPlaneExtractor<float>(5))
+#ifdef ITK_IMAGE_PROCESSING_ENABLE_BENCHMARKS
+    DREAM3D_REGISTER_TEST(BenchmarkPlaneExport())
+#endif
 
 #if REMOVE_TEST_FILES
     //   if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
@@ -0,0 +1,294 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstdlib>
+#include <tuple>
+#include <vector>
+
+#include "ITKTestBase.h"
+
+class ITKLabelComponentsImageTest : public ITKTestBase
+{
+
+public:
+  ITKLabelComponentsImageTest()
+  {
+  }
+  virtual ~ITKLabelComponentsImageTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  // Runs the filter in place on the input array
+  // -----------------------------------------------------------------------------
+  AbstractFilter::Pointer RunFilter(const QString& filtName, DataContainerArray::Pointer& containerArray, const DataArrayPath& input_path, QVariantMap properties)
+  {
+    properties["SelectedCellArrayPath"] = QVariant::fromValue(input_path);
+    properties["SaveAsNewArray"] = false;
+    AbstractFilter::Pointer filter = CreateFilter(filtName, properties);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    return filter;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  int CompareWithConnectedComponent(const QString& input_filename, bool threshold)
+  {
+    for(bool fullyConnected : {false, true})
+    {
+      DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+      DataArrayPath baseline_path("BContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+      DataContainerArray::Pointer containerArray = DataContainerArray::New();
+      this->ReadImage(input_filename, containerArray, input_path);
+      this->ReadImage(input_filename, containerArray, baseline_path);
+      if(threshold)
+      {
+        RunFilter("ITKBinaryThresholdImage", containerArray, input_path, QVariantMap());
+        RunFilter("ITKBinaryThresholdImage", containerArray, baseline_path, QVariantMap());
+      }
+
+      QVariantMap properties;
+      properties["FullyConnected"] = fullyConnected;
+      AbstractFilter::Pointer connectedComponent = RunFilter("ITKConnectedComponentImage", containerArray, baseline_path, properties);
+
+      properties.clear();
+      properties["Connectivity"] = fullyConnected ? 2 : 0;
+      properties["LabelType"] = 3;
+      AbstractFilter::Pointer labelComponents = RunFilter("ITKLabelComponentsImage", containerArray, input_path, properties);
+
+      DREAM3D_REQUIRE_EQUAL(labelComponents->property("ObjectCount").toUInt(), connectedComponent->property("ObjectCount").toUInt());
+      int res = this->CompareImages(containerArray, input_path, baseline_path, 0.0);
+      DREAM3D_REQUIRE_EQUAL(res, 0);
+    }
+    return 0;
+  }
+
+  int TestITKLabelComponentsImageConnectedComponent2DTest()
+  {
+    return CompareWithConnectedComponent(UnitTest::DataDir + QString("/Data/JSONFilters/Input/WhiteDots.png"), false);
+  }
+
+  int TestITKLabelComponentsImageConnectedComponent3DTest()
+  {
+    return CompareWithConnectedComponent(UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd"), true);
+  }
+
+  int TestITKLabelComponentsImageRelabelTest()
+  {
+    // Labeling and relabeling in one pass gives the labels of ITKConnectedComponentImage followed by ITKRelabelComponentImage
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/WhiteDots.png");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataArrayPath baseline_path("BContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    this->ReadImage(input_filename, containerArray, baseline_path);
+
+    QVariantMap properties;
+    RunFilter("ITKConnectedComponentImage", containerArray, baseline_path, properties);
+    properties["MinimumObjectSize"] = 20.0;
+    properties["SortByObjectSize"] = true;
+    AbstractFilter::Pointer relabel = RunFilter("ITKRelabelComponentImage", containerArray, baseline_path, properties);
+
+    properties["MinimumObjectSize"] = 20;
+    properties["LabelType"] = 3;
+    AbstractFilter::Pointer labelComponents = RunFilter("ITKLabelComponentsImage", containerArray, input_path, properties);
+
+    DREAM3D_REQUIRE_EQUAL(labelComponents->property("ObjectCount").toUInt(), relabel->property("NumberOfObjects").toUInt());
+    DREAM3D_REQUIRE_EQUAL(labelComponents->property("OriginalObjectCount").toUInt(), 23u);
+    WriteImage("ITKLabelComponentsImageRelabel.nrrd", containerArray, input_path);
+    int res = this->CompareImages(containerArray, input_path, baseline_path, 0.0);
+    DREAM3D_REQUIRE_EQUAL(res, 0);
+    return 0;
+  }
+
+  int TestITKLabelComponentsImageSmallestTypeTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/WhiteDots.png");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName("ITKLabelComponentsImage");
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    var.setValue(input_path);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("SelectedCellArrayPath", var), true);
+    var.setValue(true);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("SaveAsNewArray", var), true);
+    var.setValue(QString("Labels32"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("NewCellArrayName", var), true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+
+    // The default type is the one reported by the preflight
+    AttributeMatrix::Pointer am = containerArray->getAttributeMatrix(input_path);
+    DREAM3D_REQUIRE_VALID_POINTER(std::dynamic_pointer_cast<UInt32ArrayType>(am->getAttributeArray("Labels32")).get());
+
+    var.setValue(QString("Labels"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("NewCellArrayName", var), true);
+    var.setValue(0);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("LabelType", var), true);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+
+    // The 23 objects fit in unsigned char labels, the input is kept
+    UInt8ArrayType::Pointer labels = std::dynamic_pointer_cast<UInt8ArrayType>(am->getAttributeArray("Labels"));
+    DREAM3D_REQUIRE_VALID_POINTER(labels.get());
+    DREAM3D_REQUIRE_VALID_POINTER(am->getAttributeArray(input_path.getDataArrayName()).get());
+    uint8_t maximum = 0;
+    for(size_t i = 0; i < labels->getNumberOfTuples(); i++)
+    {
+      maximum = std::max(maximum, labels->getValue(i));
+    }
+    DREAM3D_REQUIRE_EQUAL(maximum, 23);
+
+    // A fixed type is used whatever the number of objects
+    var.setValue(QString("Labels16"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("NewCellArrayName", var), true);
+    var.setValue(2);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("LabelType", var), true);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRE_VALID_POINTER(std::dynamic_pointer_cast<UInt16ArrayType>(am->getAttributeArray("Labels16")).get());
+    return 0;
+  }
+
+  int TestITKLabelComponentsImageConnectivity18Test()
+  {
+    // There is no 18-connectivity in ITK: the labels are compared with a flood fill started from each unlabeled
+    // pixel in raster order, which numbers the components as the filter does
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    RunFilter("ITKBinaryThresholdImage", containerArray, input_path, QVariantMap());
+
+    ImageGeom::Pointer imageGeometry = containerArray->getDataContainer(input_path.getDataContainerName())->getGeometryAs<ImageGeom>();
+    size_t dims[3];
+    std::tie(dims[0], dims[1], dims[2]) = imageGeometry->getDimensions();
+    DREAM3D_REQUIRED(dims[2], >, 1);
+    UInt8ArrayType::Pointer mask = std::dynamic_pointer_cast<UInt8ArrayType>(containerArray->getAttributeMatrix(input_path)->getAttributeArray(input_path.getDataArrayName()));
+    DREAM3D_REQUIRE_VALID_POINTER(mask.get());
+    std::vector<uint32_t> expected(mask->getNumberOfTuples(), 0);
+    std::vector<size_t> stack;
+    uint32_t count = 0;
+    for(size_t seed = 0; seed < expected.size(); seed++)
+    {
+      if(mask->getValue(seed) == 0 || expected[seed] != 0)
+      {
+        continue;
+      }
+      expected[seed] = ++count;
+      stack.push_back(seed);
+      while(!stack.empty())
+      {
+        size_t index = stack.back();
+        stack.pop_back();
+        int64_t x = index % dims[0];
+        int64_t y = (index / dims[0]) % dims[1];
+        int64_t z = index / (dims[0] * dims[1]);
+        for(int64_t dz = -1; dz <= 1; dz++)
+        {
+          for(int64_t dy = -1; dy <= 1; dy++)
+          {
+            for(int64_t dx = -1; dx <= 1; dx++)
+            {
+              // Faces and edges only
+              if(std::abs(dx) + std::abs(dy) + std::abs(dz) > 2 || x + dx < 0 || y + dy < 0 || z + dz < 0 || x + dx >= static_cast<int64_t>(dims[0]) ||
+                 y + dy >= static_cast<int64_t>(dims[1]) || z + dz >= static_cast<int64_t>(dims[2]))
+              {
+                continue;
+              }
+              size_t neighbor = static_cast<size_t>(((z + dz) * dims[1] + y + dy) * dims[0] + x + dx);
+              if(mask->getValue(neighbor) != 0 && expected[neighbor] == 0)
+              {
+                expected[neighbor] = count;
+                stack.push_back(neighbor);
+              }
+            }
+          }
+        }
+      }
+    }
+
+    QVariantMap properties;
+    properties["Connectivity"] = 1;
+    AbstractFilter::Pointer labelComponents = RunFilter("ITKLabelComponentsImage", containerArray, input_path, properties);
+    DREAM3D_REQUIRE_EQUAL(labelComponents->property("ObjectCount").toUInt(), count);
+    UInt32ArrayType::Pointer labels = std::dynamic_pointer_cast<UInt32ArrayType>(containerArray->getAttributeMatrix(input_path)->getAttributeArray(input_path.getDataArrayName()));
+    DREAM3D_REQUIRE_VALID_POINTER(labels.get());
+    DREAM3D_REQUIRE_EQUAL(labels->getNumberOfTuples(), expected.size());
+    size_t mismatches = 0;
+    for(size_t i = 0; i < expected.size(); i++)
+    {
+      if(labels->getValue(i) != expected[i])
+      {
+        mismatches++;
+      }
+    }
+    DREAM3D_REQUIRE_EQUAL(mismatches, 0);
+    return 0;
+  }
+
+  int TestITKLabelComponentsImageInvalidTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/WhiteDots.png");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName("ITKLabelComponentsImage");
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    var.setValue(input_path);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("SelectedCellArrayPath", var), true);
+    filter->setDataContainerArray(containerArray);
+    var.setValue(3);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("Connectivity", var), true);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -55600);
+
+    var.setValue(0);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("Connectivity", var), true);
+    var.setValue(-1);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("MinimumObjectSize", var), true);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -55602);
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()() override
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(this->TestFilterAvailability("ITKLabelComponentsImage"));
+
+    DREAM3D_REGISTER_TEST(TestITKLabelComponentsImageConnectedComponent2DTest());
+    DREAM3D_REGISTER_TEST(TestITKLabelComponentsImageConnectedComponent3DTest());
+    DREAM3D_REGISTER_TEST(TestITKLabelComponentsImageRelabelTest());
+    DREAM3D_REGISTER_TEST(TestITKLabelComponentsImageSmallestTypeTest());
+    DREAM3D_REGISTER_TEST(TestITKLabelComponentsImageConnectivity18Test());
+    DREAM3D_REGISTER_TEST(TestITKLabelComponentsImageInvalidTest());
+
+    if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
+    {
+      DREAM3D_REGISTER_TEST(this->RemoveTestFiles())
+    }
+  }
+
+private:
+  ITKLabelComponentsImageTest(const ITKLabelComponentsImageTest&); // Copy Constructor Not Implemented
+  void operator=(const ITKLabelComponentsImageTest&);              // Move assignment Not Implemented
+};
@@ -88,6 +88,133 @@ public:
     return 0;
   }
 
+  int TestITKMedianImageStreamedTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    QString filtName = "ITKMedianImage";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(input_path);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(false);
+    propWasSet = filter->setProperty("SaveAsNewArray", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    {
+      FloatVec3_t d3d_var;
+      d3d_var.y = 3;
+      d3d_var.x = 2;
+      d3d_var.z = 0; // should not be taken into account. Dim <
+      var.setValue(d3d_var);
+      propWasSet = filter->setProperty("Radius", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    }
+    // Slabs smaller than the radius padding must still give the same result as the whole-image run
+    var.setValue(true);
+    propWasSet = filter->setProperty("StreamedExecution", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(7);
+    propWasSet = filter->setProperty("SlabSize", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    QString md5Output;
+    GetMD5FromDataContainer(containerArray, input_path, md5Output);
+    DREAM3D_REQUIRE_EQUAL(QString(md5Output), QString("4afeba184100773dc279a776b1ae493b"));
+    return 0;
+  }
+
+  int TestITKMedianImageThreadsTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    QString filtName = "ITKMedianImage";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    bool propWasSet;
+    var.setValue(input_path);
+    propWasSet = filter->setProperty("SelectedCellArrayPath", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    var.setValue(false);
+    propWasSet = filter->setProperty("SaveAsNewArray", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    {
+      FloatVec3_t d3d_var;
+      d3d_var.y = 3;
+      d3d_var.x = 2;
+      d3d_var.z = 0; // should not be taken into account. Dim <
+      var.setValue(d3d_var);
+      propWasSet = filter->setProperty("Radius", var);
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    }
+    // A single thread must give the same result as the default run
+    var.setValue(1);
+    propWasSet = filter->setProperty("NumberOfThreads", var);
+    DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    QString md5Output;
+    GetMD5FromDataContainer(containerArray, input_path, md5Output);
+    DREAM3D_REQUIRE_EQUAL(QString(md5Output), QString("4afeba184100773dc279a776b1ae493b"));
+    return 0;
+  }
+
+  int TestITKMedianImageHistogramEngineTest()
+  {
+    // Unsigned char pixels use the sliding histogram, float pixels itk::MedianImageFilter: the results must match
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/cthead1.png");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataArrayPath float_path("FloatContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    this->ReadImage(input_filename, containerArray, float_path);
+    FloatVec3_t radius;
+    radius.x = 4;
+    radius.y = 2;
+    radius.z = 0;
+    QVariantMap floatProperties;
+    floatProperties["SelectedCellArrayPath"] = QVariant::fromValue(float_path);
+    floatProperties["SaveAsNewArray"] = false;
+    QVariantMap properties = floatProperties;
+    properties["SelectedCellArrayPath"] = QVariant::fromValue(input_path);
+    QVariantMap castProperties = floatProperties;
+    castProperties["CastingType"] = 8; // float
+    AbstractFilter::Pointer toFloat = CreateFilter("ITKCastImage", castProperties);
+    castProperties["CastingType"] = 0; // unsigned char
+    AbstractFilter::Pointer toUChar = CreateFilter("ITKCastImage", castProperties);
+    floatProperties["Radius"] = QVariant::fromValue(radius);
+    properties["Radius"] = QVariant::fromValue(radius);
+    AbstractFilter::Pointer floatMedian = CreateFilter("ITKMedianImage", floatProperties);
+    AbstractFilter::Pointer median = CreateFilter("ITKMedianImage", properties);
+    for(const AbstractFilter::Pointer& filter : {toFloat, floatMedian, toUChar, median})
+    {
+      filter->setDataContainerArray(containerArray);
+      filter->execute();
+      DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+      DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    }
+    WriteImage("ITKMedianImageHistogramEngine.nrrd", containerArray, input_path);
+    int res = this->CompareImages(containerArray, input_path, float_path, 0.0);
+    DREAM3D_REQUIRE_EQUAL(res, 0);
+    return 0;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -99,6 +226,9 @@ public:
 
     DREAM3D_REGISTER_TEST(TestITKMedianImagedefaultsTest());
     DREAM3D_REGISTER_TEST(TestITKMedianImageby23Test());
+    DREAM3D_REGISTER_TEST(TestITKMedianImageStreamedTest());
+    DREAM3D_REGISTER_TEST(TestITKMedianImageThreadsTest());
+    DREAM3D_REGISTER_TEST(TestITKMedianImageHistogramEngineTest());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
@@ -55,6 +55,99 @@ public:
     return 0;
   }
 
+  // -----------------------------------------------------------------------------
+  // Denoises the input into a new array, with one thread so that the patches sampled are reproducible
+  // -----------------------------------------------------------------------------
+  IDataArray::Pointer RunFilter(DataContainerArray::Pointer containerArray, const DataArrayPath& input_path, const QString& outputName, bool singlePrecision, bool streamed, int slabSize)
+  {
+    QString filtName = "ITKPatchBasedDenoisingImage";
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    if(nullptr == filterFactory.get())
+    {
+      return IDataArray::NullPointer();
+    }
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    var.setValue(input_path);
+    filter->setProperty("SelectedCellArrayPath", var);
+    var.setValue(true);
+    filter->setProperty("SaveAsNewArray", var);
+    var.setValue(outputName);
+    filter->setProperty("NewCellArrayName", var);
+    var.setValue(singlePrecision);
+    filter->setProperty("SinglePrecision", var);
+    var.setValue(streamed);
+    filter->setProperty("StreamedExecution", var);
+    var.setValue(slabSize);
+    filter->setProperty("SlabSize", var);
+    var.setValue(1);
+    filter->setProperty("NumberOfThreads", var);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    if(filter->getErrorCondition() < 0)
+    {
+      return IDataArray::NullPointer();
+    }
+    return containerArray->getAttributeMatrix(input_path)->getAttributeArray(outputName);
+  }
+
+  FloatArrayType::Pointer RunSinglePrecision(DataContainerArray::Pointer containerArray, const DataArrayPath& input_path, const QString& outputName, bool streamed, int slabSize)
+  {
+    return std::dynamic_pointer_cast<FloatArrayType>(RunFilter(containerArray, input_path, outputName, true, streamed, slabSize));
+  }
+
+  int TestITKPatchBasedDenoisingImageSinglePrecisionTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/cthead1.png");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    FloatArrayType::Pointer output = RunSinglePrecision(containerArray, input_path, "Denoised", false, 0);
+    DREAM3D_REQUIRE_NE(output.get(), 0);
+
+    // The float pixels match the double ones
+    DoubleArrayType::Pointer baseline = std::dynamic_pointer_cast<DoubleArrayType>(RunFilter(containerArray, input_path, "DoublePrecision", false, false, 0));
+    DREAM3D_REQUIRE_NE(baseline.get(), 0);
+    DREAM3D_REQUIRE_EQUAL(output->getNumberOfTuples(), baseline->getNumberOfTuples());
+    for(size_t i = 0; i < output->getNumberOfTuples(); i++)
+    {
+      DREAM3D_REQUIRED(std::abs(output->getValue(i) - baseline->getValue(i)), <=, 0.9);
+    }
+    return 0;
+  }
+
+  int TestITKPatchBasedDenoisingImageStreamedTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/cthead1.png");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    FloatArrayType::Pointer whole = RunSinglePrecision(containerArray, input_path, "Whole", false, 0);
+    DREAM3D_REQUIRE_NE(whole.get(), 0);
+
+    // A slab holding every slice is the whole image
+    FloatArrayType::Pointer single = RunSinglePrecision(containerArray, input_path, "SingleSlab", true, 100000);
+    DREAM3D_REQUIRE_NE(single.get(), 0);
+    DREAM3D_REQUIRE_EQUAL(single->getNumberOfTuples(), whole->getNumberOfTuples());
+    for(size_t i = 0; i < whole->getNumberOfTuples(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(single->getValue(i), whole->getValue(i));
+    }
+
+    // Smaller slabs sample other patches, but denoise the image as much
+    FloatArrayType::Pointer slabs = RunSinglePrecision(containerArray, input_path, "Slabs", true, 16);
+    DREAM3D_REQUIRE_NE(slabs.get(), 0);
+    DREAM3D_REQUIRE_EQUAL(slabs->getNumberOfTuples(), whole->getNumberOfTuples());
+    double difference = 0.0;
+    for(size_t i = 0; i < whole->getNumberOfTuples(); i++)
+    {
+      difference += std::abs(slabs->getValue(i) - whole->getValue(i));
+    }
+    DREAM3D_REQUIRED(difference / whole->getNumberOfTuples(), <, 5.0);
+    return 0;
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -65,6 +158,8 @@ public:
     DREAM3D_REGISTER_TEST(this->TestFilterAvailability("ITKPatchBasedDenoisingImage"));
 
     DREAM3D_REGISTER_TEST(TestITKPatchBasedDenoisingImagedefaultTest());
+    DREAM3D_REGISTER_TEST(TestITKPatchBasedDenoisingImageSinglePrecisionTest());
+    DREAM3D_REGISTER_TEST(TestITKPatchBasedDenoisingImageStreamedTest());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
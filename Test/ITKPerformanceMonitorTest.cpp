@@ -0,0 +1,121 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKTestBase.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageBase.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKPerformanceMonitor.h"
+
+class ITKPerformanceMonitorTest : public ITKTestBase
+{
+
+public:
+  ITKPerformanceMonitorTest()
+  {
+  }
+  virtual ~ITKPerformanceMonitorTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  // Returns the in place ITKAbsImage filter applied to a short image
+  // -----------------------------------------------------------------------------
+  AbstractFilter::Pointer CreateAbsFilter(DataContainerArray::Pointer containerArray)
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Slice-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    this->ReadImage(input_filename, containerArray, input_path);
+    QVariantMap properties;
+    properties["SelectedCellArrayPath"] = QVariant::fromValue(input_path);
+    properties["SaveAsNewArray"] = false;
+    AbstractFilter::Pointer filter = CreateFilter("ITKAbsImage", properties);
+    filter->setDataContainerArray(containerArray);
+    return filter;
+  }
+
+  int TestITKPerformanceMonitorPhaseRecordsTest()
+  {
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    AbstractFilter::Pointer filter = CreateAbsFilter(containerArray);
+    ITKImageBase::Pointer imageFilter = std::dynamic_pointer_cast<ITKImageBase>(filter);
+    DREAM3D_REQUIRE_NE(imageFilter.get(), 0);
+    QString traceFile = UnitTest::TestTempDir + QString("/ITKPerformanceMonitor.csv");
+    FilesToRemove << traceFile;
+    DREAM3D_REQUIRE_EQUAL(ITKPerformanceMonitor::Instance().setTraceFile(traceFile), true);
+    filter->execute();
+    ITKPerformanceMonitor::Instance().setTraceFile(QString());
+    ITKPerformanceMonitor::Instance().setEnabled(false);
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    const std::vector<ITKPerformanceMonitor::PhaseRecord>& records = imageFilter->getPerformanceRecords();
+    QStringList phases;
+    for(const ITKPerformanceMonitor::PhaseRecord& record : records)
+    {
+      phases << record.phase;
+      DREAM3D_REQUIRED(record.invocation, >, 0);
+      DREAM3D_REQUIRED(record.wallTime, >=, 0.0);
+      DREAM3D_REQUIRED(record.peakResidentSizeDelta, >=, 0);
+      // The filter runs in place
+      DREAM3D_REQUIRE_EQUAL(record.allocatedBytes, 0);
+    }
+    DREAM3D_REQUIRE_EQUAL(phases.contains("WrapInput"), true);
+    DREAM3D_REQUIRE_EQUAL(phases.contains("Update"), true);
+    DREAM3D_REQUIRE_EQUAL(phases.contains("WrapOutput"), true);
+    // One line per phase after the header
+    QFile file(traceFile);
+    DREAM3D_REQUIRE_EQUAL(file.open(QIODevice::ReadOnly | QIODevice::Text), true);
+    QStringList lines = QString(file.readAll()).split('\n', QString::SkipEmptyParts);
+    DREAM3D_REQUIRE_EQUAL(lines.size(), static_cast<int>(records.size()) + 1);
+    // Disabled monitoring records nothing
+    filter->execute();
+    DREAM3D_REQUIRE_EQUAL(imageFilter->getPerformanceRecords().empty(), true);
+    return 0;
+  }
+
+  int TestITKPerformanceMonitorTraceEventTest()
+  {
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    AbstractFilter::Pointer filter = CreateAbsFilter(containerArray);
+    ITKImageBase::Pointer imageFilter = std::dynamic_pointer_cast<ITKImageBase>(filter);
+    DREAM3D_REQUIRE_NE(imageFilter.get(), 0);
+    QString traceFile = UnitTest::TestTempDir + QString("/ITKPerformanceMonitor.json");
+    FilesToRemove << traceFile;
+    DREAM3D_REQUIRE_EQUAL(ITKPerformanceMonitor::Instance().setTraceFile(traceFile), true);
+    filter->execute();
+    ITKPerformanceMonitor::Instance().setTraceFile(QString());
+    ITKPerformanceMonitor::Instance().setEnabled(false);
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    // An opening bracket, then one complete event per phase
+    QFile file(traceFile);
+    DREAM3D_REQUIRE_EQUAL(file.open(QIODevice::ReadOnly | QIODevice::Text), true);
+    QStringList lines = QString(file.readAll()).split('\n', QString::SkipEmptyParts);
+    DREAM3D_REQUIRE_EQUAL(lines.size(), static_cast<int>(imageFilter->getPerformanceRecords().size()) + 1);
+    DREAM3D_REQUIRE_EQUAL(lines[0], QString("["));
+    for(int i = 1; i < lines.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(lines[i].startsWith("{\"name\":"), true);
+      DREAM3D_REQUIRE_EQUAL(lines[i].contains("\"ph\":\"X\""), true);
+    }
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()() override
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestITKPerformanceMonitorPhaseRecordsTest());
+    DREAM3D_REGISTER_TEST(TestITKPerformanceMonitorTraceEventTest());
+
+    if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
+    {
+      DREAM3D_REGISTER_TEST(this->RemoveTestFiles())
+    }
+  }
+
+private:
+  ITKPerformanceMonitorTest(const ITKPerformanceMonitorTest&); // Copy Constructor Not Implemented
+  void operator=(const ITKPerformanceMonitorTest&);            // Move assignment Not Implemented
+};
@@ -0,0 +1,164 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKTestBase.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKPointwiseExpression.h"
+
+class ITKPointwiseExpressionImageTest : public ITKTestBase
+{
+
+public:
+  ITKPointwiseExpressionImageTest()
+  {
+  }
+  virtual ~ITKPointwiseExpressionImageTest()
+  {
+  }
+
+  int TestITKPointwiseExpressionCompileTest()
+  {
+    ITKPointwiseExpression expression;
+    DREAM3D_REQUIRE_EQUAL(expression.compile("shiftscale(x, 1, 2)^2"), true);
+    DREAM3D_REQUIRE_EQUAL(expression.evaluate(3.0), 64.0);
+    DREAM3D_REQUIRE_EQUAL(expression.compile("-x^2 + 2^-1"), true);
+    DREAM3D_REQUIRE_EQUAL(expression.evaluate(3.0), -8.5);
+    DREAM3D_REQUIRE_EQUAL(expression.compile("clamp(invert(x, 255), 0, 100)"), true);
+    DREAM3D_REQUIRE_EQUAL(expression.evaluate(100.0), 100.0);
+    DREAM3D_REQUIRE_EQUAL(expression.evaluate(200.0), 55.0);
+    // The constants are computed when the expression is compiled: x * 6 is a single instruction after x
+    DREAM3D_REQUIRE_EQUAL(expression.compile("x * (2 * sqrt(9))"), true);
+    DREAM3D_REQUIRE_EQUAL(expression.getNumberOfInstructions(), 2);
+
+    // A block of values gives the values of the expression one by one
+    DREAM3D_REQUIRE_EQUAL(expression.compile("sigmoid(sqrt(abs(x - 100)), 2, 10, 0, 255) + x * x"), true);
+    std::vector<double> values(ITKPointwiseExpression::BlockSize);
+    for(size_t i = 0; i < values.size(); i++)
+    {
+      values[i] = static_cast<double>(i);
+    }
+    std::vector<double> scratch(expression.getScratchSize());
+    expression.evaluate(values.data(), values.size(), scratch.data());
+    for(size_t i = 0; i < values.size(); i++)
+    {
+      DREAM3D_REQUIRE_EQUAL(values[i], expression.evaluate(static_cast<double>(i)));
+    }
+
+    DREAM3D_REQUIRE_EQUAL(expression.compile("sqrt(x, 2)"), false);
+    DREAM3D_REQUIRE_EQUAL(expression.isValid(), false);
+    DREAM3D_REQUIRE_EQUAL(expression.compile("foo(x)"), false);
+    DREAM3D_REQUIRE_EQUAL(expression.compile("(x + 1"), false);
+    DREAM3D_REQUIRE_EQUAL(expression.compile(""), false);
+    return 0;
+  }
+
+  int TestITKPointwiseExpressionImageMatchesChainTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Slice-Float.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataArrayPath chain_path("ChainContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    this->ReadImage(input_filename, containerArray, chain_path);
+
+    // Abs, Shift Scale and Sqrt filters one after the other
+    QVariantMap chainProperties;
+    chainProperties["SelectedCellArrayPath"] = QVariant::fromValue(chain_path);
+    chainProperties["SaveAsNewArray"] = false;
+    AbstractFilter::Pointer absFilter = CreateFilter("ITKAbsImage", chainProperties);
+    QVariantMap shiftScaleProperties = chainProperties;
+    shiftScaleProperties["Shift"] = 1.0;
+    shiftScaleProperties["Scale"] = 0.5;
+    AbstractFilter::Pointer shiftScaleFilter = CreateFilter("ITKShiftScaleImage", shiftScaleProperties);
+    AbstractFilter::Pointer sqrtFilter = CreateFilter("ITKSqrtImage", chainProperties);
+    for(const AbstractFilter::Pointer& filter : {absFilter, shiftScaleFilter, sqrtFilter})
+    {
+      filter->setDataContainerArray(containerArray);
+      filter->execute();
+      DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    }
+
+    QVariantMap properties;
+    properties["SelectedCellArrayPath"] = QVariant::fromValue(input_path);
+    properties["SaveAsNewArray"] = false;
+    properties["Expression"] = QString("sqrt(shiftscale(abs(x), 1, 0.5))");
+    AbstractFilter::Pointer filter = CreateFilter("ITKPointwiseExpressionImage", properties);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    WriteImage("ITKPointwiseExpressionImageMatchesChain.nrrd", containerArray, input_path);
+    int res = this->CompareImages(containerArray, input_path, chain_path, 0.0001);
+    DREAM3D_REQUIRE_EQUAL(res, 0);
+    // No intermediate array is left in the Attribute Matrix
+    AttributeMatrix::Pointer am = containerArray->getAttributeMatrix(input_path);
+    DREAM3D_REQUIRE_EQUAL(am->getAttributeArrayNames().size(), 1);
+    return 0;
+  }
+
+  int TestITKPointwiseExpressionImageshortTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Slice-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    QVariantMap properties;
+    properties["SelectedCellArrayPath"] = QVariant::fromValue(input_path);
+    properties["SaveAsNewArray"] = false;
+    properties["Expression"] = QString("abs(x)");
+    AbstractFilter::Pointer filter = CreateFilter("ITKPointwiseExpressionImage", properties);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    WriteImage("ITKPointwiseExpressionImageshort.nrrd", containerArray, input_path);
+    QString baseline_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Baseline/BasicFilters_AbsImageFilter_short.nrrd");
+    DataArrayPath baseline_path("BContainer", "BAttributeMatrixName", "BAttributeArrayName");
+    this->ReadImage(baseline_filename, containerArray, baseline_path);
+    int res = this->CompareImages(containerArray, input_path, baseline_path, 0.01);
+    DREAM3D_REQUIRE_EQUAL(res, 0);
+    return 0;
+  }
+
+  int TestITKPointwiseExpressionImageInvalidTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Slice-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    QVariantMap properties;
+    properties["SelectedCellArrayPath"] = QVariant::fromValue(input_path);
+    properties["SaveAsNewArray"] = false;
+    properties["Expression"] = QString("sqrt(y)");
+    AbstractFilter::Pointer filter = CreateFilter("ITKPointwiseExpressionImage", properties);
+    filter->setDataContainerArray(containerArray);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -55580);
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()() override
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(this->TestFilterAvailability("ITKPointwiseExpressionImage"));
+
+    DREAM3D_REGISTER_TEST(TestITKPointwiseExpressionCompileTest());
+    DREAM3D_REGISTER_TEST(TestITKPointwiseExpressionImageMatchesChainTest());
+    DREAM3D_REGISTER_TEST(TestITKPointwiseExpressionImageshortTest());
+    DREAM3D_REGISTER_TEST(TestITKPointwiseExpressionImageInvalidTest());
+
+    if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
+    {
+      DREAM3D_REGISTER_TEST(this->RemoveTestFiles())
+    }
+  }
+
+private:
+  ITKPointwiseExpressionImageTest(const ITKPointwiseExpressionImageTest&); // Copy Constructor Not Implemented
+  void operator=(const ITKPointwiseExpressionImageTest&);                  // Move assignment Not Implemented
+};
@@ -0,0 +1,196 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include <cmath>
+#include <limits>
+
+#include "ITKTestBase.h"
+
+class ITKProjectionStatisticsImageTest : public ITKTestBase
+{
+
+public:
+  ITKProjectionStatisticsImageTest()
+  {
+  }
+  virtual ~ITKProjectionStatisticsImageTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> std::shared_ptr<T> GetArray(DataContainerArray::Pointer& containerArray, const QString& containerName, const QString& arrayName)
+  {
+    AttributeMatrix::Pointer am = containerArray->getAttributeMatrix(DataArrayPath(containerName, "CellData", ""));
+    if(nullptr == am)
+    {
+      return std::shared_ptr<T>();
+    }
+    return std::dynamic_pointer_cast<T>(am->getAttributeArray(arrayName));
+  }
+
+  int TestITKProjectionStatisticsImageAllAxesTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Float.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    QVariantMap properties;
+    properties["SelectedCellArrayPath"] = QVariant::fromValue(input_path);
+    properties["ProjectX"] = true;
+    properties["ProjectY"] = true;
+    properties["ProjectZ"] = true;
+    properties["ComputeSum"] = true;
+    AbstractFilter::Pointer filter = CreateFilter("ITKProjectionStatisticsImage", properties);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+
+    // Statistics computed pixel by pixel, in double precision
+    FloatArrayType::Pointer input = std::dynamic_pointer_cast<FloatArrayType>(containerArray->getAttributeMatrix(input_path)->getAttributeArray(input_path.getDataArrayName()));
+    DREAM3D_REQUIRE_VALID_POINTER(input.get());
+    size_t dims[3] = {0, 0, 0};
+    std::tie(dims[0], dims[1], dims[2]) = containerArray->getDataContainer(input_path.getDataContainerName())->getGeometryAs<ImageGeom>()->getDimensions();
+    for(int axis = 0; axis < 3; axis++)
+    {
+      const QString containerName = QString("Projection") + QString(QChar('X' + axis));
+      FloatArrayType::Pointer maximum = GetArray<FloatArrayType>(containerArray, containerName, "Maximum");
+      FloatArrayType::Pointer minimum = GetArray<FloatArrayType>(containerArray, containerName, "Minimum");
+      DoubleArrayType::Pointer mean = GetArray<DoubleArrayType>(containerArray, containerName, "Mean");
+      DoubleArrayType::Pointer standardDeviation = GetArray<DoubleArrayType>(containerArray, containerName, "StandardDeviation");
+      DoubleArrayType::Pointer sum = GetArray<DoubleArrayType>(containerArray, containerName, "Sum");
+      DREAM3D_REQUIRE_VALID_POINTER(maximum.get());
+      DREAM3D_REQUIRE_VALID_POINTER(minimum.get());
+      DREAM3D_REQUIRE_VALID_POINTER(mean.get());
+      DREAM3D_REQUIRE_VALID_POINTER(standardDeviation.get());
+      DREAM3D_REQUIRE_VALID_POINTER(sum.get());
+      size_t planeDims[3] = {dims[0], dims[1], dims[2]};
+      planeDims[axis] = 1;
+      DREAM3D_REQUIRE_EQUAL(maximum->getNumberOfTuples(), planeDims[0] * planeDims[1] * planeDims[2]);
+
+      const size_t n = dims[axis];
+      size_t stride[3] = {1, dims[0], dims[0] * dims[1]};
+      for(size_t k = 0; k < planeDims[2]; k++)
+      {
+        for(size_t j = 0; j < planeDims[1]; j++)
+        {
+          for(size_t i = 0; i < planeDims[0]; i++)
+          {
+            const size_t first = i * stride[0] + j * stride[1] + k * stride[2];
+            const size_t pixel = i + planeDims[0] * (j + planeDims[1] * k);
+            float expectedMaximum = std::numeric_limits<float>::lowest();
+            float expectedMinimum = std::numeric_limits<float>::max();
+            double expectedSum = 0.0;
+            for(size_t l = 0; l < n; l++)
+            {
+              const float value = input->getValue(first + l * stride[axis]);
+              expectedMaximum = std::max(expectedMaximum, value);
+              expectedMinimum = std::min(expectedMinimum, value);
+              expectedSum += value;
+            }
+            const double expectedMean = expectedSum / n;
+            double m2 = 0.0;
+            for(size_t l = 0; l < n; l++)
+            {
+              const double delta = input->getValue(first + l * stride[axis]) - expectedMean;
+              m2 += delta * delta;
+            }
+            const double expectedStandardDeviation = n > 1 ? std::sqrt(m2 / (n - 1)) : 0.0;
+            const double tolerance = 1e-9 * (1.0 + std::abs(expectedSum));
+            DREAM3D_REQUIRE_EQUAL(maximum->getValue(pixel), expectedMaximum);
+            DREAM3D_REQUIRE_EQUAL(minimum->getValue(pixel), expectedMinimum);
+            DREAM3D_REQUIRED(std::abs(sum->getValue(pixel) - expectedSum), <=, tolerance);
+            DREAM3D_REQUIRED(std::abs(mean->getValue(pixel) - expectedMean), <=, tolerance);
+            DREAM3D_REQUIRED(std::abs(standardDeviation->getValue(pixel) - expectedStandardDeviation), <=, 1e-6 * (1.0 + expectedStandardDeviation));
+          }
+        }
+      }
+    }
+    return 0;
+  }
+
+  int TestITKProjectionStatisticsImageMatchesMaximumProjectionTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Float.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    QVariantMap properties;
+    properties["SelectedCellArrayPath"] = QVariant::fromValue(input_path);
+    AbstractFilter::Pointer filter = CreateFilter("ITKProjectionStatisticsImage", properties);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    // Only the projection along Z is computed by default, without the sum
+    DREAM3D_REQUIRE_EQUAL(containerArray->getDataContainer("ProjectionX").get(), 0);
+    DREAM3D_REQUIRE_EQUAL(GetArray<DoubleArrayType>(containerArray, "ProjectionZ", "Sum").get(), 0);
+
+    QVariantMap maximumProperties;
+    maximumProperties["SelectedCellArrayPath"] = QVariant::fromValue(input_path);
+    maximumProperties["SaveAsNewArray"] = false;
+    maximumProperties["ProjectionDimension"] = 2.0;
+    AbstractFilter::Pointer maximumFilter = CreateFilter("ITKMaximumProjectionImage", maximumProperties);
+    maximumFilter->setDataContainerArray(containerArray);
+    maximumFilter->execute();
+    DREAM3D_REQUIRED(maximumFilter->getErrorCondition(), >=, 0);
+
+    DataArrayPath maximum_path("ProjectionZ", "CellData", "Maximum");
+    WriteImage("ITKProjectionStatisticsImageMaximum.nrrd", containerArray, maximum_path);
+    int res = this->CompareImages(containerArray, maximum_path, input_path, 0.0);
+    DREAM3D_REQUIRE_EQUAL(res, 0);
+    return 0;
+  }
+
+  int TestITKProjectionStatisticsImageInvalidTest()
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    QVariantMap properties;
+    properties["SelectedCellArrayPath"] = QVariant::fromValue(input_path);
+    properties["ProjectZ"] = false;
+    AbstractFilter::Pointer filter = CreateFilter("ITKProjectionStatisticsImage", properties);
+    filter->setDataContainerArray(containerArray);
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -55590);
+
+    QVariant var;
+    var.setValue(true);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("ProjectZ", var), true);
+    var.setValue(false);
+    for(const char* property : {"ComputeMaximum", "ComputeMinimum", "ComputeMean", "ComputeStandardDeviation", "ComputeSum"})
+    {
+      DREAM3D_REQUIRE_EQUAL(filter->setProperty(property, var), true);
+    }
+    filter->preflight();
+    DREAM3D_REQUIRE_EQUAL(filter->getErrorCondition(), -55591);
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()() override
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(this->TestFilterAvailability("ITKProjectionStatisticsImage"));
+
+    DREAM3D_REGISTER_TEST(TestITKProjectionStatisticsImageAllAxesTest());
+    DREAM3D_REGISTER_TEST(TestITKProjectionStatisticsImageMatchesMaximumProjectionTest());
+    DREAM3D_REGISTER_TEST(TestITKProjectionStatisticsImageInvalidTest());
+
+    if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
+    {
+      DREAM3D_REGISTER_TEST(this->RemoveTestFiles())
+    }
+  }
+
+private:
+  ITKProjectionStatisticsImageTest(const ITKProjectionStatisticsImageTest&); // Copy Constructor Not Implemented
+  void operator=(const ITKProjectionStatisticsImageTest&);                   // Move assignment Not Implemented
+};
@@ -0,0 +1,166 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKTestBase.h"
+
+#include <itkNumericTraits.h>
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKScaleSpaceCache.h"
+
+class ITKScaleSpaceCacheTest : public ITKTestBase
+{
+
+public:
+  ITKScaleSpaceCacheTest()
+  {
+  }
+  virtual ~ITKScaleSpaceCacheTest()
+  {
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  DataContainerArray::Pointer ReadInput(const DataArrayPath& input_path)
+  {
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Float.nrrd");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    return containerArray;
+  }
+
+  // -----------------------------------------------------------------------------
+  // Runs the filter on the input array, storing its output in a new array
+  // -----------------------------------------------------------------------------
+  int RunFilter(const QString& filtName, DataContainerArray::Pointer containerArray, const DataArrayPath& input_path, const QString& outputName)
+  {
+    QVariantMap properties;
+    properties["SelectedCellArrayPath"] = QVariant::fromValue(input_path);
+    properties["SaveAsNewArray"] = true;
+    properties["NewCellArrayName"] = outputName;
+    AbstractFilter::Pointer filter = CreateFilter(filtName, properties);
+    QVariant var;
+    var.setValue(1.5);
+    // The smoothing filter reads a sigma per axis and does not have this property
+    filter->setProperty("Sigma", var);
+    filter->setDataContainerArray(containerArray);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    return 0;
+  }
+
+  int TestITKScaleSpaceCacheSharedScalesTest()
+  {
+    ITKScaleSpaceCache& cache = ITKScaleSpaceCache::Instance();
+    const qint64 budget = cache.getBudget();
+    cache.setBudget(qint64(512) * 1024 * 1024);
+    cache.clear();
+
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = ReadInput(input_path);
+    DREAM3D_REQUIRE_EQUAL(RunFilter("ITKGradientMagnitudeRecursiveGaussianImage", containerArray, input_path, "Gradient"), 0);
+    DREAM3D_REQUIRED(cache.size(), >, 0);
+    // The Laplacian starts from the images smoothed along all the axes but one, cached by the gradient
+    const quint64 hits = cache.getHits();
+    DREAM3D_REQUIRE_EQUAL(RunFilter("ITKLaplacianRecursiveGaussianImage", containerArray, input_path, "Laplacian"), 0);
+    DREAM3D_REQUIRED(cache.getHits(), >, hits);
+    QString md5Laplacian;
+    GetMD5FromDataContainer(containerArray, DataArrayPath("TestContainer", "TestAttributeMatrixName", "Laplacian"), md5Laplacian);
+
+    // A Laplacian computed from an empty cache is the same
+    cache.clear();
+    DREAM3D_REQUIRE_EQUAL(RunFilter("ITKLaplacianRecursiveGaussianImage", containerArray, input_path, "ColdLaplacian"), 0);
+    QString md5ColdLaplacian;
+    GetMD5FromDataContainer(containerArray, DataArrayPath("TestContainer", "TestAttributeMatrixName", "ColdLaplacian"), md5ColdLaplacian);
+    DREAM3D_REQUIRE_EQUAL(md5ColdLaplacian, md5Laplacian);
+
+    // And matches the ITK filter, up to the rounding of the intermediate images
+    cache.setBudget(0);
+    DREAM3D_REQUIRE_EQUAL(RunFilter("ITKLaplacianRecursiveGaussianImage", containerArray, input_path, "ITKLaplacian"), 0);
+    DREAM3D_REQUIRE_EQUAL(cache.size(), 0);
+    int res = this->CompareImages(containerArray, DataArrayPath("TestContainer", "TestAttributeMatrixName", "ITKLaplacian"), DataArrayPath("TestContainer", "TestAttributeMatrixName", "Laplacian"), 0.0001);
+    DREAM3D_REQUIRE_EQUAL(res, 0);
+
+    cache.setBudget(budget);
+    cache.clear();
+    return 0;
+  }
+
+  int TestITKScaleSpaceCacheModifiedInputTest()
+  {
+    ITKScaleSpaceCache& cache = ITKScaleSpaceCache::Instance();
+    const qint64 budget = cache.getBudget();
+    cache.setBudget(qint64(512) * 1024 * 1024);
+    cache.clear();
+
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = ReadInput(input_path);
+    DREAM3D_REQUIRE_EQUAL(RunFilter("ITKGradientMagnitudeRecursiveGaussianImage", containerArray, input_path, "Gradient"), 0);
+
+    // The same array, modified in place, no longer matches the cached images
+    FloatArrayType::Pointer input = std::dynamic_pointer_cast<FloatArrayType>(containerArray->getAttributeMatrix(input_path)->getAttributeArray(input_path.getDataArrayName()));
+    DREAM3D_REQUIRE_NE(input.get(), 0);
+    input->setValue(0, input->getValue(0) + 100.0f);
+    const quint64 hits = cache.getHits();
+    DREAM3D_REQUIRE_EQUAL(RunFilter("ITKGradientMagnitudeRecursiveGaussianImage", containerArray, input_path, "ModifiedGradient"), 0);
+    DREAM3D_REQUIRE_EQUAL(cache.getHits(), hits);
+    QString md5Gradient;
+    GetMD5FromDataContainer(containerArray, DataArrayPath("TestContainer", "TestAttributeMatrixName", "Gradient"), md5Gradient);
+    QString md5ModifiedGradient;
+    GetMD5FromDataContainer(containerArray, DataArrayPath("TestContainer", "TestAttributeMatrixName", "ModifiedGradient"), md5ModifiedGradient);
+    DREAM3D_REQUIRE_NE(md5ModifiedGradient, md5Gradient);
+
+    cache.setBudget(budget);
+    cache.clear();
+    return 0;
+  }
+
+  int TestITKScaleSpaceCacheBudgetTest()
+  {
+    ITKScaleSpaceCache& cache = ITKScaleSpaceCache::Instance();
+    const qint64 budget = cache.getBudget();
+    cache.clear();
+
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = ReadInput(input_path);
+    const qint64 imageBytes = static_cast<qint64>(containerArray->getAttributeMatrix(input_path)->getNumberOfTuples() * sizeof(itk::NumericTraits<float>::RealType));
+    // Room for two images of the real type of the input: the least recently used ones are dropped
+    cache.setBudget(2 * imageBytes);
+    DREAM3D_REQUIRE_EQUAL(RunFilter("ITKLaplacianRecursiveGaussianImage", containerArray, input_path, "Laplacian"), 0);
+    DREAM3D_REQUIRED(cache.getMemoryUsage(), <=, 2 * imageBytes);
+    DREAM3D_REQUIRED(cache.size(), <=, 2);
+    DREAM3D_REQUIRED(cache.size(), >, 0);
+
+    // Shrinking the budget drops images right away
+    cache.setBudget(imageBytes - 1);
+    DREAM3D_REQUIRE_EQUAL(cache.size(), 0);
+    DREAM3D_REQUIRE_EQUAL(cache.getMemoryUsage(), 0);
+
+    cache.setBudget(budget);
+    cache.clear();
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()() override
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestITKScaleSpaceCacheSharedScalesTest());
+    DREAM3D_REGISTER_TEST(TestITKScaleSpaceCacheModifiedInputTest());
+    DREAM3D_REGISTER_TEST(TestITKScaleSpaceCacheBudgetTest());
+
+    if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
+    {
+      DREAM3D_REGISTER_TEST(this->RemoveTestFiles())
+    }
+  }
+
+private:
+  ITKScaleSpaceCacheTest(const ITKScaleSpaceCacheTest&); // Copy Constructor Not Implemented
+  void operator=(const ITKScaleSpaceCacheTest&);         // Move assignment Not Implemented
+};
@@ -138,6 +138,55 @@ int TestITKShotNoiseImagergbTest()
 }
 
 
+int TestITKShotNoiseImageCounterBasedTest()
+{
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/RA-Short.nrrd");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    // A slab size of 0 processes the whole image at once
+    const QStringList outputNames = {"OneThread", "FourThreads", "Streamed", "OtherSeed"};
+    const int numberOfThreads[4] = {1, 4, 3, 4};
+    const int slabSizes[4] = {0, 0, 1, 0};
+    const double seeds[4] = {123, 123, 123, 124};
+    for(int i = 0; i < outputNames.size(); i++)
+    {
+        QVariantMap properties;
+        properties["SelectedCellArrayPath"] = QVariant::fromValue(input_path);
+        properties["SaveAsNewArray"] = true;
+        properties["NewCellArrayName"] = outputNames[i];
+        properties["CounterBasedGenerator"] = true;
+        properties["Seed"] = seeds[i];
+        properties["NumberOfThreads"] = numberOfThreads[i];
+        properties["StreamedExecution"] = slabSizes[i] > 0;
+        if(slabSizes[i] > 0)
+        {
+            properties["SlabSize"] = slabSizes[i];
+        }
+        AbstractFilter::Pointer filter = CreateFilter("ITKShotNoiseImage", properties);
+        filter->setDataContainerArray(containerArray);
+        filter->execute();
+        DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+        DREAM3D_REQUIRED(filter->getWarningCondition(), >=, 0);
+    }
+    QString md5OneThread;
+    GetMD5FromDataContainer(containerArray, DataArrayPath("TestContainer", "TestAttributeMatrixName", "OneThread"), md5OneThread);
+    QString md5FourThreads;
+    GetMD5FromDataContainer(containerArray, DataArrayPath("TestContainer", "TestAttributeMatrixName", "FourThreads"), md5FourThreads);
+    QString md5Streamed;
+    GetMD5FromDataContainer(containerArray, DataArrayPath("TestContainer", "TestAttributeMatrixName", "Streamed"), md5Streamed);
+    QString md5OtherSeed;
+    GetMD5FromDataContainer(containerArray, DataArrayPath("TestContainer", "TestAttributeMatrixName", "OtherSeed"), md5OtherSeed);
+    // The noise only depends on the seed and the pixels
+    DREAM3D_REQUIRE_EQUAL(md5FourThreads, md5OneThread);
+    DREAM3D_REQUIRE_EQUAL(md5Streamed, md5OneThread);
+    DREAM3D_REQUIRE_NE(md5OtherSeed, md5OneThread);
+    QString md5Input;
+    GetMD5FromDataContainer(containerArray, input_path, md5Input);
+    DREAM3D_REQUIRE_NE(md5OneThread, md5Input);
+    return 0;
+}
+
 
   // -----------------------------------------------------------------------------
   //
@@ -151,6 +200,7 @@ int TestITKShotNoiseImagergbTest()
     DREAM3D_REGISTER_TEST( TestITKShotNoiseImage2dTest());
     DREAM3D_REGISTER_TEST( TestITKShotNoiseImage3dTest());
     DREAM3D_REGISTER_TEST( TestITKShotNoiseImagergbTest());
+    DREAM3D_REGISTER_TEST( TestITKShotNoiseImageCounterBasedTest());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
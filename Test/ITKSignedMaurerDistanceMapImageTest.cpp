@@ -4,6 +4,9 @@
 // Insert your license & copyright information here
 // -----------------------------------------------------------------------------
 
+#include <cmath>
+#include <limits>
+
 #include "ITKTestBase.h"
 // Auto includes
 #include <SIMPLib/FilterParameters/BooleanFilterParameter.h>
@@ -54,6 +57,90 @@ public:
 }
 
 
+  int TestITKSignedMaurerDistanceMapImageExactTest()
+  {
+    // Squared, signed and unsigned distances of the same image, checked against the nearest contour pixel
+    QString input_filename = UnitTest::DataDir + QString("/Data/JSONFilters/Input/2th_cthead1.png");
+    DataArrayPath input_path("TestContainer", "TestAttributeMatrixName", "TestAttributeArrayName");
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    this->ReadImage(input_filename, containerArray, input_path);
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName("ITKSignedMaurerDistanceMapImage");
+    DREAM3D_REQUIRE_NE(filterFactory.get(), 0);
+    AbstractFilter::Pointer filter = filterFactory->create();
+    QVariant var;
+    var.setValue(input_path);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("SelectedCellArrayPath", var), true);
+    var.setValue(true);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("SaveAsNewArray", var), true);
+    filter->setDataContainerArray(containerArray);
+    var.setValue(QString("Squared"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("NewCellArrayName", var), true);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+    var.setValue(QString("Distance"));
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("NewCellArrayName", var), true);
+    var.setValue(false);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("SquaredDistance", var), true);
+    var.setValue(true);
+    DREAM3D_REQUIRE_EQUAL(filter->setProperty("InsideIsPositive", var), true);
+    filter->execute();
+    DREAM3D_REQUIRED(filter->getErrorCondition(), >=, 0);
+
+    AttributeMatrix::Pointer am = containerArray->getAttributeMatrix(input_path);
+    UInt8ArrayType::Pointer input = std::dynamic_pointer_cast<UInt8ArrayType>(am->getAttributeArray(input_path.getDataArrayName()));
+    FloatArrayType::Pointer squared = std::dynamic_pointer_cast<FloatArrayType>(am->getAttributeArray("Squared"));
+    FloatArrayType::Pointer distance = std::dynamic_pointer_cast<FloatArrayType>(am->getAttributeArray("Distance"));
+    DREAM3D_REQUIRE_VALID_POINTER(input.get());
+    DREAM3D_REQUIRE_VALID_POINTER(squared.get());
+    DREAM3D_REQUIRE_VALID_POINTER(distance.get());
+    size_t dims[3] = {0, 0, 0};
+    std::tie(dims[0], dims[1], dims[2]) = containerArray->getDataContainer(input_path.getDataContainerName())->getGeometryAs<ImageGeom>()->getDimensions();
+
+    // Contour: object pixels with a background pixel among their 8 neighbors
+    const int64_t nx = static_cast<int64_t>(dims[0]);
+    const int64_t ny = static_cast<int64_t>(dims[1]);
+    std::vector<int64_t> contour;
+    for(int64_t y = 0; y < ny; y++)
+    {
+      for(int64_t x = 0; x < nx; x++)
+      {
+        if(input->getValue(y * nx + x) == 0)
+        {
+          continue;
+        }
+        bool border = false;
+        for(int64_t j = std::max<int64_t>(y - 1, 0); j <= std::min(y + 1, ny - 1); j++)
+        {
+          for(int64_t i = std::max<int64_t>(x - 1, 0); i <= std::min(x + 1, nx - 1); i++)
+          {
+            border = border || input->getValue(j * nx + i) == 0;
+          }
+        }
+        if(border)
+        {
+          contour.push_back(y * nx + x);
+        }
+      }
+    }
+    DREAM3D_REQUIRE(!contour.empty());
+    for(int64_t offset = 0; offset < nx * ny; offset += 37)
+    {
+      double expected = std::numeric_limits<double>::max();
+      for(int64_t site : contour)
+      {
+        const double dx = static_cast<double>(site % nx - offset % nx);
+        const double dy = static_cast<double>(site / nx - offset / nx);
+        expected = std::min(expected, dx * dx + dy * dy);
+      }
+      const bool inside = input->getValue(offset) != 0;
+      DREAM3D_REQUIRE(std::fabs(squared->getValue(offset) - (inside ? -expected : expected)) < 1.0e-3);
+      DREAM3D_REQUIRE(std::fabs(distance->getValue(offset) - (inside ? std::sqrt(expected) : -std::sqrt(expected))) < 1.0e-3);
+    }
+    return 0;
+  }
+
+
 
   // -----------------------------------------------------------------------------
   //
@@ -65,6 +152,7 @@ public:
     DREAM3D_REGISTER_TEST(this->TestFilterAvailability("ITKSignedMaurerDistanceMapImage"));
 
     DREAM3D_REGISTER_TEST( TestITKSignedMaurerDistanceMapImagedefaultTest());
+    DREAM3D_REGISTER_TEST(TestITKSignedMaurerDistanceMapImageExactTest());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
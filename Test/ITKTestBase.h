@@ -6,6 +6,7 @@
 
 #include <QtCore/QCoreApplication>
 #include <QtCore/QFile>
+#include <QtCore/QVariant>
 
 #include "SIMPLib/Common/SIMPLibSetGetMacros.h"
 #include "SIMPLib/DataArrays/DataArray.hpp"
@@ -65,6 +66,24 @@ public:
     return 0;
   }
 
+  // -----------------------------------------------------------------------------
+  // Creates the filter @p filtName from the FilterManager and sets each of its @p properties
+  // -----------------------------------------------------------------------------
+  AbstractFilter::Pointer CreateFilter(const QString& filtName, const QVariantMap& properties = QVariantMap())
+  {
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName(filtName);
+    DREAM3D_REQUIRE_VALID_POINTER(filterFactory.get());
+    AbstractFilter::Pointer filter = filterFactory->create();
+    DREAM3D_REQUIRE_VALID_POINTER(filter.get());
+    for(QVariantMap::const_iterator it = properties.constBegin(); it != properties.constEnd(); ++it)
+    {
+      bool propWasSet = filter->setProperty(it.key().toLatin1().constData(), it.value());
+      DREAM3D_REQUIRE_EQUAL(propWasSet, true);
+    }
+    return filter;
+  }
+
   template <typename PixelType> double ComputeDiff(itk::Vector<PixelType, 2> p1, itk::Vector<PixelType, 2> p2)
   {
     double diff = static_cast<double>((p1 - p2).GetNorm());
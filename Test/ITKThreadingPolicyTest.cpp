@@ -0,0 +1,85 @@
+// -----------------------------------------------------------------------------
+// Insert your license & copyright information here
+// -----------------------------------------------------------------------------
+
+#include "ITKTestBase.h"
+
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKThreadingPolicy.h"
+
+class ITKThreadingPolicyTest : public ITKTestBase
+{
+
+public:
+  ITKThreadingPolicyTest()
+  {
+  }
+  virtual ~ITKThreadingPolicyTest()
+  {
+  }
+
+  /**
+   * @brief Restores the process-wide thread budget when the test returns, including on a failed check
+   */
+  class ThreadBudgetGuard
+  {
+  public:
+    ThreadBudgetGuard()
+    : m_Budget(ITKThreadingPolicy::Instance().getThreadBudget())
+    {
+    }
+    ~ThreadBudgetGuard()
+    {
+      ITKThreadingPolicy::Instance().setThreadBudget(m_Budget);
+    }
+
+    ThreadBudgetGuard(const ThreadBudgetGuard&) = delete;            // Copy Constructor Not Implemented
+    ThreadBudgetGuard& operator=(const ThreadBudgetGuard&) = delete; // Copy Assignment Not Implemented
+
+  private:
+    int m_Budget;
+  };
+
+  int TestITKThreadingPolicyThreadBudgetTest()
+  {
+    // The thread budget bounds the threads a filter asks for
+    ITKThreadingPolicy& policy = ITKThreadingPolicy::Instance();
+    ThreadBudgetGuard budgetGuard;
+    policy.setThreadBudget(2);
+    DREAM3D_REQUIRE_EQUAL(policy.getThreadBudget(), 2);
+    DREAM3D_REQUIRE_EQUAL(policy.getNumberOfThreads(0), 2);
+    DREAM3D_REQUIRE_EQUAL(policy.getNumberOfThreads(1), 1);
+    DREAM3D_REQUIRE_EQUAL(policy.getNumberOfThreads(8), 2);
+    // 0 restores the default, the CPUs available to the process
+    policy.setThreadBudget(0);
+    DREAM3D_REQUIRE_EQUAL(policy.getThreadBudget(), 0);
+    DREAM3D_REQUIRED(policy.getNumberOfThreads(0), >, 0);
+    DREAM3D_REQUIRE_EQUAL(policy.getNumberOfThreads(1), 1);
+    return 0;
+  }
+
+  int TestITKThreadingPolicyParseCPUListTest()
+  {
+    std::vector<int> cpus;
+    DREAM3D_REQUIRE_EQUAL(ITKThreadingPolicy::ParseCPUList("0-2, 5,4", cpus), true);
+    DREAM3D_REQUIRE_EQUAL(static_cast<int>(cpus.size()), 5);
+    DREAM3D_REQUIRE_EQUAL(cpus[3], 4);
+    DREAM3D_REQUIRE_EQUAL(ITKThreadingPolicy::ParseCPUList("3-1", cpus), false);
+    DREAM3D_REQUIRE_EQUAL(ITKThreadingPolicy::ParseCPUList("1,a", cpus), false);
+    return 0;
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void operator()() override
+  {
+    int err = EXIT_SUCCESS;
+
+    DREAM3D_REGISTER_TEST(TestITKThreadingPolicyThreadBudgetTest());
+    DREAM3D_REGISTER_TEST(TestITKThreadingPolicyParseCPUListTest());
+  }
+
+private:
+  ITKThreadingPolicyTest(const ITKThreadingPolicyTest&); // Copy Constructor Not Implemented
+  void operator=(const ITKThreadingPolicyTest&);         // Move assignment Not Implemented
+};
@@ -31,8 +31,11 @@
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 
+#include <algorithm>
+
 #include "ITKTestBase.h"
 
+#include "SIMPLib/DataArrays/StringDataArray.h"
 #include "SIMPLib/FilterParameters/FileListInfoFilterParameter.h"
 #include "SIMPLib/FilterParameters/FloatVec3FilterParameter.h"
 #include "SIMPLib/Filtering/FilterPipeline.h"
@@ -132,6 +135,147 @@ public:
     DREAM3D_REQUIRE_EQUAL(err, 0)
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestConcurrentImport()
+  {
+    FileListInfo_t fli;
+    fli.PaddingDigits = 2;
+    fli.Ordering = 0;
+    fli.StartIndex = 11;
+    fli.EndIndex = 26;
+    fli.IncrementIndex = 1;
+    fli.InputPath = UnitTest::DataDir + "/Data/Image";
+    fli.FilePrefix = "slice_";
+    fli.FileSuffix = "";
+    fli.FileExtension = "tif";
+
+    // One reader thread decodes the tiles one after the other, 0 decodes them on all the cores
+    for(int numberOfReaderThreads : {1, 0})
+    {
+      FilterManager* fm = FilterManager::Instance();
+      IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName("ImportImageMontage");
+      DREAM3D_REQUIRE_VALID_POINTER(filterFactory.get());
+      AbstractFilter::Pointer import = filterFactory->create();
+      DataContainerArray::Pointer containerArray = DataContainerArray::New();
+      import->setDataContainerArray(containerArray);
+
+      QVariant var;
+      var.setValue(m_DataContainerName);
+      DREAM3D_REQUIRE_EQUAL(import->setProperty("DataContainerName", var), true);
+      var.setValue(m_CellAMName);
+      DREAM3D_REQUIRE_EQUAL(import->setProperty("CellAttributeMatrixName", var), true);
+      var.setValue(m_MetaDataAMName);
+      DREAM3D_REQUIRE_EQUAL(import->setProperty("MetaDataAttributeMatrixName", var), true);
+      var.setValue(fli);
+      DREAM3D_REQUIRE_EQUAL(import->setProperty("InputFileListInfo", var), true);
+      var.setValue(numberOfReaderThreads);
+      DREAM3D_REQUIRE_EQUAL(import->setProperty("NumberOfReaderThreads", var), true);
+
+      import->execute();
+      DREAM3D_REQUIRE_EQUAL(import->getErrorCondition(), 0);
+
+      AttributeMatrix::Pointer metaData = containerArray->getDataContainer(m_DataContainerName)->getAttributeMatrix(m_MetaDataAMName);
+      DREAM3D_REQUIRE_VALID_POINTER(metaData.get());
+      DREAM3D_REQUIRE_EQUAL(metaData->getNumberOfTuples(), static_cast<size_t>(fli.EndIndex - fli.StartIndex + 1));
+
+      // Every tile must hold what the ITK image reader reads from its file
+      for(int index = fli.StartIndex; index <= fli.EndIndex; index++)
+      {
+        const QString tileName = QString("slice_%1").arg(index, fli.PaddingDigits, 10, QChar('0'));
+        const QString fileName = QString("%1/%2.%3").arg(fli.InputPath).arg(tileName).arg(fli.FileExtension);
+        const DataArrayPath referencePath(QString("Reference_%1").arg(index), SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::ImageData);
+        DREAM3D_REQUIRE_EQUAL(this->ReadImage(fileName, containerArray, referencePath), 0);
+        const DataArrayPath tilePath(m_DataContainerName, m_CellAMName, tileName);
+        DREAM3D_REQUIRE_EQUAL(this->CompareImages(containerArray, tilePath, referencePath, 0.0), 0);
+      }
+    }
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename T> bool IsStackSlice(const IDataArray::Pointer& stack, size_t slice, const IDataArray::Pointer& tile)
+  {
+    typename DataArray<T>::Pointer stackArray = std::dynamic_pointer_cast<DataArray<T>>(stack);
+    typename DataArray<T>::Pointer tileArray = std::dynamic_pointer_cast<DataArray<T>>(tile);
+    if(nullptr == stackArray.get() || nullptr == tileArray.get())
+    {
+      return false;
+    }
+    const T* sliceValues = stackArray->getPointer(slice * tileArray->getSize());
+    return std::equal(sliceValues, sliceValues + tileArray->getSize(), tileArray->getPointer(0));
+  }
+
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  void TestPackedTiles()
+  {
+    FileListInfo_t fli;
+    fli.PaddingDigits = 2;
+    fli.Ordering = 0;
+    fli.StartIndex = 11;
+    fli.EndIndex = 26;
+    fli.IncrementIndex = 1;
+    fli.InputPath = UnitTest::DataDir + "/Data/Image";
+    fli.FilePrefix = "slice_";
+    fli.FileSuffix = "";
+    fli.FileExtension = "tif";
+    const size_t numberOfTiles = static_cast<size_t>(fli.EndIndex - fli.StartIndex + 1);
+
+    FilterManager* fm = FilterManager::Instance();
+    IFilterFactory::Pointer filterFactory = fm->getFactoryFromClassName("ImportImageMontage");
+    DREAM3D_REQUIRE_VALID_POINTER(filterFactory.get());
+    AbstractFilter::Pointer import = filterFactory->create();
+    DataContainerArray::Pointer containerArray = DataContainerArray::New();
+    import->setDataContainerArray(containerArray);
+
+    QVariant var;
+    var.setValue(m_DataContainerName);
+    DREAM3D_REQUIRE_EQUAL(import->setProperty("DataContainerName", var), true);
+    var.setValue(m_CellAMName);
+    DREAM3D_REQUIRE_EQUAL(import->setProperty("CellAttributeMatrixName", var), true);
+    var.setValue(m_MetaDataAMName);
+    DREAM3D_REQUIRE_EQUAL(import->setProperty("MetaDataAttributeMatrixName", var), true);
+    var.setValue(fli);
+    DREAM3D_REQUIRE_EQUAL(import->setProperty("InputFileListInfo", var), true);
+    var.setValue(true);
+    DREAM3D_REQUIRE_EQUAL(import->setProperty("PackTiles", var), true);
+    var.setValue(QString("Tiles"));
+    DREAM3D_REQUIRE_EQUAL(import->setProperty("PackedTilesArrayName", var), true);
+    var.setValue(QString("TileNames"));
+    DREAM3D_REQUIRE_EQUAL(import->setProperty("TileNamesArrayName", var), true);
+
+    import->execute();
+    DREAM3D_REQUIRE_EQUAL(import->getErrorCondition(), 0);
+
+    DataContainer::Pointer container = containerArray->getDataContainer(m_DataContainerName);
+    AttributeMatrix::Pointer cellData = container->getAttributeMatrix(m_CellAMName);
+    DREAM3D_REQUIRE_EQUAL(cellData->getNumAttributeArrays(), 1);
+    DREAM3D_REQUIRE_EQUAL(cellData->getTupleDimensions()[2], numberOfTiles);
+    IDataArray::Pointer stack = cellData->getAttributeArray("Tiles");
+    DREAM3D_REQUIRE_VALID_POINTER(stack.get());
+    StringDataArray::Pointer tileNames = std::dynamic_pointer_cast<StringDataArray>(container->getAttributeMatrix(m_MetaDataAMName)->getAttributeArray("TileNames"));
+    DREAM3D_REQUIRE_VALID_POINTER(tileNames.get());
+    DREAM3D_REQUIRE_EQUAL(tileNames->getNumberOfTuples(), numberOfTiles);
+
+    // Slice i of the stack must hold what the ITK image reader reads from the file named by tuple i of the index
+    for(size_t i = 0; i < numberOfTiles; i++)
+    {
+      const QString tileName = QString("slice_%1").arg(fli.StartIndex + static_cast<int>(i), fli.PaddingDigits, 10, QChar('0'));
+      DREAM3D_REQUIRE_EQUAL(tileNames->getValue(i), tileName);
+      const QString fileName = QString("%1/%2.%3").arg(fli.InputPath).arg(tileName).arg(fli.FileExtension);
+      const DataArrayPath referencePath(QString("PackedReference_%1").arg(i), SIMPL::Defaults::CellAttributeMatrixName, SIMPL::CellData::ImageData);
+      DREAM3D_REQUIRE_EQUAL(this->ReadImage(fileName, containerArray, referencePath), 0);
+      IDataArray::Pointer tile = containerArray->getAttributeMatrix(referencePath)->getAttributeArray(referencePath.getDataArrayName());
+      const bool equal = IsStackSlice<uint8_t>(stack, i, tile) || IsStackSlice<int8_t>(stack, i, tile) || IsStackSlice<uint16_t>(stack, i, tile) || IsStackSlice<int16_t>(stack, i, tile) ||
+                         IsStackSlice<uint32_t>(stack, i, tile) || IsStackSlice<int32_t>(stack, i, tile) || IsStackSlice<float>(stack, i, tile) || IsStackSlice<double>(stack, i, tile);
+      DREAM3D_REQUIRE_EQUAL(equal, true);
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -142,6 +286,8 @@ public:
     DREAM3D_REGISTER_TEST(this->TestFilterAvailability("ImportImageMontage"));
 
     DREAM3D_REGISTER_TEST(TestImportImageMontageTest());
+    DREAM3D_REGISTER_TEST(TestConcurrentImport());
+    DREAM3D_REGISTER_TEST(TestPackedTiles());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {
@@ -37,6 +37,11 @@
 #include "SIMPLib/Filtering/FilterPipeline.h"
 
 #include "ITKImageProcessing/FilterParameters/ImportVectorImageStackFilterParameter.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ITKImageReader.h"
+#include "ITKImageProcessing/ITKImageProcessingFilters/ImportVectorImageStack.h"
+
+#include <itkImageFileWriter.h>
+#include <itkRGBPixel.h>
 
 class ImportVectorImageStackTest : public ITKTestBase
 {
@@ -163,6 +168,119 @@ public:
     DREAM3D_REQUIRE_EQUAL(err, 0)
   }
 
+  // -----------------------------------------------------------------------------
+  //
+  // -----------------------------------------------------------------------------
+  template <typename PixelType> void WriteComponentImage(const QString& fileName, int slice, int component)
+  {
+    using ImageType = itk::Image<PixelType, 2>;
+    typename ImageType::SizeType size = {{37, 23}};
+    typename ImageType::Pointer image = ImageType::New();
+    image->SetRegions(typename ImageType::RegionType(size));
+    image->Allocate();
+    PixelType* pixels = image->GetBufferPointer();
+    const unsigned int numberOfComponents = itk::NumericTraits<PixelType>::GetLength();
+    uint8_t* values = reinterpret_cast<uint8_t*>(pixels);
+    for(size_t i = 0; i < size[0] * size[1] * numberOfComponents; i++)
+    {
+      values[i] = static_cast<uint8_t>((i * 13 + slice * 29 + component * 7) % 256);
+    }
+    using WriterType = itk::ImageFileWriter<ImageType>;
+    typename WriterType::Pointer writer = WriterType::New();
+    writer->SetFileName(fileName.toStdString());
+    writer->SetInput(image);
+    writer->Update();
+  }
+
+  // -----------------------------------------------------------------------------
+  // Checks every value of a stack mixing grayscale and RGB files against the value the files
+  // read one at a time give, with one reader thread and with all the cores.
+  // -----------------------------------------------------------------------------
+  void TestImportedValues()
+  {
+    const int numberOfSlices = 5;
+    const int numberOfComponents = 4;
+    VectorFileListInfo_t fli;
+    fli.PaddingDigits = 1;
+    fli.Ordering = 0;
+    fli.StartIndex = 0;
+    fli.EndIndex = numberOfSlices - 1;
+    fli.IncrementIndex = 1;
+    fli.InputPath = UnitTest::TestTempDir;
+    fli.FilePrefix = "ImportVectorValues_";
+    fli.FileSuffix = "";
+    fli.FileExtension = "png";
+    fli.StartComponent = 0;
+    fli.EndComponent = numberOfComponents - 1;
+    fli.Separator = "-";
+    for(int i = 0; i < numberOfSlices; i++)
+    {
+      for(int j = 0; j < numberOfComponents; j++)
+      {
+        QString fileName = QString("%1/ImportVectorValues_%2-%3.png").arg(UnitTest::TestTempDir).arg(i).arg(j);
+        // Odd components are color images
+        if(j % 2 == 1)
+        {
+          WriteComponentImage<itk::RGBPixel<uint8_t>>(fileName, i, j);
+        }
+        else
+        {
+          WriteComponentImage<uint8_t>(fileName, i, j);
+        }
+        FilesToRemove << fileName;
+      }
+    }
+
+    for(int convertToGrayscale = 0; convertToGrayscale < 2; convertToGrayscale++)
+    {
+      for(int numberOfThreads = 0; numberOfThreads < 2; numberOfThreads++)
+      {
+        ImportVectorImageStack::Pointer import = ImportVectorImageStack::New();
+        import->setDataContainerArray(DataContainerArray::New());
+        import->setDataContainerName(m_DataContainerName);
+        import->setCellAttributeMatrixName(m_CellAMName);
+        import->setVectorDataArrayName(m_VectorDataArrayName);
+        import->setInputFileListInfo(fli);
+        import->setConvertToGrayscale(convertToGrayscale == 1);
+        import->setNumberOfReaderThreads(numberOfThreads);
+        import->execute();
+        DREAM3D_REQUIRED(import->getErrorCondition(), >=, 0);
+        UInt8ArrayType::Pointer vectorData = std::dynamic_pointer_cast<UInt8ArrayType>(
+            import->getDataContainerArray()->getDataContainer(m_DataContainerName)->getAttributeMatrix(m_CellAMName)->getAttributeArray(m_VectorDataArrayName));
+        DREAM3D_REQUIRE_VALID_POINTER(vectorData.get());
+        DREAM3D_REQUIRE_EQUAL(vectorData->getNumberOfComponents(), numberOfComponents);
+        const size_t numberOfPixels = 37 * 23;
+        DREAM3D_REQUIRE_EQUAL(vectorData->getNumberOfTuples(), numberOfPixels * numberOfSlices);
+
+        for(int i = 0; i < numberOfSlices; i++)
+        {
+          for(int j = 0; j < numberOfComponents; j++)
+          {
+            ITKImageReader::Pointer reader = ITKImageReader::New();
+            reader->setDataContainerArray(DataContainerArray::New());
+            reader->setDataContainerName("Reference");
+            reader->setFileName(QString("%1/ImportVectorValues_%2-%3.png").arg(UnitTest::TestTempDir).arg(i).arg(j));
+            reader->execute();
+            DREAM3D_REQUIRED(reader->getErrorCondition(), >=, 0);
+            UInt8ArrayType::Pointer reference = std::dynamic_pointer_cast<UInt8ArrayType>(
+                reader->getDataContainerArray()->getDataContainer("Reference")->getAttributeMatrix(SIMPL::Defaults::CellAttributeMatrixName)->getAttributeArray(SIMPL::CellData::ImageData));
+            DREAM3D_REQUIRE_VALID_POINTER(reference.get());
+            for(size_t t = 0; t < numberOfPixels; t++)
+            {
+              uint8_t* value = reference->getTuplePointer(t);
+              uint8_t expected = value[0];
+              if(reference->getNumberOfComponents() == 3 && convertToGrayscale == 1)
+              {
+                expected = static_cast<uint16_t>((value[0] * 0.2125f) + (value[1] * 0.7154f) + (value[2] * 0.0721f));
+              }
+              DREAM3D_REQUIRE_EQUAL(vectorData->getComponent(i * numberOfPixels + t, j), expected);
+            }
+          }
+        }
+      }
+    }
+  }
+
   // -----------------------------------------------------------------------------
   //
   // -----------------------------------------------------------------------------
@@ -174,6 +292,7 @@ public:
     DREAM3D_REGISTER_TEST(this->TestFilterAvailability("ImportVectorImageStack"));
 
     DREAM3D_REGISTER_TEST(TestImportVectorImageStackTest());
+    DREAM3D_REGISTER_TEST(TestImportedValues());
 
     if(SIMPL::unittest::numTests == SIMPL::unittest::numTestsPass)
     {